@@ -67,6 +67,18 @@ static const char infer_latency_percentile_message[] =
     "Optional. Defines the percentile to be reported in latency metric. The valid range is [1, 100]. The default value "
     "is 50 (median).";
 
+/// @brief message for arrival rate settings
+static const char arrival_rate_message[] =
+    "Optional. Enables the open-loop load generation with the given target arrival rate of the requests per second. "
+    "The requests arrive independently of the completion of the previous ones, the time spent waiting for an idle "
+    "infer request is reported separately from the inference time. Applicable only for the async API.";
+
+/// @brief message for arrival distribution settings
+static const char arrival_distribution_message[] =
+    "Optional. Distribution of the intervals between the request arrivals for the open-loop load generation: "
+    "\"constant\" or \"poisson\". The poisson arrivals are generated from a fixed seed, so runs are reproducible. "
+    "Default value is \"constant\".";
+
 /// @brief message for enforcing of BF16 execution where it is possible
 static const char enforce_bf16_message[] =
     "Optional. By default floating point operations execution in bfloat16 precision are enforced "
@@ -228,6 +240,12 @@ DEFINE_string(nstreams, "", infer_num_streams_message);
 /// @brief The percentile which will be reported in latency metric
 DEFINE_uint32(latency_percentile, 50, infer_latency_percentile_message);
 
+/// @brief Define parameter for the target arrival rate of the open-loop load generation <br>
+DEFINE_double(arrival_rate, 0.0, arrival_rate_message);
+
+/// @brief Define parameter for the distribution of the request arrivals <br>
+DEFINE_string(arrival_distribution, "constant", arrival_distribution_message);
+
 /// @brief Enforces bf16 execution with bfloat16 precision on systems having this capability
 DEFINE_bool(enforcebf16, false, enforce_bf16_message);
 
@@ -324,6 +342,8 @@ static void showUsage() {
     std::cout << "    -cache_dir \"<path>\"        " << cache_dir_message << std::endl;
     std::cout << "    -load_from_file           " << load_from_file_message << std::endl;
     std::cout << "    -latency_percentile       " << infer_latency_percentile_message << std::endl;
+    std::cout << "    -arrival_rate \"<double>\"  " << arrival_rate_message << std::endl;
+    std::cout << "    -arrival_distribution \"constant\"/\"poisson\"  " << arrival_distribution_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
@@ -21,7 +21,7 @@
 typedef std::chrono::high_resolution_clock Time;
 typedef std::chrono::nanoseconds ns;
 
-typedef std::function<void(size_t id, const double latency)> QueueCallbackFunction;
+typedef std::function<void(size_t id, const double latency, const double queueWait)> QueueCallbackFunction;
 
 /// @brief Wrapper class for InferenceEngine::InferRequest. Handles asynchronous callbacks and calculates execution
 /// time.
@@ -37,12 +37,21 @@ public:
           _callbackQueue(callbackQueue) {
         _request.SetCompletionCallback([&]() {
             _endTime = Time::now();
-            _callbackQueue(_id, getExecutionTimeInMilliseconds());
+            _callbackQueue(_id, getExecutionTimeInMilliseconds(), getQueueWaitInMilliseconds());
         });
     }
 
     void startAsync() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
+        _request.StartAsync();
+    }
+
+    /// @brief Starts the request which was due at the given arrival time, the time between the arrival and the start
+    /// is reported as the queue wait
+    void startAsync(Time::time_point arrivalTime) {
+        _startTime = Time::now();
+        _arrivalTime = std::min(arrivalTime, _startTime);
         _request.StartAsync();
     }
 
@@ -52,9 +61,10 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
         _request.Infer();
         _endTime = Time::now();
-        _callbackQueue(_id, getExecutionTimeInMilliseconds());
+        _callbackQueue(_id, getExecutionTimeInMilliseconds(), getQueueWaitInMilliseconds());
     }
 
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> getPerformanceCounts() {
@@ -70,8 +80,14 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double getQueueWaitInMilliseconds() const {
+        auto waitTime = std::chrono::duration_cast<ns>(_startTime - _arrivalTime);
+        return static_cast<double>(waitTime.count()) * 0.000001;
+    }
+
 private:
     InferenceEngine::InferRequest _request;
+    Time::time_point _arrivalTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
@@ -85,7 +101,11 @@ public:
             requests.push_back(std::make_shared<InferReqWrap>(
                 net,
                 id,
-                std::bind(&InferRequestsQueue::putIdleRequest, this, std::placeholders::_1, std::placeholders::_2)));
+                std::bind(&InferRequestsQueue::putIdleRequest,
+                          this,
+                          std::placeholders::_1,
+                          std::placeholders::_2,
+                          std::placeholders::_3)));
             _idleIds.push(id);
         }
         resetTimes();
@@ -104,15 +124,17 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _queueWaits.clear();
     }
 
     double getDurationInMilliseconds() {
         return std::chrono::duration_cast<ns>(_endTime - _startTime).count() * 0.000001;
     }
 
-    void putIdleRequest(size_t id, const double latency) {
+    void putIdleRequest(size_t id, const double latency, const double queueWait) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        _queueWaits.push_back(queueWait);
         _idleIds.push(id);
         _endTime = std::max(Time::now(), _endTime);
         _cv.notify_one();
@@ -140,6 +162,12 @@ public:
         return _latencies;
     }
 
+    /// @brief Returns the time the requests waited for an idle request after their arrival,
+    /// in the same order as getLatencies()
+    std::vector<double> getQueueWaits() {
+        return _queueWaits;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -149,4 +177,5 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<double> _queueWaits;
 };
@@ -4,15 +4,18 @@
 
 #include <algorithm>
 #include <chrono>
+#include <functional>
 #include <gna/gna_config.hpp>
 #include <gpu/gpu_config.hpp>
 #include <inference_engine.hpp>
 #include <map>
 #include <memory>
+#include <random>
 #include <samples/args_helper.hpp>
 #include <samples/common.hpp>
 #include <samples/slog.hpp>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 #include <vpu/vpu_plugin_config.hpp>
@@ -60,6 +63,17 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
 
+    if (FLAGS_arrival_rate < 0) {
+        throw std::logic_error("Incorrect arrival rate. Please set -arrival_rate option to a positive value.");
+    }
+    if (FLAGS_arrival_rate > 0 && FLAGS_api != "async") {
+        throw std::logic_error("The open-loop load generation (-arrival_rate) is supported only for the async API.");
+    }
+    if (FLAGS_arrival_distribution != "constant" && FLAGS_arrival_distribution != "poisson") {
+        throw std::logic_error("Incorrect arrival distribution. "
+                               "Please set -arrival_distribution option to `constant` or `poisson` value.");
+    }
+
     if (!FLAGS_report_type.empty() && FLAGS_report_type != noCntReport && FLAGS_report_type != averageCntReport &&
         FLAGS_report_type != detailedCntReport) {
         std::string err = "only " + std::string(noCntReport) + "/" + std::string(averageCntReport) + "/" +
@@ -546,6 +560,13 @@ int main(int argc, char* argv[]) {
                     {"number of parallel infer requests", std::to_string(nireq)},
                     {"duration (ms)", std::to_string(getDurationInMilliseconds(duration_seconds))},
                 });
+            if (FLAGS_arrival_rate > 0) {
+                statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                          {
+                                              {"arrival rate (requests/s)", double_to_string(FLAGS_arrival_rate)},
+                                              {"arrival distribution", FLAGS_arrival_distribution},
+                                          });
+            }
             for (auto& nstreams : device_nstreams) {
                 std::stringstream ss;
                 ss << "number of " << nstreams.first << " streams";
@@ -586,6 +607,10 @@ int main(int argc, char* argv[]) {
             if (!device_ss.str().empty()) {
                 ss << " using " << device_ss.str();
             }
+            if (FLAGS_arrival_rate > 0) {
+                ss << ", " << FLAGS_arrival_distribution << " arrivals at " << double_to_string(FLAGS_arrival_rate)
+                   << " requests/s";
+            }
         }
         ss << ", limits: ";
         if (duration_seconds > 0) {
@@ -623,6 +648,19 @@ int main(int argc, char* argv[]) {
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
+        // In the open-loop mode the requests arrive by the schedule which does not depend on the completion of the
+        // previous ones. A request is started at its arrival time or as soon as an infer request becomes idle, so the
+        // queue wait caused by an overload is accounted to the latency instead of slowing down the arrivals.
+        const bool openLoop = FLAGS_arrival_rate > 0;
+        std::mt19937 arrivalGenerator(0);
+        std::exponential_distribution<double> poissonIntervals(openLoop ? FLAGS_arrival_rate : 1.0);
+        auto nextArrivalInterval = [&]() {
+            double seconds = FLAGS_arrival_distribution == "poisson" ? poissonIntervals(arrivalGenerator)
+                                                                     : 1.0 / FLAGS_arrival_rate;
+            return std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(seconds));
+        };
+        auto arrivalTime = startTime;
+
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are
          * executed in the same conditions **/
@@ -630,7 +668,10 @@ int main(int argc, char* argv[]) {
 
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+               (FLAGS_api == "async" && !openLoop && iteration % nireq != 0)) {
+            if (openLoop) {
+                std::this_thread::sleep_until(arrivalTime);
+            }
             inferRequest = inferRequestsQueue.getIdleRequest();
             if (!inferRequest) {
                 IE_THROW() << "No idle Infer Requests!";
@@ -638,6 +679,10 @@ int main(int argc, char* argv[]) {
 
             if (FLAGS_api == "sync") {
                 inferRequest->infer();
+            } else if (openLoop) {
+                inferRequest->wait();
+                inferRequest->startAsync(arrivalTime);
+                arrivalTime += nextArrivalInterval();
             } else {
                 // As the inference request is currently idle, the wait() adds no
                 // additional overhead (and should return immediately). The primary
@@ -669,7 +714,17 @@ int main(int argc, char* argv[]) {
         // wait the latest inference executions
         inferRequestsQueue.waitAll();
 
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies(), FLAGS_latency_percentile);
+        // in the open-loop mode the latency observed by a client includes the wait for an idle request
+        std::vector<double> latencies = inferRequestsQueue.getLatencies();
+        std::vector<double> queueWaits = inferRequestsQueue.getQueueWaits();
+        if (openLoop) {
+            std::transform(latencies.begin(),
+                           latencies.end(),
+                           queueWaits.begin(),
+                           latencies.begin(),
+                           std::plus<double>());
+        }
+        double latency = getMedianValue<double>(latencies, FLAGS_latency_percentile);
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
         double fps =
             (FLAGS_api == "sync") ? batchSize * 1000.0 / latency : batchSize * 1000.0 * iteration / totalDuration;
@@ -694,6 +749,14 @@ int main(int argc, char* argv[]) {
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                       {{"throughput", double_to_string(fps)}});
+            if (!latencies.empty()) {
+                statistics->addLatencyHistogram("latency", LatencyHistogram(latencies));
+                if (openLoop) {
+                    statistics->addLatencyHistogram("queue wait", LatencyHistogram(queueWaits));
+                    statistics->addLatencyHistogram("service time",
+                                                    LatencyHistogram(inferRequestsQueue.getLatencies()));
+                }
+            }
         }
 
         progressBar.finish();
@@ -749,6 +812,20 @@ int main(int argc, char* argv[]) {
             std::cout << double_to_string(latency) << " ms" << std::endl;
         }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
+        if (openLoop && !latencies.empty()) {
+            auto printDistribution = [&](const std::string& name, const std::vector<double>& values) {
+                LatencyHistogram histogram(values);
+                std::cout << name << double_to_string(histogram.percentile(50)) << " / "
+                          << double_to_string(histogram.percentile(90)) << " / "
+                          << double_to_string(histogram.percentile(99)) << " / "
+                          << double_to_string(histogram.percentile(99.9)) << " ms (p50 / p90 / p99 / p99.9)"
+                          << std::endl;
+            };
+            std::cout << "Offered load: " << double_to_string(FLAGS_arrival_rate * batchSize) << " FPS" << std::endl;
+            printDistribution("Latency:      ", latencies);
+            printDistribution("Queue wait:   ", queueWaits);
+            printDistribution("Service time: ", inferRequestsQueue.getLatencies());
+        }
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
@@ -5,11 +5,77 @@
 #include "statistics_report.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <iomanip>
 #include <map>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
 
+LatencyHistogram::LatencyHistogram(std::vector<double> latencies) : _latencies(std::move(latencies)) {
+    if (_latencies.empty())
+        throw std::logic_error("Latency histogram requires at least one measurement");
+    std::sort(_latencies.begin(), _latencies.end());
+}
+
+double LatencyHistogram::percentile(double percent) const {
+    // nearest-rank method
+    auto rank = static_cast<size_t>(std::ceil(percent / 100.0 * _latencies.size() - 1e-9));
+    return _latencies[std::min(std::max(rank, size_t(1)), _latencies.size()) - 1];
+}
+
+double LatencyHistogram::min() const {
+    return _latencies.front();
+}
+
+double LatencyHistogram::max() const {
+    return _latencies.back();
+}
+
+double LatencyHistogram::average() const {
+    return std::accumulate(_latencies.begin(), _latencies.end(), 0.0) / _latencies.size();
+}
+
+std::vector<std::pair<double, size_t>> LatencyHistogram::buckets() const {
+    // 8 buckets per doubling of the latency starting from 1 microsecond
+    static const double firstBound = 0.001;
+    static const double growth = std::pow(2.0, 1.0 / 8);
+
+    std::vector<std::pair<double, size_t>> buckets;
+    double bound = firstBound;
+    while (bound < min())
+        bound *= growth;
+    buckets.emplace_back(bound, 0);
+    for (auto latency : _latencies) {
+        while (latency > buckets.back().first)
+            buckets.emplace_back(buckets.back().first * growth, 0);
+        buckets.back().second++;
+    }
+    return buckets;
+}
+
+void StatisticsReport::addLatencyHistogram(const std::string& name, const LatencyHistogram& histogram) {
+    auto to_string = [](double value) {
+        std::stringstream ss;
+        ss << std::fixed << std::setprecision(3) << value;
+        return ss.str();
+    };
+    addParameters(Category::EXECUTION_RESULTS,
+                  {
+                      {name + " min (ms)", to_string(histogram.min())},
+                      {name + " avg (ms)", to_string(histogram.average())},
+                      {name + " p50 (ms)", to_string(histogram.percentile(50))},
+                      {name + " p90 (ms)", to_string(histogram.percentile(90))},
+                      {name + " p99 (ms)", to_string(histogram.percentile(99))},
+                      {name + " p99.9 (ms)", to_string(histogram.percentile(99.9))},
+                      {name + " max (ms)", to_string(histogram.max())},
+                  });
+    _histograms.emplace_back(name, histogram.buckets());
+}
+
 void StatisticsReport::addParameters(const Category& category, const Parameters& parameters) {
     if (_parameters.count(category) == 0)
         _parameters[category] = parameters;
@@ -50,6 +116,19 @@ void StatisticsReport::dump() {
         dumper.endLine();
     }
 
+    for (auto& histogram : _histograms) {
+        dumper << histogram.first + " histogram";
+        dumper.endLine();
+        dumper << "upper bound (ms)"
+               << "count";
+        dumper.endLine();
+        for (auto& bucket : histogram.second) {
+            dumper << bucket.first << bucket.second;
+            dumper.endLine();
+        }
+        dumper.endLine();
+    }
+
     slog::info << "Statistics report is stored to " << dumper.getFilename() << slog::endl;
 }
 
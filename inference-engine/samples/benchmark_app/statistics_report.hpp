@@ -18,6 +18,29 @@ static constexpr char noCntReport[] = "no_counters";
 static constexpr char averageCntReport[] = "average_counters";
 static constexpr char detailedCntReport[] = "detailed_counters";
 
+/// @brief Distribution of the latencies of the executed requests
+class LatencyHistogram {
+public:
+    explicit LatencyHistogram(std::vector<double> latencies);
+
+    /// @brief Returns the latency which is not exceeded by the given percent of the requests
+    double percentile(double percent) const;
+
+    double min() const;
+    double max() const;
+    double average() const;
+    size_t count() const {
+        return _latencies.size();
+    }
+
+    /// @brief Returns the pairs of the bucket upper bound and the number of the requests in the bucket,
+    /// the bounds grow geometrically so the tail is represented with the same relative precision as the median
+    std::vector<std::pair<double, size_t>> buckets() const;
+
+private:
+    std::vector<double> _latencies;
+};
+
 /// @brief Responsible for collecting of statistics and dumping to .csv file
 class StatisticsReport {
 public:
@@ -56,6 +79,9 @@ public:
 
     void dumpPerformanceCounters(const std::vector<PerformaceCounters>& perfCounts);
 
+    /// @brief Adds the percentiles of the latency distribution to the execution results and the histogram to the report
+    void addLatencyHistogram(const std::string& name, const LatencyHistogram& histogram);
+
 private:
     void dumpPerformanceCountersRequest(CsvDumper& dumper, const PerformaceCounters& perfCounts);
 
@@ -65,6 +91,9 @@ private:
     // parameters
     std::map<Category, Parameters> _parameters;
 
+    // latency histograms
+    std::vector<std::pair<std::string, std::vector<std::pair<double, size_t>>>> _histograms;
+
     // csv separator
     std::string _separator;
 };
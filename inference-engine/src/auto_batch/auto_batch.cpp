@@ -0,0 +1,668 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <blob_factory.hpp>
+#include <blob_transform.hpp>
+#include <ie_icore.hpp>
+#include <ie_metric_helpers.hpp>
+#include <ie_ngraph_utils.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "auto_batch.hpp"
+
+namespace AutoBatchPlugin {
+    using namespace InferenceEngine;
+
+namespace {
+
+    constexpr int defaultBatchSize = 8;
+    const char defaultTimeout[] = "10";
+
+    std::map<std::string, std::string> mergeConfigs(std::map<std::string, std::string> config,
+                                                    const std::map<std::string, std::string> & local) {
+        for (auto && kvp : local) {
+            config[kvp.first] = kvp.second;
+        }
+        return config;
+    }
+
+    std::vector<std::string> supported_configKeys = {
+        AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE,
+        AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT
+    };
+
+    bool isBatchFirst(const Layout layout) {
+        static const std::set<Layout> batchFirstLayouts = {Layout::NC, Layout::NCHW, Layout::NHWC,
+                                                           Layout::NCDHW, Layout::NDHWC};
+        return batchFirstLayouts.count(layout) != 0;
+    }
+
+    // reshapes the network so every input and output holds `batch` times more samples along the batch dimension,
+    // returns false if the network can not be batched this way (the network is left in an undefined state then)
+    bool reshapeToBatch(CNNNetwork& network, const size_t batch) {
+        const auto inputsInfo = network.getInputsInfo();
+        const auto outputsInfo = network.getOutputsInfo();
+        std::map<std::string, std::pair<Precision, Layout>> inputsFormat, outputsFormat;
+        std::map<std::string, SizeVector> outputsDims;
+
+        auto shapes = network.getInputShapes();
+        for (auto&& input : inputsInfo) {
+            const auto& desc = input.second->getTensorDesc();
+            if (!isBatchFirst(desc.getLayout()) || desc.getDims().empty())
+                return false;
+            shapes[input.first][0] *= batch;
+            inputsFormat[input.first] = {input.second->getPrecision(), input.second->getLayout()};
+        }
+        for (auto&& output : outputsInfo) {
+            const auto& desc = output.second->getTensorDesc();
+            if (!isBatchFirst(desc.getLayout()) || desc.getDims().empty())
+                return false;
+            outputsDims[output.first] = desc.getDims();
+            outputsFormat[output.first] = {output.second->getPrecision(), output.second->getLayout()};
+        }
+
+        try {
+            network.reshape(shapes);
+        } catch (const Exception&) {
+            return false;
+        }
+
+        // the samples must stay independent, so only the batch dimension of the outputs may grow
+        for (auto&& output : network.getOutputsInfo()) {
+            auto dims = outputsDims[output.first];
+            dims[0] *= batch;
+            if (output.second->getTensorDesc().getDims() != dims)
+                return false;
+            output.second->setPrecision(outputsFormat[output.first].first);
+            output.second->setLayout(outputsFormat[output.first].second);
+        }
+        for (auto&& input : network.getInputsInfo()) {
+            input.second->setPrecision(inputsFormat[input.first].first);
+            input.second->setLayout(inputsFormat[input.first].second);
+        }
+        return true;
+    }
+
+    void copyBlob(const Blob::Ptr& src, const Blob::Ptr& dst) {
+        if (src->getTensorDesc().getLayout() != dst->getTensorDesc().getLayout()) {
+            blob_copy(src, dst);
+            return;
+        }
+        auto srcMemory = as<MemoryBlob>(src);
+        auto dstMemory = as<MemoryBlob>(dst);
+        if (!srcMemory || !dstMemory)
+            IE_THROW() << "BATCH device can only copy the memory blobs";
+        auto srcHolder = srcMemory->rmap();
+        auto dstHolder = dstMemory->wmap();
+        std::memcpy(dstHolder.as<uint8_t*>(), srcHolder.as<const uint8_t*>(), std::min(src->byteSize(), dst->byteSize()));
+    }
+
+}  // namespace
+
+// ------------------------------AutoBatchInferRequest----------------------------
+AutoBatchInferRequest::AutoBatchInferRequest(const InputsDataMap&     networkInputs,
+                                             const OutputsDataMap&    networkOutputs)
+        : IInferRequestInternal(networkInputs, networkOutputs) {
+    // the request gets a slot of the batch only when it is started and the slot is reused by the next batch
+    // right after the completion, so the request keeps the data in its own blobs and they are copied to and from
+    // the slot instead of being the views of it
+    for (const auto& it : _networkInputs) {
+        _inputs[it.first] = make_blob_with_precision(it.second->getTensorDesc());
+        _inputs[it.first]->allocate();
+    }
+    for (const auto& it : _networkOutputs) {
+        _outputs[it.first] = make_blob_with_precision(it.second->getTensorDesc());
+        _outputs[it.first]->allocate();
+    }
+}
+
+void AutoBatchInferRequest::CopyInputsToSlot() {
+    auto& slotInputs = _workerRequest->_slotInputs[_batchId];
+    execDataPreprocessing(slotInputs);
+    for (const auto& it : _networkInputs) {
+        auto& name = it.first;
+        if (_preProcData.find(name) == _preProcData.end())
+            copyBlob(_inputs[name], slotInputs[name]);
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputsFromSlot() {
+    auto& slotOutputs = _workerRequest->_slotOutputs[_batchId];
+    for (const auto& it : _networkOutputs)
+        copyBlob(slotOutputs[it.first], _outputs[it.first]);
+}
+
+std::map<std::string, InferenceEngineProfileInfo> AutoBatchInferRequest::GetPerformanceCounts() const {
+    IE_THROW(NotImplemented);
+}
+
+void AutoBatchInferRequest::InferImpl() {
+    IE_THROW(NotImplemented);
+}
+
+// ------------------------------AutoBatchAsyncInferRequest----------------------------
+AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
+    const AutoBatchInferRequest::Ptr&         inferRequest,
+    const bool                                needPerfCounters,
+    const AutoBatchExecutableNetwork::Ptr&    autoBatchExecutableNetwork,
+    const ITaskExecutor::Ptr&                 callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(inferRequest, nullptr, callbackExecutor),
+    _autoBatchExecutableNetwork{autoBatchExecutableNetwork},
+    _inferRequest{inferRequest},
+    _needPerfCounters{needPerfCounters} {
+    // this executor puts the request to the batch while the task (checking the result) is run on the batch completion,
+    // the request gets its slot and fills it in the executor, so the slots are taken in the order the requests come
+    struct ThisRequestExecutor : public ITaskExecutor {
+        explicit ThisRequestExecutor(AutoBatchAsyncInferRequest* _this_) : _this{_this_} {}
+        void run(Task task) override {
+            _this->_inferRequest->_task = std::move(task);
+            _this->_autoBatchExecutableNetwork->Enqueue(_this->_inferRequest.get());
+        };
+        AutoBatchAsyncInferRequest* _this = nullptr;
+    };
+    _pipeline = {
+        // final task in the pipeline:
+        { /*TaskExecutor*/ std::make_shared<ThisRequestExecutor>(this), /*task*/ [this] {
+            if (nullptr != _inferRequest->_exceptionPtr) {
+                std::rethrow_exception(_inferRequest->_exceptionPtr);
+            }
+            _inferRequest->CopyOutputsFromSlot();
+            if (_needPerfCounters)
+                _perfMap = _inferRequest->_completedBy->GetPerformanceCounts();
+        }}
+    };
+}
+
+void AutoBatchAsyncInferRequest::Infer_ThreadUnsafe() {
+    InferUsingAsync();
+}
+
+std::map<std::string, InferenceEngineProfileInfo> AutoBatchAsyncInferRequest::GetPerformanceCounts() const {
+    CheckState();
+    return _perfMap;
+}
+
+AutoBatchAsyncInferRequest::~AutoBatchAsyncInferRequest() {
+    StopAndWait();
+}
+
+// ------------------------------AutoBatchExecutableNetwork----------------------------
+AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(const SoExecutableNetworkInternal&   batchedNetwork,
+                                                       const DeviceInformation&             device,
+                                                       const std::unordered_map<std::string, Parameter>& config,
+                                                       const bool                           dynamicBatch,
+                                                       const bool                           needPerfCounters) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
+    _batchedNetwork{batchedNetwork},
+    _device{device},
+    _config{config},
+    _dynamicBatch{dynamicBatch},
+    _needPerfCounters{needPerfCounters},
+    _timeout{std::stoi(config.at(AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT).as<std::string>())} {
+    _taskExecutor.reset();
+    // with a single slot the batch is complete as soon as the request comes, so nothing can time out
+    if (_device.batchForDevice > 1)
+        _timeoutThread = std::thread{&AutoBatchExecutableNetwork::TimeoutLoop, this};
+}
+
+AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _terminate = true;
+    }
+    _cond.notify_all();
+    if (_timeoutThread.joinable())
+        _timeoutThread.join();
+    /* NOTE: The user requests hold the executable network, so none of them is pending at this point
+     *       and the worker requests' destructors wait for the batches which are still running
+     */
+    _workerRequests.clear();
+}
+
+AutoBatchExecutableNetwork::WorkerInferRequest* AutoBatchExecutableNetwork::FindFillingWorkerLocked() {
+    // the batch which is already being filled is completed first, the idle workers are used when it is full
+    WorkerInferRequest* idle = nullptr;
+    for (auto&& worker : _workerRequests) {
+        if (worker->_busy || worker->_slotsTaken == static_cast<size_t>(_device.batchForDevice))
+            continue;
+        if (worker->_slotsTaken > 0)
+            return worker.get();
+        if (idle == nullptr)
+            idle = worker.get();
+    }
+    return idle;
+}
+
+void AutoBatchExecutableNetwork::TakeSlotLocked(WorkerInferRequest& worker, AutoBatchInferRequest* request) {
+    request->_workerRequest = &worker;
+    request->_batchId = static_cast<int>(worker._slotsTaken++);
+}
+
+bool AutoBatchExecutableNetwork::ReadyToStartLocked(const WorkerInferRequest& worker) const {
+    return !worker._busy && worker._pending.size() == static_cast<size_t>(_device.batchForDevice);
+}
+
+void AutoBatchExecutableNetwork::PrepareBatchLocked(WorkerInferRequest& worker) {
+    worker._inFlight.swap(worker._pending);
+    worker._busy = true;
+    worker._timedOut = false;
+    for (auto request : worker._inFlight)
+        request->_completedBy = worker._inferRequest;
+    RecordLaunchLocked(worker._inFlight);
+}
+
+void AutoBatchExecutableNetwork::RecordLaunchLocked(const std::vector<AutoBatchInferRequest*>& requests) {
+    const auto now = std::chrono::steady_clock::now();
+    for (auto request : requests) {
+        const auto latency = std::chrono::duration<double, std::milli>(now - request->_enqueueTime).count();
+        _queueLatencySum += latency;
+        _queueLatencyMax = std::max(_queueLatencyMax, latency);
+    }
+    _queueLatencyCount += requests.size();
+    _batchSizeDistribution[static_cast<unsigned int>(requests.size())]++;
+}
+
+void AutoBatchExecutableNetwork::FillSlot(AutoBatchInferRequest* request) {
+    // the slot is part of the batch even if the copying fails, the request just reports the error on completion
+    try {
+        request->CopyInputsToSlot();
+    } catch (...) {
+        request->_exceptionPtr = std::current_exception();
+    }
+    auto& worker = *request->_workerRequest;
+    bool start = false, notify = false;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        worker._pending.push_back(request);
+        if (ReadyToStartLocked(worker)) {
+            PrepareBatchLocked(worker);
+            start = true;
+        } else {
+            notify = worker._pending.size() == 1 || (worker._timedOut && worker._pending.size() == worker._slotsTaken);
+        }
+    }
+    if (start) {
+        StartBatch(worker);
+    } else if (notify) {
+        _cond.notify_one();
+    }
+}
+
+void AutoBatchExecutableNetwork::StartBatch(WorkerInferRequest& worker) {
+    try {
+        // the partial batch occupies the first slots, with the dynamic batch the rest is not computed,
+        // otherwise the free slots are computed as a padding and their results are ignored
+        if (_dynamicBatch)
+            worker._inferRequest->SetBatch(static_cast<int>(worker._inFlight.size()));
+        worker._inferRequest->StartAsync();
+    } catch (...) {
+        CompleteBatch(worker, std::current_exception());
+    }
+}
+
+void AutoBatchExecutableNetwork::CompleteBatch(WorkerInferRequest& worker, std::exception_ptr exceptionPtr) {
+    for (auto request : worker._inFlight) {
+        if (nullptr == request->_exceptionPtr)
+            request->_exceptionPtr = exceptionPtr;
+        auto capturedTask = std::move(request->_task);
+        capturedTask();
+    }
+    std::vector<AutoBatchInferRequest*> assigned;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        worker._inFlight.clear();
+        worker._busy = false;
+        worker._slotsTaken = 0;
+        // the requests which found all the slots taken are the first to get the freed ones
+        while (!_waiting.empty() && worker._slotsTaken < static_cast<size_t>(_device.batchForDevice)) {
+            TakeSlotLocked(worker, _waiting.front());
+            assigned.push_back(_waiting.front());
+            _waiting.pop_front();
+        }
+    }
+    for (auto request : assigned)
+        FillSlot(request);
+}
+
+void AutoBatchExecutableNetwork::Enqueue(AutoBatchInferRequest* request) {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        request->_enqueueTime = std::chrono::steady_clock::now();
+        request->_exceptionPtr = nullptr;
+        auto worker = FindFillingWorkerLocked();
+        if (worker == nullptr) {
+            _waiting.push_back(request);
+            return;
+        }
+        TakeSlotLocked(*worker, request);
+    }
+    FillSlot(request);
+}
+
+void AutoBatchExecutableNetwork::TimeoutLoop() {
+    std::unique_lock<std::mutex> lock{_mutex};
+    while (!_terminate) {
+        const auto now = std::chrono::steady_clock::now();
+        auto wakeUp = std::chrono::steady_clock::time_point::max();
+        std::vector<WorkerInferRequest*> batches;
+        for (auto&& worker : _workerRequests) {
+            auto& pending = worker->_pending;
+            if (pending.empty())
+                continue;
+            auto oldest = (*std::min_element(pending.begin(), pending.end(),
+                [](const AutoBatchInferRequest* lhs, const AutoBatchInferRequest* rhs) {
+                    return lhs->_enqueueTime < rhs->_enqueueTime;
+                }))->_enqueueTime;
+            if (now - oldest < _timeout) {
+                wakeUp = std::min(wakeUp, oldest + _timeout);
+                continue;
+            }
+            // the slots which are still being filled are started with the batch once they are filled
+            if (pending.size() != worker->_slotsTaken) {
+                worker->_timedOut = true;
+                continue;
+            }
+            PrepareBatchLocked(*worker);
+            batches.push_back(worker.get());
+        }
+        if (!batches.empty()) {
+            lock.unlock();
+            for (auto worker : batches)
+                StartBatch(*worker);
+            lock.lock();
+        } else if (wakeUp == std::chrono::steady_clock::time_point::max()) {
+            _cond.wait(lock);
+        } else {
+            _cond.wait_until(lock, wakeUp);
+        }
+    }
+}
+
+InferenceEngine::IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                                               InferenceEngine::OutputsDataMap networkOutputs) {
+    // every `batch` user requests add a worker, so the started requests never lack the slots for long
+    const auto num = _numRequestsCreated++;
+    const auto batch = static_cast<size_t>(_device.batchForDevice);
+    // the slots are the views of the slices of the batched request's blobs, so the data is copied only once
+    auto makeSlots = [&](const SoIInferRequestInternal& batchedRequest, const std::string& name,
+                         const TensorDesc& desc, std::vector<BlobMap>& slots) {
+        auto batched = batchedRequest->GetBlob(name);
+        if (!batched->is<MemoryBlob>())
+            IE_THROW(NotImplemented) << "BATCH device supports the devices with the host memory blobs only";
+        const auto slotSize = batched->byteSize() / batch;
+        for (size_t slot = 0; slot < batch; ++slot) {
+            slots[slot][name] = make_blob_with_precision(TensorDesc{desc.getPrecision(), desc.getDims(), desc.getLayout()},
+                                                         batched->buffer().as<uint8_t*>() + slot * slotSize);
+        }
+    };
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        while (_workerRequests.size() <= num / batch) {
+            std::unique_ptr<WorkerInferRequest> newWorkerRequest{new WorkerInferRequest};
+            auto* newWorkerRequestPtr = newWorkerRequest.get();
+            newWorkerRequestPtr->_inferRequest = { _batchedNetwork, _batchedNetwork->CreateInferRequest() };
+            newWorkerRequestPtr->_slotInputs.resize(batch);
+            newWorkerRequestPtr->_slotOutputs.resize(batch);
+            for (const auto& it : networkInputs)
+                makeSlots(newWorkerRequestPtr->_inferRequest, it.first, it.second->getTensorDesc(),
+                          newWorkerRequestPtr->_slotInputs);
+            for (const auto& it : networkOutputs)
+                makeSlots(newWorkerRequestPtr->_inferRequest, it.first, it.second->getTensorDesc(),
+                          newWorkerRequestPtr->_slotOutputs);
+            newWorkerRequestPtr->_inferRequest->SetCallback(
+                [newWorkerRequestPtr, this] (std::exception_ptr exceptionPtr) {
+                    CompleteBatch(*newWorkerRequestPtr, exceptionPtr);
+                });
+            _workerRequests.push_back(std::move(newWorkerRequest));
+        }
+    }
+    return std::make_shared<AutoBatchInferRequest>(networkInputs, networkOutputs);
+}
+
+IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequest() {
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    return std::make_shared<AutoBatchAsyncInferRequest>(std::static_pointer_cast<AutoBatchInferRequest>(syncRequestImpl),
+                                                        _needPerfCounters,
+                                                        std::static_pointer_cast<AutoBatchExecutableNetwork>(shared_from_this()),
+                                                        _callbackExecutor);
+}
+
+InferenceEngine::Parameter AutoBatchExecutableNetwork::GetConfig(const std::string &name) const {
+    auto it = _config.find(name);
+    if (it != _config.end()) {
+        return it->second;
+    } else {
+        // the rest of the config is owned by the device
+        return _batchedNetwork->GetConfig(name);
+    }
+}
+
+InferenceEngine::Parameter AutoBatchExecutableNetwork::GetMetric(const std::string &name) const {
+    if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+        unsigned int res = 0u;
+        try {
+            res = _batchedNetwork->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        } catch (const InferenceEngine::Exception &iie) {
+            IE_THROW()
+                << "Every device used with the BATCH device should "
+                << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
+                << "Failed to query the metric for the " << _device.deviceName << " with error:" << iie.what();
+        }
+        // every request of the device serves the whole batch of the user requests
+        res *= _device.batchForDevice;
+        IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, res);
+    } else if (name == METRIC_KEY(NETWORK_NAME)) {
+        IE_SET_METRIC_RETURN(NETWORK_NAME, _batchedNetwork->GetMetric(
+            METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(AUTO_BATCH_SIZE_DISTRIBUTION)) {
+        std::map<unsigned int, uint64_t> distribution;
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            distribution = _batchSizeDistribution;
+        }
+        IE_SET_METRIC_RETURN(AUTO_BATCH_SIZE_DISTRIBUTION, distribution);
+    } else if (name == METRIC_KEY(AUTO_BATCH_QUEUE_LATENCY)) {
+        std::map<std::string, float> latency;
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            latency["AVERAGE"] = _queueLatencyCount == 0 ? 0.f : static_cast<float>(_queueLatencySum / _queueLatencyCount);
+            latency["MAX"] = static_cast<float>(_queueLatencyMax);
+        }
+        IE_SET_METRIC_RETURN(AUTO_BATCH_QUEUE_LATENCY, latency);
+    } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, {
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            METRIC_KEY(SUPPORTED_METRICS),
+            METRIC_KEY(NETWORK_NAME),
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            METRIC_KEY(AUTO_BATCH_SIZE_DISTRIBUTION),
+            METRIC_KEY(AUTO_BATCH_QUEUE_LATENCY)
+        });
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, supported_configKeys);
+    } else {
+        IE_THROW() << "Unsupported Network metric: " << name;
+    }
+}
+
+// ------------------------------AutoBatchInferencePlugin----------------------------
+static const Version version = {{2, 1}, CI_BUILD_NUMBER, "AutoBatchPlugin"};
+IE_DEFINE_PLUGIN_CREATE_FUNCTION(AutoBatchInferencePlugin, version)
+
+AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
+    _pluginName = "BATCH";
+}
+
+DeviceInformation AutoBatchInferencePlugin::ParseMetaDevice(const std::string& deviceWithBatch,
+                                                            const std::map<std::string, std::string>& config) const {
+    auto openingBracket = deviceWithBatch.find_first_of('(');
+    auto closingBracket = deviceWithBatch.find_first_of(')', openingBracket);
+    auto deviceName = deviceWithBatch.substr(0, openingBracket);
+
+    int batch = defaultBatchSize;
+    if (closingBracket != std::string::npos && openingBracket < closingBracket) {
+        batch = std::stol(deviceWithBatch.substr(openingBracket + 1, closingBracket - openingBracket - 1));
+
+        if (batch <= 0) {
+            IE_THROW() << "Batch value for '" << deviceName << "' must be > 0, while " << batch
+                << " is passed";
+        }
+    }
+
+    // the device gets the settings it supports only
+    DeviceIDParser deviceParser(deviceName);
+    std::vector<std::string> supportedConfigKeys =
+        GetCore()->GetMetric(deviceParser.getDeviceName(), METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    std::map<std::string, std::string> deviceConfig;
+    for (auto&& kvp : mergeConfigs(_config, config)) {
+        if (std::find(supportedConfigKeys.begin(), supportedConfigKeys.end(), kvp.first) != supportedConfigKeys.end())
+            deviceConfig.insert(kvp);
+    }
+    return { deviceName, deviceConfig, batch };
+}
+
+InferenceEngine::Parameter AutoBatchInferencePlugin::GetConfig(const std::string& name,
+        const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), name)) {
+        auto it = _config.find(name);
+        if (it == _config.end()) {
+            IE_THROW() << "Value for " << name << " is not set";
+        } else {
+            return { it->second };
+        }
+    } else {
+        IE_THROW() << "Unsupported config key: " << name;
+    }
+}
+
+void AutoBatchInferencePlugin::SetConfig(const std::map<std::string, std::string> & config) {
+    for (auto && kvp : config) {
+        const auto& name = kvp.first;
+        if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), name))
+            _config[name] = kvp.second;
+        else
+            IE_THROW() << "Unsupported config key: " << name;
+    }
+}
+
+InferenceEngine::Parameter AutoBatchInferencePlugin::GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        std::vector<std::string> metrics;
+        metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
+        metrics.push_back(METRIC_KEY(FULL_DEVICE_NAME));
+        metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
+    } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
+        std::string device_name = { "BATCH" };
+        IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, device_name);
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, supported_configKeys);
+    } else {
+        IE_THROW() << "Unsupported metric key " << name;
+    }
+}
+
+IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadExeNetworkImpl(const CNNNetwork& network,
+                                                                             const std::map<std::string, std::string>& config) {
+    if (GetCore() == nullptr) {
+        IE_THROW() << "Please, work with BATCH device via InferenceEngine::Core object";
+    }
+
+    if (network.getFunction() == nullptr) {
+        IE_THROW() << "BATCH device supports just ngraph network representation";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto device = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE);
+    if (device == fullConfig.end()) {
+        IE_THROW() << "KEY_AUTO_BATCH_DEVICE key is not set for BATCH device";
+    }
+    auto timeout = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT);
+    std::string timeoutValue = timeout == fullConfig.end() ? defaultTimeout : timeout->second;
+    try {
+        if (std::stoi(timeoutValue) < 0)
+            throw std::out_of_range{timeoutValue};
+    } catch (const std::exception&) {
+        IE_THROW() << "Wrong value " << timeoutValue << " for property key "
+                   << AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT << ". Expected non-negative number of milliseconds";
+    }
+    std::unordered_map<std::string, InferenceEngine::Parameter> networkConfig = {
+        {AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE, device->second},
+        {AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT, timeoutValue}
+    };
+
+    auto metaDevice = ParseMetaDevice(device->second, fullConfig);
+    const auto& deviceName = metaDevice.deviceName;
+    const auto& deviceConfig = metaDevice.config;
+
+    auto batchedNetwork = details::cloneNetwork(network);
+    if (metaDevice.batchForDevice > 1 && !reshapeToBatch(batchedNetwork, metaDevice.batchForDevice)) {
+        // every request is executed alone, but still via the BATCH device to keep the behavior uniform
+        metaDevice.batchForDevice = 1;
+    }
+
+    SoExecutableNetworkInternal batchedExecNetwork;
+    bool dynamicBatch = false;
+    if (metaDevice.batchForDevice > 1) {
+        // the dynamic batch allows to execute the partial batch for the cost of its actual size
+        std::vector<std::string> supportedConfigKeys =
+            GetCore()->GetMetric(DeviceIDParser(deviceName).getDeviceName(), METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        if (std::find(supportedConfigKeys.begin(), supportedConfigKeys.end(), CONFIG_KEY(DYN_BATCH_ENABLED)) !=
+            supportedConfigKeys.end()) {
+            auto dynamicBatchConfig = deviceConfig;
+            dynamicBatchConfig[CONFIG_KEY(DYN_BATCH_ENABLED)] = CONFIG_VALUE(YES);
+            try {
+                batchedExecNetwork = GetCore()->LoadNetwork(batchedNetwork, deviceName, dynamicBatchConfig);
+                dynamicBatch = true;
+            } catch (const Exception&) {
+            }
+        }
+        if (!dynamicBatch)
+            batchedExecNetwork = GetCore()->LoadNetwork(batchedNetwork, deviceName, deviceConfig);
+    } else {
+        batchedExecNetwork = GetCore()->LoadNetwork(network, deviceName, deviceConfig);
+    }
+
+    bool enablePerfCounters = false;
+    try {
+        enablePerfCounters =
+            batchedExecNetwork->GetConfig(PluginConfigParams::KEY_PERF_COUNT).as<std::string>() == PluginConfigParams::YES;
+    } catch (...) {
+    }
+    return std::make_shared<AutoBatchExecutableNetwork>(batchedExecNetwork,
+                                                        metaDevice,
+                                                        networkConfig,
+                                                        dynamicBatch,
+                                                        enablePerfCounters);
+}
+
+QueryNetworkResult AutoBatchInferencePlugin::QueryNetwork(const CNNNetwork&                         network,
+                                                          const std::map<std::string, std::string>& config) const {
+    if (GetCore() == nullptr) {
+        IE_THROW() << "Please, work with BATCH device via InferencEngine::Core object";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto device = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE);
+    if (device == fullConfig.end()) {
+        IE_THROW() << "KEY_AUTO_BATCH_DEVICE key is not set for BATCH device";
+    }
+    auto metaDevice = ParseMetaDevice(device->second, fullConfig);
+    return GetCore()->QueryNetwork(network, metaDevice.deviceName, metaDevice.config);
+}
+
+}  // namespace AutoBatchPlugin
@@ -0,0 +1,165 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
+
+namespace AutoBatchPlugin {
+
+struct DeviceInformation {
+    std::string deviceName;
+    std::map<std::string, std::string> config;
+    int batchForDevice;
+};
+
+class AutoBatchInferRequest;
+
+class AutoBatchExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchExecutableNetwork>;
+    /**
+     * @brief Request of the batched network shared by the `batchSize` user requests, a started user request takes
+     * the next free slot (a slice along the batch dimension) of the worker's input and output blobs
+     */
+    struct WorkerInferRequest {
+        InferenceEngine::SoIInferRequestInternal   _inferRequest;
+        std::vector<InferenceEngine::BlobMap>      _slotInputs;
+        std::vector<InferenceEngine::BlobMap>      _slotOutputs;
+        // the slots are taken in order, so the requests collected for the batch always occupy its first slots
+        size_t                                     _slotsTaken = 0;
+        std::vector<AutoBatchInferRequest*>        _pending;
+        std::vector<AutoBatchInferRequest*>        _inFlight;
+        bool                                       _busy = false;
+        // the batch timed out while some of its slots were still being filled
+        bool                                       _timedOut = false;
+    };
+
+    explicit AutoBatchExecutableNetwork(const InferenceEngine::SoExecutableNetworkInternal&  batchedNetwork,
+                                        const DeviceInformation&                             device,
+                                        const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
+                                        const bool                                           dynamicBatch,
+                                        const bool                                           needPerfCounters = false);
+
+    InferenceEngine::Parameter GetConfig(const std::string& name) const override;
+    InferenceEngine::Parameter GetMetric(const std::string& name) const override;
+    InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
+    InferenceEngine::IInferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                       InferenceEngine::OutputsDataMap networkOutputs) override;
+    ~AutoBatchExecutableNetwork();
+
+    // puts the request to the next free slot of the batch being filled, the batch is started once all the slots are filled
+    void Enqueue(AutoBatchInferRequest* request);
+
+protected:
+    // the methods with the "Locked" suffix expect the _mutex to be held
+    WorkerInferRequest* FindFillingWorkerLocked();
+    void TakeSlotLocked(WorkerInferRequest& worker, AutoBatchInferRequest* request);
+    bool ReadyToStartLocked(const WorkerInferRequest& worker) const;
+    void PrepareBatchLocked(WorkerInferRequest& worker);
+    void RecordLaunchLocked(const std::vector<AutoBatchInferRequest*>& requests);
+    void FillSlot(AutoBatchInferRequest* request);
+    void StartBatch(WorkerInferRequest& worker);
+    void CompleteBatch(WorkerInferRequest& worker, std::exception_ptr exceptionPtr);
+    void TimeoutLoop();
+
+    InferenceEngine::SoExecutableNetworkInternal                _batchedNetwork;
+    DeviceInformation                                           _device;
+    std::unordered_map<std::string, InferenceEngine::Parameter> _config;
+    const bool                                                  _dynamicBatch;
+    const bool                                                  _needPerfCounters;
+    const std::chrono::milliseconds                             _timeout;
+
+    mutable std::mutex                                          _mutex;
+    std::condition_variable                                     _cond;
+    bool                                                        _terminate = false;
+    std::vector<std::unique_ptr<WorkerInferRequest>>            _workerRequests;
+    // the requests which found all the slots taken wait for a worker to complete its batch
+    std::deque<AutoBatchInferRequest*>                          _waiting;
+    std::atomic_size_t                                          _numRequestsCreated = {0};
+    std::thread                                                 _timeoutThread;
+
+    std::map<unsigned int, uint64_t>                            _batchSizeDistribution;
+    double                                                      _queueLatencySum = 0.0;
+    double                                                      _queueLatencyMax = 0.0;
+    uint64_t                                                    _queueLatencyCount = 0;
+};
+
+class AutoBatchInferRequest : public InferenceEngine::IInferRequestInternal {
+public:
+    using Ptr = std::shared_ptr<AutoBatchInferRequest>;
+    explicit AutoBatchInferRequest(const InferenceEngine::InputsDataMap&                  networkInputs,
+                                   const InferenceEngine::OutputsDataMap&                 networkOutputs);
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
+    void InferImpl() override;
+
+    // fills the slot taken by the request with its inputs, the preprocessing writes to the slot directly
+    void CopyInputsToSlot();
+    // copies the results from the slot taken by the request to its output blobs
+    void CopyOutputsFromSlot();
+
+    AutoBatchExecutableNetwork::WorkerInferRequest*     _workerRequest = nullptr;
+    int                                                 _batchId = -1;
+    InferenceEngine::Task                               _task;
+    std::exception_ptr                                  _exceptionPtr = nullptr;
+    std::chrono::steady_clock::time_point               _enqueueTime;
+    InferenceEngine::SoIInferRequestInternal            _completedBy;
+};
+
+class AutoBatchAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchAsyncInferRequest>;
+
+    explicit AutoBatchAsyncInferRequest(const AutoBatchInferRequest::Ptr&           inferRequest,
+                                        const bool                                  needPerfCounters,
+                                        const AutoBatchExecutableNetwork::Ptr&      autoBatchExecutableNetwork,
+                                        const InferenceEngine::ITaskExecutor::Ptr&  callbackExecutor);
+    void Infer_ThreadUnsafe() override;
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
+    ~AutoBatchAsyncInferRequest();
+
+protected:
+    AutoBatchExecutableNetwork::Ptr                                     _autoBatchExecutableNetwork;
+    AutoBatchInferRequest::Ptr                                          _inferRequest;
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>  _perfMap;
+    bool                                                                _needPerfCounters = false;
+};
+
+class AutoBatchInferencePlugin : public InferenceEngine::IInferencePlugin {
+public:
+    AutoBatchInferencePlugin();
+    ~AutoBatchInferencePlugin() = default;
+
+    InferenceEngine::IExecutableNetworkInternal::Ptr LoadExeNetworkImpl(const InferenceEngine::CNNNetwork&        network,
+                                                                       const std::map<std::string, std::string>& config) override;
+
+    void SetConfig(const std::map<std::string, std::string>& config) override;
+    InferenceEngine::Parameter GetConfig(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter>& options) const override;
+    InferenceEngine::QueryNetworkResult QueryNetwork(const InferenceEngine::CNNNetwork&        network,
+                                                     const std::map<std::string, std::string>& config) const override;
+    InferenceEngine::Parameter GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter>& options) const override;
+
+    DeviceInformation ParseMetaDevice(const std::string& deviceWithBatch,
+                                      const std::map<std::string, std::string>& config) const;
+};
+
+}  // namespace AutoBatchPlugin
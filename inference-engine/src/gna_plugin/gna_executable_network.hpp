@@ -22,12 +22,8 @@ class GNAExecutableNetwork : public InferenceEngine::IExecutableNetworkInternal
  public:
      GNAExecutableNetwork(const std::string& aotFileName, std::shared_ptr<GNAPlugin> plg)
          : plg(plg) {
-         std::fstream inputStream(aotFileName, std::ios_base::in | std::ios_base::binary);
-         if (inputStream.fail()) {
-             THROW_GNA_EXCEPTION << "Cannot open file to import model: " << aotFileName;
-         }
-
-         plg->ImportNetwork(inputStream);
+         auto model = ModelBuffer::FromFile(aotFileName);
+         plg->ImportNetwork(model);
          _networkInputs = plg->GetInputs();
          _networkOutputs = plg->GetOutputs();
      }
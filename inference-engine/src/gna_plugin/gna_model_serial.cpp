@@ -37,18 +37,18 @@ inline void writeBits(const T & obj, std::ostream & os) {
 }
 
 template <class T>
-inline void readBits(T & obj, std::istream & is) {
-    is.read(reinterpret_cast<char *>(&obj), sizeof(T));
+inline void readBits(T & obj, ModelBuffer & buffer) {
+    buffer.Read(&obj, sizeof(T));
 }
 
-inline void readNBytes(void * ptr, uint32_t size, std::istream & is) {
-    is.read(reinterpret_cast<char *>(ptr), size);
+inline void readNBytes(void * ptr, uint32_t size, ModelBuffer & buffer) {
+    buffer.Read(ptr, size);
 }
 
 template <int nBits, class T>
-inline void readNBits(T & obj, std::istream & is) {
+inline void readNBits(T & obj, ModelBuffer & buffer) {
     std::array<uint8_t, nBits / 8> tmp;
-    is.read(reinterpret_cast<char *>(&tmp), nBits / 8);
+    buffer.Read(&tmp, nBits / 8);
 
     obj = * reinterpret_cast<T*>(&tmp.front());
 }
@@ -58,9 +58,9 @@ inline void * offsetToPointer(void * const base, uint64_t offset) {
 }
 
 template <class T>
-inline void readOffset(T & ptr, void *base,  std::istream & is) {
+inline void readOffset(T & ptr, void *base,  ModelBuffer & buffer) {
     uint64_t offset = 0ull;
-    readBits(offset, is);
+    readBits(offset, buffer);
     ptr = reinterpret_cast<T>(offsetToPointer(base, offset));
 }
 
@@ -76,18 +76,15 @@ bool is_little_endian() {
 const int gna_header_magic = is_little_endian() ?  0x4d414e47 : 0x474e414d;
 
 GNAPluginNS::HeaderLatest::ModelHeader GNAModelSerial::ReadHeader(std::istream &is) {
-    is.exceptions(std::istream::failbit);
-    auto startPos = is.tellg();
-    if (startPos == -1) {
-        THROW_GNA_EXCEPTION << "Can't open stream to import";
-    }
-    is.seekg(0, is.end);
-    auto stream_len = is.tellg();
-    if (stream_len == -1) {
-        THROW_GNA_EXCEPTION << "Can't open file to import";
-    }
-    stream_len -= startPos;
-    is.seekg(startPos, is.beg);
+    auto buffer = ModelBuffer::FromStream(is);
+    auto header = ReadHeader(buffer);
+    is.seekg(buffer.Position(), std::ios_base::cur);
+    return header;
+}
+
+GNAPluginNS::HeaderLatest::ModelHeader GNAModelSerial::ReadHeader(ModelBuffer &buffer) {
+    const auto startPos = buffer.Position();
+    const auto stream_len = buffer.Remaining();
 
     HeaderLatest::ModelHeader header;
     header.version.major = 0u;
@@ -95,9 +92,9 @@ GNAPluginNS::HeaderLatest::ModelHeader GNAModelSerial::ReadHeader(std::istream &
     auto size_of_headers_header = sizeof(HeaderLatest::ModelHeader::gnam) + sizeof(HeaderLatest::ModelHeader::headerSize)
                                 + sizeof(HeaderLatest::ModelHeader::Version);
     if (stream_len > size_of_headers_header) {
-        readNBytes(&header, size_of_headers_header, is);
+        readNBytes(&header, size_of_headers_header, buffer);
     } else {
-        readNBytes(&header, stream_len, is);
+        readNBytes(&header, stream_len, buffer);
     }
     if (*reinterpret_cast<int*>(header.gnam) != gna_header_magic) {
         THROW_GNA_EXCEPTION << "Imported file unsupported: magic number should be GNAM(0x474e414d), but was 0x"
@@ -108,34 +105,34 @@ GNAPluginNS::HeaderLatest::ModelHeader GNAModelSerial::ReadHeader(std::istream &
                            std::hex << std::setw(2) << static_cast<short>(header.gnam[3]);
     }
 
-    is.seekg(startPos, is.beg);
+    buffer.Seek(startPos);
     Header2dot1::ModelHeader tempHeader2dot1;
     switch (header.version.major) {
         case 2:
             switch (header.version.minor) {
                 case 1:
-                    readBits(tempHeader2dot1, is);
+                    readBits(tempHeader2dot1, buffer);
                     header = HeaderLatest::ModelHeader(tempHeader2dot1);
                     break;
                 case 2:
                 case 3:
                 {
                     Header2dot3::ModelHeader tempHeader2dot3;
-                    readBits(tempHeader2dot3, is);
+                    readBits(tempHeader2dot3, buffer);
                     header = HeaderLatest::ModelHeader(tempHeader2dot3);
                     break;
                 }
                 case 4:
                 {
                     Header2dot4::ModelHeader tempHeader2dot4;
-                    readBits(tempHeader2dot4, is);
+                    readBits(tempHeader2dot4, buffer);
                     header = HeaderLatest::ModelHeader(tempHeader2dot4);
                     break;
                 }
                 case 5:
                 case 6:
                 case 7:
-                    readNBytes(&header, sizeof(HeaderLatest::ModelHeader), is);
+                    readNBytes(&header, sizeof(HeaderLatest::ModelHeader), buffer);
                     break;
                 default:
                     THROW_GNA_EXCEPTION << "Imported file unsupported. minor version should have values in range 1 to 7 and is: " << header.version.minor;
@@ -151,14 +148,12 @@ GNAPluginNS::HeaderLatest::ModelHeader GNAModelSerial::ReadHeader(std::istream &
 
     //  forward compatible
     if (header.headerSize > sizeof(header)) {
-        is.seekg(header.headerSize - sizeof(header), std::ios_base::cur);
+        buffer.Skip(header.headerSize - sizeof(header));
     }
     return header;
 }
 
-GNAPluginNS::HeaderLatest::RuntimeEndPoint GNAModelSerial::ReadEndPoint(std::istream &is) {
-    is.exceptions(std::istream::failbit);
-
+GNAPluginNS::HeaderLatest::RuntimeEndPoint GNAModelSerial::ReadEndPoint(ModelBuffer &buffer) {
     HeaderLatest::RuntimeEndPoint endPoint;
     switch (modelHeader.version.major) {
         case 2:
@@ -171,12 +166,12 @@ GNAPluginNS::HeaderLatest::RuntimeEndPoint GNAModelSerial::ReadEndPoint(std::ist
                 case 6:
                 {
                     Header2dot6::RuntimeEndPoint tempEndPoint2dot6;
-                    readBits(tempEndPoint2dot6, is);
+                    readBits(tempEndPoint2dot6, buffer);
                     endPoint = HeaderLatest::RuntimeEndPoint(tempEndPoint2dot6, modelHeader.nGroup);
                     break;
                 }
                 case 7:
-                    readNBytes(&endPoint, sizeof(HeaderLatest::RuntimeEndPoint), is);
+                    readNBytes(&endPoint, sizeof(HeaderLatest::RuntimeEndPoint), buffer);
                     break;
                 default:
                     THROW_GNA_EXCEPTION << "Imported file unsupported. minor version should have values in range 1 to 7 and is: " << modelHeader.version.minor;
@@ -218,22 +213,21 @@ const std::map<Gna2OperationType, std::vector<uint32_t>> GnaParamSize{
 
 void GNAModelSerial::Import(void *basePointer,
         size_t gnaGraphSize,
-        std::istream & is,
+        ModelBuffer & buffer,
         std::shared_ptr<GNAPluginNS::InputDesc> inputsDesc,
         std::vector<GNAPluginNS::OutputDesc> &desc,
         InferenceEngine::InputsDataMap& inputsDataMap,
         InferenceEngine::OutputsDataMap& outputsDataMap,
         TranspositionInfoMap& inputsTranspositionInfo,
         TranspositionInfoMap& outputsTranspositionInfo) {
-    is.exceptions(std::istream::failbit);
 
     if (modelHeader.version.major == 2) {
         if (modelHeader.version.minor >= 3) {
             for (auto inputIndex = 0; inputIndex < modelHeader.nInputs; inputIndex++) {
                 uint32_t nameSize = 0;
-                readNBits<32>(nameSize, is);
+                readNBits<32>(nameSize, buffer);
                 std::string inName(nameSize, '\0');
-                readNBytes(&inName[0], nameSize, is);
+                readNBytes(&inName[0], nameSize, buffer);
                 inputNames.push_back(inName.substr(0, nameSize - 1));
             }
         }
@@ -241,40 +235,40 @@ void GNAModelSerial::Import(void *basePointer,
             for (int inputIx = 0; inputIx < modelHeader.nTransposeInputs; ++inputIx) {
                 std::string inputName;
                 std::vector<TranspositionInfo> transpositionInfo;
-                ImportTranspositionInfo(is, inputName, transpositionInfo);
+                ImportTranspositionInfo(buffer, inputName, transpositionInfo);
                 inputsTranspositionInfo[inputName] = transpositionInfo;
             }
             for (int outputIx = 0; outputIx < modelHeader.nTransposeOutputs; ++outputIx) {
                 std::string outputName;
                 std::vector<TranspositionInfo> transpositionInfo;
-                ImportTranspositionInfo(is, outputName, transpositionInfo);
+                ImportTranspositionInfo(buffer, outputName, transpositionInfo);
                 outputsTranspositionInfo[outputName] = transpositionInfo;
             }
         }
     }
-    ImportInputs(is, basePointer, inputsDesc, inputsDataMap);
+    ImportInputs(buffer, basePointer, inputsDesc, inputsDataMap);
 
     if (modelHeader.version.major == 2) {
         if (modelHeader.version.minor >= 3) {
             for (auto inputIndex = 0; inputIndex < modelHeader.nOutputs; inputIndex++) {
                 uint32_t nameSize = 0;
-                readNBits<32>(nameSize, is);
+                readNBits<32>(nameSize, buffer);
                 std::string outName(nameSize, '\0');
-                readNBytes(&outName[0], nameSize, is);
+                readNBytes(&outName[0], nameSize, buffer);
                 outputNames.push_back(outName.substr(0, nameSize - 1));
             }
         }
     }
-    ImportOutputs(is, basePointer, desc, outputsDataMap);
+    ImportOutputs(buffer, basePointer, desc, outputsDataMap);
 
     for (auto operation = gna2Model->Operations; operation != gna2Model->Operations + gna2Model->NumberOfOperations; ++operation) {
-        readNBits<32>(operation->Type, is);
-        readBits(operation->NumberOfOperands, is);
+        readNBits<32>(operation->Type, buffer);
+        readBits(operation->NumberOfOperands, buffer);
         operation->Operands = static_cast<Gna2Tensor const **>(gnaUserAllocator(sizeof(Gna2Tensor*) * operation->NumberOfOperands));
         IE_ASSERT(operation->Operands != nullptr);
         for (uint32_t i = 0; i < operation->NumberOfOperands; i++) {
             Gna2Tensor t{};
-            readBits(t, is);
+            readBits(t, buffer);
             if (IsEmptyTensor(t)) {
                 operation->Operands[i] = nullptr;
             } else {
@@ -283,7 +277,7 @@ void GNAModelSerial::Import(void *basePointer,
                 const_cast<Gna2Tensor&>(*operation->Operands[i]) = t;
             }
         }
-        readBits(operation->NumberOfParameters, is);
+        readBits(operation->NumberOfParameters, buffer);
         switch (operation->Type) {
         case Gna2OperationTypeElementWiseAffine:
         case Gna2OperationTypeFullyConnectedAffine:
@@ -302,7 +296,7 @@ void GNAModelSerial::Import(void *basePointer,
             operation->Parameters = nullptr;
         for (uint32_t i = 0; i < operation->NumberOfParameters; i++) {
             uint32_t paramSize = 0;
-            readBits(paramSize, is);
+            readBits(paramSize, buffer);
             IE_ASSERT(operation->Parameters != nullptr);
             if (paramSize == 0) {
                 IE_ASSERT(operation->Parameters != nullptr);
@@ -310,7 +304,7 @@ void GNAModelSerial::Import(void *basePointer,
                 continue;
             }
             operation->Parameters[i] = gnaUserAllocator(paramSize);
-            readNBytes(operation->Parameters[i], paramSize, is);
+            readNBytes(operation->Parameters[i], paramSize, buffer);
 
             if (GnaParamSize.at(operation->Type).size() <= i) {
                 THROW_GNA_EXCEPTION << "Cannot import parameter of index: " << i;
@@ -323,7 +317,7 @@ void GNAModelSerial::Import(void *basePointer,
 
     // writing memory information
     uint32_t nStates = 0;
-    readBits(nStates, is);
+    readBits(nStates, buffer);
     if (pstates != nullptr) {
         pstates->resize(nStates);
     }
@@ -332,22 +326,22 @@ void GNAModelSerial::Import(void *basePointer,
         void *pSegment;
         if ( modelHeader.version.major == 2 ) {
             if ( modelHeader.version.minor < 6 ) {
-                readOffset(pSegment, basePointer, is);
+                readOffset(pSegment, basePointer, buffer);
                 uint32_t segmentSz = 0;
-                readBits(segmentSz, is);
+                readBits(segmentSz, buffer);
                 if (pstates) {
                     (*pstates)[i] = std::make_tuple( pSegment, segmentSz, "noname", 1.0f );
                 }
             } else {
-                readOffset(pSegment, basePointer, is);
+                readOffset(pSegment, basePointer, buffer);
                 uint32_t segmentSz = 0;
-                readBits(segmentSz, is);
+                readBits(segmentSz, buffer);
                 uint32_t nameSize = 0;
-                readNBits<32>(nameSize, is);
+                readNBits<32>(nameSize, buffer);
                 std::string inName(nameSize, '\0');
-                readNBytes(&inName[0], nameSize, is);
+                readNBytes(&inName[0], nameSize, buffer);
                 float scale_factor = 1.0f;
-                readBits(scale_factor, is);
+                readBits(scale_factor, buffer);
                 if (pstates) {
                     (*pstates)[i] = std::make_tuple( pSegment, segmentSz, inName.substr(0, nameSize - 1), scale_factor);
                 }
@@ -356,8 +350,8 @@ void GNAModelSerial::Import(void *basePointer,
     }
 
 
-    // once structure has been read lets read whole gna graph
-    is.read(reinterpret_cast<char*>(basePointer), gnaGraphSize);
+    // once structure has been read lets copy whole gna graph
+    buffer.Read(basePointer, gnaGraphSize);
 }
 
 void GNAModelSerial::Export(void * basePointer, size_t gnaGraphSize, std::ostream & os) const {
@@ -501,52 +495,51 @@ void GNAModelSerial::Export(void * basePointer, size_t gnaGraphSize, std::ostrea
 
 void GNAModelSerial::Import(void *basePointer,
         size_t gnaGraphSize,
-        std::istream & is,
+        ModelBuffer & buffer,
         std::shared_ptr<GNAPluginNS::InputDesc> inputsDesc,
         std::vector<GNAPluginNS::OutputDesc> &desc,
         InferenceEngine::InputsDataMap& inputsDataMap,
         InferenceEngine::OutputsDataMap& outputsDataMap,
         TranspositionInfoMap& inputsTranspositionInfo,
         TranspositionInfoMap& outputsTranspositionInfo) {
-    is.exceptions(std::istream::failbit);
 
     if (modelHeader.version.major == 2) {
         if (modelHeader.version.minor >= 5) {
             for (int inputIx = 0; inputIx < modelHeader.nTransposeInputs; ++inputIx) {
                 std::string inputName;
                 std::vector<TranspositionInfo> transpositionInfo;
-                ImportTranspositionInfo(is, inputName, transpositionInfo);
+                ImportTranspositionInfo(buffer, inputName, transpositionInfo);
                 inputsTranspositionInfo[inputName] = transpositionInfo;
             }
             for (int outputIx = 0; outputIx < modelHeader.nTransposeOutputs; ++outputIx) {
                 std::string outputName;
                 std::vector<TranspositionInfo> transpositionInfo;
-                ImportTranspositionInfo(is, outputName, transpositionInfo);
+                ImportTranspositionInfo(buffer, outputName, transpositionInfo);
                 outputsTranspositionInfo[outputName] = transpositionInfo;
             }
         }
     }
-    ImportInputs(is, basePointer, inputsDesc, inputsDataMap);
-    ImportOutputs(is, basePointer, desc, outputsDataMap);
+    ImportInputs(buffer, basePointer, inputsDesc, inputsDataMap);
+    ImportOutputs(buffer, basePointer, desc, outputsDataMap);
 
-    auto readPwl = [&is, basePointer](intel_pwl_func_t & value) {
-        readBits(value.nSegments, is);
+    auto readPwl = [&buffer, basePointer](intel_pwl_func_t & value) {
+        readBits(value.nSegments, buffer);
         if (value.nSegments != 0) {
-            readOffset(value.pSegments, basePointer, is);
+            readOffset(value.pSegments, basePointer, buffer);
         } else {
             value.pSegments = nullptr;
         }
     };
 
     for (auto layer = ptr_nnet->pLayers; layer != ptr_nnet->pLayers + ptr_nnet->nLayers; ++layer) {
-        readBits(layer->nInputColumns, is);
-        readBits(layer->nInputRows, is);
-        readBits(layer->nOutputColumns, is);
-        readBits(layer->nOutputRows, is);
-        readBits(layer->nBytesPerInput, is);
-        readBits(layer->nBytesPerOutput, is);
-        readBits(layer->nBytesPerIntermediateOutput, is);
-        readNBits<32>(layer->nLayerKind, is);
+        readBits(layer->nInputColumns, buffer);
+        readBits(layer->nInputRows, buffer);
+        readBits(layer->nOutputColumns, buffer);
+        readBits(layer->nOutputRows, buffer);
+        readBits(layer->nBytesPerInput, buffer);
+        readBits(layer->nBytesPerOutput, buffer);
+        readBits(layer->nBytesPerIntermediateOutput, buffer);
+        readNBits<32>(layer->nLayerKind, buffer);
 
         // reading layers structs
         switch (layer->nLayerKind) {
@@ -558,10 +551,10 @@ void GNAModelSerial::Import(void *basePointer,
             }
 
             auto &affine = *reinterpret_cast<intel_affine_layer_t *>(layer->pLayerStruct);
-            readBits(affine.affine.nBytesPerWeight, is);
-            readBits(affine.affine.nBytesPerBias, is);
-            readOffset(affine.affine.pWeights, basePointer, is);
-            readOffset(affine.affine.pBiases, basePointer, is);
+            readBits(affine.affine.nBytesPerWeight, buffer);
+            readBits(affine.affine.nBytesPerBias, buffer);
+            readOffset(affine.affine.pWeights, basePointer, buffer);
+            readOffset(affine.affine.pBiases, basePointer, buffer);
             readPwl(affine.pwl);
             break;
         }
@@ -572,19 +565,19 @@ void GNAModelSerial::Import(void *basePointer,
             }
 
             auto &convolution = *reinterpret_cast<intel_convolutional_layer_t *>(layer->pLayerStruct);
-            readBits(convolution.nFilterCoefficients, is);
-            readBits(convolution.nBytesFilterCoefficient, is);
-            readBits(convolution.nBytesBias, is);
-            readBits(convolution.nFilters, is);
-            readBits(convolution.nFeatureMaps, is);
-            readBits(convolution.nFeatureMapRows, is);
-            readBits(convolution.nFeatureMapColumns, is);
-            readBits(convolution.nFilterRows, is);
-            readOffset(convolution.pFilters, basePointer, is);
-            readOffset(convolution.pBiases, basePointer, is);
-            readBits(convolution.nPoolSize, is);
-            readBits(convolution.nPoolStride, is);
-            readBits(convolution.poolType, is);
+            readBits(convolution.nFilterCoefficients, buffer);
+            readBits(convolution.nBytesFilterCoefficient, buffer);
+            readBits(convolution.nBytesBias, buffer);
+            readBits(convolution.nFilters, buffer);
+            readBits(convolution.nFeatureMaps, buffer);
+            readBits(convolution.nFeatureMapRows, buffer);
+            readBits(convolution.nFeatureMapColumns, buffer);
+            readBits(convolution.nFilterRows, buffer);
+            readOffset(convolution.pFilters, basePointer, buffer);
+            readOffset(convolution.pBiases, basePointer, buffer);
+            readBits(convolution.nPoolSize, buffer);
+            readBits(convolution.nPoolStride, buffer);
+            readBits(convolution.poolType, buffer);
             readPwl(convolution.pwl);
             break;
         }
@@ -596,8 +589,8 @@ void GNAModelSerial::Import(void *basePointer,
             }
 
             auto &copy = *reinterpret_cast<intel_copy_layer_t *>(layer->pLayerStruct);
-            readBits(copy.nCopyRows, is);
-            readBits(copy.nCopyCols, is);
+            readBits(copy.nCopyRows, buffer);
+            readBits(copy.nCopyCols, buffer);
             break;
         }
 
@@ -612,18 +605,18 @@ void GNAModelSerial::Import(void *basePointer,
         }
 
         // reading offsets of inputs/outputs
-        readOffset(layer->pInputs, basePointer, is);
+        readOffset(layer->pInputs, basePointer, buffer);
         if (layer->nLayerKind == INTEL_COPY) {
             layer->pOutputsIntermediate = nullptr;
         } else {
-            readOffset(layer->pOutputsIntermediate, basePointer, is);
+            readOffset(layer->pOutputsIntermediate, basePointer, buffer);
         }
-        readOffset(layer->pOutputs, basePointer, is);
+        readOffset(layer->pOutputs, basePointer, buffer);
     }
 
     // writing memory information
     uint32_t nStates = 0;
-    readBits(nStates, is);
+    readBits(nStates, buffer);
     if (pstates != nullptr) {
         pstates->resize(nStates);
     }
@@ -632,22 +625,22 @@ void GNAModelSerial::Import(void *basePointer,
         void *pSegment;
         if ( modelHeader.version.major == 2 ) {
             if ( modelHeader.version.minor < 6 ) {
-                readOffset(pSegment, basePointer, is);
+                readOffset(pSegment, basePointer, buffer);
                 uint32_t segmentSz = 0;
-                readBits(segmentSz, is);
+                readBits(segmentSz, buffer);
                 if (pstates) {
                     (*pstates)[i] = std::make_tuple( pSegment, segmentSz, "noname", 1.0f);
                 }
             } else {
-                readOffset(pSegment, basePointer, is);
+                readOffset(pSegment, basePointer, buffer);
                 uint32_t segmentSz = 0;
-                readBits(segmentSz, is);
+                readBits(segmentSz, buffer);
                 uint32_t nameSize = 0;
-                readNBits<32>(nameSize, is);
+                readNBits<32>(nameSize, buffer);
                 std::string inName(nameSize, '\0');
-                readNBytes(&inName[0], nameSize, is);
+                readNBytes(&inName[0], nameSize, buffer);
                 float scale_factor = 1.0f;
-                readBits(scale_factor, is);
+                readBits(scale_factor, buffer);
                 if (pstates) {
                     (*pstates)[i] = std::make_tuple( pSegment, segmentSz, inName.substr(0, nameSize - 1), scale_factor );
                 }
@@ -656,8 +649,8 @@ void GNAModelSerial::Import(void *basePointer,
     }
 
 
-    // once structure has been read lets read whole gna graph
-    is.read(reinterpret_cast<char*>(basePointer), gnaGraphSize);
+    // once structure has been read lets copy whole gna graph
+    buffer.Read(basePointer, gnaGraphSize);
 }
 
 /**
@@ -881,7 +874,7 @@ std::vector<HeaderLatest::RuntimeEndPoint> GNAModelSerial::serializeInputs(const
     return endPoints;
 }
 
-void GNAModelSerial::ImportInputs(std::istream &is,
+void GNAModelSerial::ImportInputs(ModelBuffer &buffer,
         void* basePtr,
         std::shared_ptr<GNAPluginNS::InputDesc> inputsDesc,
         InferenceEngine::InputsDataMap& dataMap) {
@@ -891,7 +884,7 @@ void GNAModelSerial::ImportInputs(std::istream &is,
         const std::string& name = (modelHeader.version.major == 2 && modelHeader.version.minor >= 3)
                 ? inputNames.at(inputIndex) : std::string("input" + std::to_string(inputIndex));
 
-        HeaderLatest::RuntimeEndPoint input = ReadEndPoint(is);
+        HeaderLatest::RuntimeEndPoint input = ReadEndPoint(buffer);
         inputsDesc->getPtrInputsGlobal(name).push_back(reinterpret_cast<float*>(reinterpret_cast<uint8_t *> (basePtr) + input.descriptor_offset));
         inputsDesc->orientation_in[name] = input.orientation;
         inputsDesc->bytes_allocated_for_input[name] = input.element_size * input.elements_count;
@@ -912,7 +905,7 @@ void GNAModelSerial::ImportInputs(std::istream &is,
     }
 }
 
-void GNAModelSerial::ImportOutputs(std::istream &is,
+void GNAModelSerial::ImportOutputs(ModelBuffer &buffer,
         void* basePtr,
         std::vector<GNAPluginNS::OutputDesc> &desc,
         InferenceEngine::OutputsDataMap& dataMap) {
@@ -924,7 +917,7 @@ void GNAModelSerial::ImportOutputs(std::istream &is,
         const std::string& name = (modelHeader.version.major == 2 && modelHeader.version.minor >= 3)
                                   ? outputNames.at(outputIndex) : std::string("output" + std::to_string(outputIndex));
 
-        HeaderLatest::RuntimeEndPoint output = ReadEndPoint(is);
+        HeaderLatest::RuntimeEndPoint output = ReadEndPoint(buffer);
         OutputDesc description;
         description.ptrs.push_back(reinterpret_cast<float*>(reinterpret_cast<uint8_t *> (basePtr) + output.descriptor_offset));
         description.orientation = kDnnInterleavedOrientation;
@@ -947,18 +940,18 @@ void GNAModelSerial::ImportOutputs(std::istream &is,
     }
 }
 
-void GNAModelSerial::ImportTranspositionInfo(std::istream &is,
+void GNAModelSerial::ImportTranspositionInfo(ModelBuffer &buffer,
         std::string &name,
         std::vector<TranspositionInfo> &transpositionInfo) {
     uint32_t nameSize = 0;
-    readNBits<32>(nameSize, is);
+    readNBits<32>(nameSize, buffer);
     name.resize(nameSize, '\0');
-    readNBytes(&name[0], nameSize, is);
+    readNBytes(&name[0], nameSize, buffer);
     uint32_t transposeFragmentsSize = 0;
-    readNBits<32>(transposeFragmentsSize, is);
+    readNBits<32>(transposeFragmentsSize, buffer);
     for (int rotFragmIx = 0; rotFragmIx < transposeFragmentsSize; ++rotFragmIx) {
         TranspositionInfo fragmentTranspositionInfo;
-        readNBytes(&fragmentTranspositionInfo, sizeof(TranspositionInfo), is);
+        readNBytes(&fragmentTranspositionInfo, sizeof(TranspositionInfo), buffer);
         transpositionInfo.push_back(fragmentTranspositionInfo);
     }
 }
@@ -12,6 +12,7 @@
 #include "descriptions/gna_input_desc.hpp"
 #include "descriptions/gna_output_desc.hpp"
 #include "gna_plugin_log.hpp"
+#include "serial/gna_model_buffer.hpp"
 #include "serial/headers/latest/gna_model_header.hpp"
 #if GNA_LIB_VER == 2
 #include "gna2-model-api.h"
@@ -41,17 +42,17 @@ private:
     MemoryType states, *pstates = nullptr;
     GNAPluginNS::HeaderLatest::ModelHeader modelHeader;
 
-    void ImportInputs(std::istream &is,
+    void ImportInputs(GNAPluginNS::ModelBuffer &buffer,
             void* basePtr,
             std::shared_ptr<GNAPluginNS::InputDesc> inputsDesc,
             InferenceEngine::InputsDataMap& dataMap);
 
-    void ImportOutputs(std::istream &is,
+    void ImportOutputs(GNAPluginNS::ModelBuffer &buffer,
             void* basePtr,
             std::vector<GNAPluginNS::OutputDesc> &desc,
             InferenceEngine::OutputsDataMap& dataMap);
 
-    void ImportTranspositionInfo(std::istream &is,
+    void ImportTranspositionInfo(GNAPluginNS::ModelBuffer &buffer,
             std::string &name,
             std::vector<TranspositionInfo> &transpositionInfo);
 
@@ -133,23 +134,30 @@ private:
 
     /**
      * @brief calculate memory required for import gna graph
-     * @param is - opened input stream
+     * @param is - opened input stream, it is advanced past the header
      * @return
      */
     static GNAPluginNS::HeaderLatest::ModelHeader ReadHeader(std::istream &is);
 
-    GNAPluginNS::HeaderLatest::RuntimeEndPoint ReadEndPoint(std::istream &is);
+    /**
+     * @brief calculate memory required for import gna graph
+     * @param buffer - exported model, the position is moved past the header
+     * @return
+     */
+    static GNAPluginNS::HeaderLatest::ModelHeader ReadHeader(GNAPluginNS::ModelBuffer &buffer);
+
+    GNAPluginNS::HeaderLatest::RuntimeEndPoint ReadEndPoint(GNAPluginNS::ModelBuffer &buffer);
 
     /**
-     * @brief Import model from FS into preallocated buffer,
+     * @brief Import model from memory into preallocated buffer,
      * buffers for pLayers, and pStructs are allocated here and required manual deallocation using mm_free
      * @param ptr_nnet
      * @param basePointer
-     * @param is - stream without header structure - TBD heder might be needed
+     * @param buffer - exported model positioned after the header structure, the gna graph is placed by one copy
      */
     void Import(void *basePointer,
                 size_t gnaGraphSize,
-                std::istream & is,
+                GNAPluginNS::ModelBuffer & buffer,
                 std::shared_ptr<GNAPluginNS::InputDesc> inputsDesc,
                 std::vector<GNAPluginNS::OutputDesc> &desc,
                 InferenceEngine::InputsDataMap& inputsDataMap,
@@ -1541,7 +1541,15 @@ void GNAPlugin::SetName(const std::string & pluginName) noexcept {
 }
 
 InferenceEngine::IExecutableNetworkInternal::Ptr GNAPlugin::ImportNetwork(std::istream& networkModel) {
-    auto header = GNAModelSerial::ReadHeader(networkModel);
+    auto model = ModelBuffer::FromStream(networkModel);
+    auto network = ImportNetwork(model);
+    networkModel.seekg(model.Position(), std::ios_base::cur);
+    return network;
+}
+
+InferenceEngine::IExecutableNetworkInternal::Ptr GNAPlugin::ImportNetwork(ModelBuffer& model) {
+    OV_ITT_SCOPED_TASK(itt::domains::GNA_LT, "ImportNetwork");
+    auto header = GNAModelSerial::ReadHeader(model);
 
     InitGNADevice();
 
@@ -1571,7 +1579,7 @@ InferenceEngine::IExecutableNetworkInternal::Ptr GNAPlugin::ImportNetwork(std::i
     serial.setHeader(header);
     serial.Import(basePtr,
             header.gnaMemSize,
-            networkModel,
+            model,
             inputsDesc,
             outputsDesc,
             inputsDataMap,
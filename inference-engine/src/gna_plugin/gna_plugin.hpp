@@ -23,6 +23,7 @@
 #include "gna_graph_compiler.hpp"
 #include "gna_plugin_log.hpp"
 #include "gna_plugin_config.hpp"
+#include "serial/gna_model_buffer.hpp"
 #include <legacy/ie_util_internal.hpp>
 
 #if GNA_LIB_VER == 2
@@ -138,6 +139,12 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
 
     InferenceEngine::IExecutableNetworkInternal::Ptr ImportNetwork(std::istream& networkModel);
 
+    /**
+     * @brief imports the model from the memory, the stream overload reads the whole stream into it at once
+     * @param model - the exported model, the position is moved past the model
+     */
+    InferenceEngine::IExecutableNetworkInternal::Ptr ImportNetwork(GNAPluginNS::ModelBuffer& model);
+
     /**
      * utility to provide input and output blobs externally to be used by InferenceEngine request API clients
      */
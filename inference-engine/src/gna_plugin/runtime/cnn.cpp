@@ -6,9 +6,12 @@
 #include <limits>
 #include <cstdint>
 #include <cstdio>
+#include <vector>
 #include <gna_plugin_log.hpp>
+#include <ie_parallel.hpp>
 
 #include "cnn.h"
+#include "floatmath_gemm.hpp"
 #include "backend/dnn_types.h"
 #include "backend/gna_limitations.hpp"
 #include "gna_lib_ver_selector.hpp"
@@ -37,15 +40,14 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
-    for (uint32_t j = 0; j < numberOfOutputsPerFilter; j++, input += convolutionStride, output += numberOfFilters) {
-        auto filter = filters;
-        for (uint32_t i = 0; i < numberOfFilters; i++, filter += filterSize) {
-            output[i] = biases[i];
-            for (uint32_t k = 0; k < filterSize; k++) {
-                output[i] += input[k] * filter[k];
-            }
-        }
+    // the input windows are the overlapping rows of the input with the stride of the convolution
+    for (uint32_t j = 0; j < numberOfOutputsPerFilter; j++) {
+        std::copy(biases, biases + numberOfFilters, output + j * numberOfFilters);
     }
+    GNAPluginNS::runtime::XARCH::sgemm_nt(numberOfOutputsPerFilter, numberOfFilters, filterSize,
+                                          input, convolutionStride,
+                                          filters, filterSize,
+                                          output, numberOfFilters);
 }
 
 void CNNMaxPoolLegacy(intel_dnn_component_t *component, intel_dnn_number_type_t number_type, const bool sumPoolingOverRide) {
@@ -101,30 +103,30 @@ void CNNMaxPoolLegacy(intel_dnn_component_t *component, intel_dnn_number_type_t
         float *ptr_inputs = reinterpret_cast<float *>(component->ptr_inputs);
         float *ptr_outputs = reinterpret_cast<float *>(component->ptr_outputs);
 
-        for (uint32_t i = 0; i < in_c; i++) {
-            int32_t m = 0;
+        // the windows are pooled independently, the channels of a row are contiguous
+        const uint32_t num_windows = (num_rows_in + num_pool_step - 1) / num_pool_step;
+        InferenceEngine::parallel_for(num_windows, [&](uint32_t m) {
+            const uint32_t j = m * num_pool_step;
+            const uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
+            float *out = ptr_outputs + m * in_c;
             if (sumPoolingOverRide) {
-                for (uint32_t j = 0; j < num_rows_in; j += num_pool_step) {
-                    float sum = 0.0;
-                    uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
-                    for (uint32_t k = j; k < num_end; k++) {
-                        sum += ptr_inputs[k * in_c + i];
+                std::fill(out, out + in_c, 0.0f);
+                for (uint32_t k = j; k < num_end; k++) {
+                    const float *in = ptr_inputs + k * in_c;
+                    for (uint32_t i = 0; i < in_c; i++) {
+                        out[i] += in[i];
                     }
-                    ptr_outputs[m * in_c + i] = sum;
-                    m++;
                 }
             } else {
-                for (uint32_t j = 0; j < num_rows_in; j += num_pool_step) {
-                    float max = std::numeric_limits<float>::lowest();
-                    uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
-                    for (uint32_t k = j; k < num_end; k++) {
-                        if (ptr_inputs[k * in_c + i] > max) max = ptr_inputs[k * in_c + i];
+                std::fill(out, out + in_c, std::numeric_limits<float>::lowest());
+                for (uint32_t k = j; k < num_end; k++) {
+                    const float *in = ptr_inputs + k * in_c;
+                    for (uint32_t i = 0; i < in_c; i++) {
+                        out[i] = (in[i] > out[i]) ? in[i] : out[i];
                     }
-                    ptr_outputs[m * in_c + i] = max;
-                    m++;
                 }
             }
-        }
+        });
     }
 }
 
@@ -137,23 +139,6 @@ T getQubeIndex(T a1, T a2, T a3, T A2, T A3) {
 }
 } // namespace
 
-float MaxPool2D32SingleHWC(const unsigned poolWinH, const unsigned poolWinW,
-    const float* input, const unsigned IH, const unsigned IW, const unsigned IC,
-    const unsigned oh, const unsigned ow, const unsigned oc,
-    const uint32_t poolStrideH,
-    const uint32_t poolStrideW) {
-    float output = std::numeric_limits<float>::lowest();
-    const auto winStartH = oh * poolStrideH;
-    const auto winStartW = ow * poolStrideW;
-    for (unsigned winIdxH = 0; winIdxH < poolWinH && winStartH + winIdxH < IH; winIdxH++) {
-        for (unsigned winIdxW = 0; winIdxW < poolWinW && winStartW + winIdxW < IW; winIdxW++) {
-            const auto inputIndex = getQubeIndex(winStartH + winIdxH, winStartW + winIdxW, oc, IW, IC);
-            output = (std::max)(output, input[inputIndex]);
-        }
-    }
-    return output;
-}
-
 void CNNMaxPool2DFloat(intel_dnn_component_t* component) {
     float* ptr_inputs = reinterpret_cast<float*>(component->ptr_inputs);
     float* ptr_outputs = reinterpret_cast<float*>(component->ptr_outputs);
@@ -170,18 +155,21 @@ void CNNMaxPool2DFloat(intel_dnn_component_t* component) {
     const auto poolStrideW = component->op.maxpool.poolingStrideXY[0];
     const auto poolStrideH = component->op.maxpool.poolingStrideXY[1];
 
-    for (unsigned oc = 0; oc < OC; oc++) {
-        for (unsigned ow = 0; ow < OW; ow++) {
-            for (unsigned oh = 0; oh < OH; oh++) {
-                const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
-                ptr_outputs[outputIndex] = MaxPool2D32SingleHWC(poolWinH, poolWinW,
-                    ptr_inputs, IH, IW, IC,
-                    oh, ow, oc,
-                    poolStrideH,
-                    poolStrideW);
+    // HWC layout, the channels of every point of the window are pooled together
+    InferenceEngine::parallel_for2d(OH, OW, [&](unsigned oh, unsigned ow) {
+        float* output = ptr_outputs + getQubeIndex(oh, ow, 0u, OW, OC);
+        std::fill(output, output + OC, std::numeric_limits<float>::lowest());
+        const auto winStartH = oh * poolStrideH;
+        const auto winStartW = ow * poolStrideW;
+        for (unsigned winIdxH = 0; winIdxH < poolWinH && winStartH + winIdxH < IH; winIdxH++) {
+            for (unsigned winIdxW = 0; winIdxW < poolWinW && winStartW + winIdxW < IW; winIdxW++) {
+                const float* input = ptr_inputs + getQubeIndex(winStartH + winIdxH, winStartW + winIdxW, 0u, IW, IC);
+                for (unsigned oc = 0; oc < OC; oc++) {
+                    output[oc] = (std::max)(output[oc], input[oc]);
+                }
             }
         }
-    }
+    });
 }
 
 #if GNA_LIB_VER == 2
@@ -197,40 +185,6 @@ bool matchesPaddedArea(unsigned filterIndex, unsigned outputIndex, unsigned inpu
     return false;
 }
 
-float CNN2DFilter32SingleHWC(const float bias, const float* filter, const unsigned KH, const unsigned KW, const unsigned KC,
-    const float* image, const unsigned IH, const unsigned IW, const unsigned IC,
-    const unsigned oh, const unsigned ow, const unsigned oc,
-    const std::array<uint32_t, 2>& convStride,
-    const std::array<uint32_t, 2>& zeroPadding) {
-
-    const auto cSH = convStride[0];
-    const auto cSW = convStride[1];
-
-    const auto zPH = zeroPadding[0];
-    const auto zPW = zeroPadding[1];
-    float output = 0;
-    for (unsigned kh = 0; kh < KH; kh++) {
-        for (unsigned kw = 0; kw < KW; kw++) {
-            for (unsigned kc = 0; kc < KC; kc++) {
-                if (!matchesPaddedArea(kh, oh, IH, zPH, cSH) &&
-                    !matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
-                    const auto ih = (cSH * oh + kh) - zPH;
-                    const auto iw = (cSW * ow + kw) - zPW;
-                    const auto ic = kc;
-                    const auto imageIndex = getQubeIndex(ih, iw, ic, IW, IC);
-                    const auto imageElement = image[imageIndex];
-                    const auto filterIndex = getQubeIndex(kh, kw, kc, KW, KC);
-                    const auto filterElement = filter[filterIndex];
-                    const auto product = imageElement * filterElement;
-                    output += product;
-                }
-            }
-        }
-    }
-    output += bias;
-    return output;
-}
-
 void CNN2DFilter32(intel_dnn_component_t* component) {
     float* ptr_filters = reinterpret_cast<float*>(component->op.conv2D.ptr_filters);
     float* ptr_biases = reinterpret_cast<float*>(component->op.conv2D.ptr_biases);
@@ -259,21 +213,41 @@ void CNN2DFilter32(intel_dnn_component_t* component) {
     if (kc != IC) {
         THROW_GNA_EXCEPTION << "Depth of filter should be equal to input depth!" << layer_name;
     }
-    auto kernelIndex = 0;
-    for (unsigned oc = 0; oc < OC; oc++) {
-        for (unsigned ow = 0; ow < OW; ow++) {
-            for (unsigned oh = 0; oh < OH; oh++) {
-                const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
-                ptr_outputs[outputIndex] = CNN2DFilter32SingleHWC(*(ptr_biases + oc), ptr_filters + kernelIndex, kh, kw, kc,
-                    ptr_inputs, IH, IW, IC,
-                    oh, ow, oc,
-                    component->op.conv2D.convStride,
-                    component->op.conv2D.zeroPadding);
+
+    const auto cSH = component->op.conv2D.convStride[0];
+    const auto cSW = component->op.conv2D.convStride[1];
+    const auto zPH = component->op.conv2D.zeroPadding[0];
+    const auto zPW = component->op.conv2D.zeroPadding[1];
+
+    // every row of the patches holds the HWC window of one output point with zeros in the padded area,
+    // so the convolution is the product of the patches and the kernels
+    const auto patchSize = kh * kw * kc;
+    std::vector<float> patches(static_cast<size_t>(OH) * OW * patchSize);
+    InferenceEngine::parallel_for2d(OH, OW, [&](unsigned oh, unsigned ow) {
+        float* patch = patches.data() + (static_cast<size_t>(oh) * OW + ow) * patchSize;
+        for (unsigned h = 0; h < kh; h++) {
+            for (unsigned w = 0; w < kw; w++, patch += kc) {
+                if (matchesPaddedArea(h, oh, IH, zPH, cSH) || matchesPaddedArea(w, ow, IW, zPW, cSW)) {
+                    std::fill(patch, patch + kc, 0.0f);
+                } else {
+                    const auto ih = (cSH * oh + h) - zPH;
+                    const auto iw = (cSW * ow + w) - zPW;
+                    const float* image = ptr_inputs + getQubeIndex(ih, iw, 0u, IW, IC);
+                    std::copy(image, image + kc, patch);
+                }
             }
         }
-        // kernel padded to 16B = 4 * sizeof(float)
-        kernelIndex += ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
+    });
+
+    for (unsigned point = 0; point < OH * OW; point++) {
+        std::copy(ptr_biases, ptr_biases + OC, ptr_outputs + point * OC);
     }
+    // kernel padded to 16B = 4 * sizeof(float)
+    const auto kernelStride = ALIGN(patchSize, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
+    GNAPluginNS::runtime::XARCH::sgemm_nt(OH * OW, OC, patchSize,
+                                          patches.data(), patchSize,
+                                          ptr_filters, kernelStride,
+                                          ptr_outputs, OC);
 }
 
 #endif
@@ -0,0 +1,123 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "floatmath_gemm.hpp"
+
+#include <algorithm>
+#if defined(HAVE_AVX2)
+#include <immintrin.h>
+#endif
+#include "ie_parallel.hpp"
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace XARCH {
+
+namespace {
+
+// rows of B which share one load of the row of A
+constexpr uint32_t kRowsOfB = 4;
+// sizes of the blocks of C computed by one task
+constexpr uint32_t kBlockM = 16;
+constexpr uint32_t kBlockN = 64;
+// the number of multiply-adds below which the product is computed by the calling thread
+constexpr uint64_t kMinParallelWork = 1 << 16;
+
+#if defined(HAVE_AVX2)
+inline float hsum(__m256 v) {
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_movehdup_ps(s));
+    return _mm_cvtss_f32(s);
+}
+#endif
+
+// c[r] += dot(a, b + r * ldb) for r < kRowsOfB
+inline void dotRows(const float* a, const float* b, const uint32_t ldb, const uint32_t K, float* c) {
+    const float* b0 = b;
+    const float* b1 = b + ldb;
+    const float* b2 = b + 2 * ldb;
+    const float* b3 = b + 3 * ldb;
+    float s0 = 0.f, s1 = 0.f, s2 = 0.f, s3 = 0.f;
+    uint32_t k = 0;
+#if defined(HAVE_AVX2)
+    __m256 v0 = _mm256_setzero_ps(), v1 = _mm256_setzero_ps(), v2 = _mm256_setzero_ps(), v3 = _mm256_setzero_ps();
+    for (; k + 8 <= K; k += 8) {
+        const __m256 va = _mm256_loadu_ps(a + k);
+        v0 = _mm256_fmadd_ps(va, _mm256_loadu_ps(b0 + k), v0);
+        v1 = _mm256_fmadd_ps(va, _mm256_loadu_ps(b1 + k), v1);
+        v2 = _mm256_fmadd_ps(va, _mm256_loadu_ps(b2 + k), v2);
+        v3 = _mm256_fmadd_ps(va, _mm256_loadu_ps(b3 + k), v3);
+    }
+    s0 = hsum(v0);
+    s1 = hsum(v1);
+    s2 = hsum(v2);
+    s3 = hsum(v3);
+#endif
+    for (; k < K; k++) {
+        s0 += a[k] * b0[k];
+        s1 += a[k] * b1[k];
+        s2 += a[k] * b2[k];
+        s3 += a[k] * b3[k];
+    }
+    c[0] += s0;
+    c[1] += s1;
+    c[2] += s2;
+    c[3] += s3;
+}
+
+inline float dot(const float* a, const float* b, const uint32_t K) {
+    float s = 0.f;
+    uint32_t k = 0;
+#if defined(HAVE_AVX2)
+    __m256 v0 = _mm256_setzero_ps(), v1 = _mm256_setzero_ps();
+    for (; k + 16 <= K; k += 16) {
+        v0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + k), _mm256_loadu_ps(b + k), v0);
+        v1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + k + 8), _mm256_loadu_ps(b + k + 8), v1);
+    }
+    for (; k + 8 <= K; k += 8)
+        v0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + k), _mm256_loadu_ps(b + k), v0);
+    s = hsum(_mm256_add_ps(v0, v1));
+#endif
+    for (; k < K; k++)
+        s += a[k] * b[k];
+    return s;
+}
+
+void sgemm_nt_block(const uint32_t mStart, const uint32_t mEnd, const uint32_t nStart, const uint32_t nEnd,
+                    const uint32_t K, const float* A, const uint32_t lda, const float* B, const uint32_t ldb,
+                    float* C, const uint32_t ldc) {
+    for (uint32_t i = mStart; i < mEnd; i++) {
+        const float* a = A + static_cast<size_t>(i) * lda;
+        float* c = C + static_cast<size_t>(i) * ldc;
+        uint32_t j = nStart;
+        for (; j + kRowsOfB <= nEnd; j += kRowsOfB)
+            dotRows(a, B + static_cast<size_t>(j) * ldb, ldb, K, c + j);
+        for (; j < nEnd; j++)
+            c[j] += dot(a, B + static_cast<size_t>(j) * ldb, K);
+    }
+}
+
+}  // namespace
+
+void sgemm_nt(const uint32_t M, const uint32_t N, const uint32_t K,
+              const float* A, const uint32_t lda,
+              const float* B, const uint32_t ldb,
+              float* C, const uint32_t ldc) {
+    if (static_cast<uint64_t>(M) * N * K < kMinParallelWork) {
+        sgemm_nt_block(0, M, 0, N, K, A, lda, B, ldb, C, ldc);
+        return;
+    }
+
+    const uint32_t blocksM = (M + kBlockM - 1) / kBlockM;
+    const uint32_t blocksN = (N + kBlockN - 1) / kBlockN;
+    InferenceEngine::parallel_for2d(blocksM, blocksN, [&](uint32_t bm, uint32_t bn) {
+        sgemm_nt_block(bm * kBlockM, std::min(M, (bm + 1) * kBlockM), bn * kBlockN, std::min(N, (bn + 1) * kBlockN),
+                       K, A, lda, B, ldb, C, ldc);
+    });
+}
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -0,0 +1,26 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace XARCH {
+
+/**
+ * Accumulates the products of the rows of two row major matrices: C[i * ldc + j] += dot(A row i, B row j) over K
+ * elements for i < M and j < N, i.e. C += A * B^T. Both operands are read along K, so the weights of the affine
+ * and convolutional components are streamed once. The rows of A may overlap as the input windows of a convolution.
+ * The work is split between the threads of the IE parallel runtime.
+ */
+void sgemm_nt(const uint32_t M, const uint32_t N, const uint32_t K,
+              const float* A, const uint32_t lda,
+              const float* B, const uint32_t ldb,
+              float* C, const uint32_t ldc);
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -2,10 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <vector>
+
 #include "gna_float_runtime.hpp"
 #include "pwl.h"
 #include "cnn.h"
-#include "floatmath.h"
+#include "floatmath_gemm.hpp"
+#include "ie_parallel.hpp"
 
 using namespace GNAPluginNS;
 using namespace GNAPluginNS::runtime;
@@ -27,13 +30,28 @@ void FP::ApplyAffineTransform(intel_dnn_component_t *component, uint32_t *list,
     auto B = reinterpret_cast<float *>(component->ptr_inputs);
     auto C = reinterpret_cast<float *>(component->ptr_outputs);
     auto bias = reinterpret_cast<float *>(transform->ptr_biases);
+
+    // the columns of the inputs are the vectors of the batch, they are multiplied by the rows of the weights
+    // as the rows of the transposed inputs
+    std::vector<float> transposedB;
+    const float *Bt = B;
+    if (n > 1) {
+        transposedB.resize(static_cast<size_t>(n) * k);
+        for (uint32_t row = 0; row < k; row++) {
+            for (uint32_t col = 0; col < n; col++) {
+                transposedB[static_cast<size_t>(col) * k + row] = B[row * ldb + col];
+            }
+        }
+        Bt = transposedB.data();
+    }
+
     if (list == nullptr) {
         for (uint32_t i = 0; i < m; i++) {
             for (uint32_t j = 0; j < n; j++) {
                 C[i * ldc + j] = bias[i];
             }
         }
-        cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k, 1.0, A, lda, B, ldb, 1.0, C, ldc);
+        XARCH::sgemm_nt(m, n, k, A, lda, Bt, k, C, ldc);
     } else {
         for (int l = 0; l < listsize; l++) {
             int i = list[l];
@@ -41,22 +59,9 @@ void FP::ApplyAffineTransform(intel_dnn_component_t *component, uint32_t *list,
                 C[l * ldc + j] = bias[i];
             }
         }
-        cblas_sgemm_subset(CblasRowMajor,
-                           CblasNoTrans,
-                           CblasNoTrans,
-                           m,
-                           n,
-                           k,
-                           1.0,
-                           A,
-                           lda,
-                           B,
-                           ldb,
-                           1.0,
-                           C,
-                           ldc,
-                           list,
-                           listsize);
+        InferenceEngine::parallel_for(listsize, [&](uint32_t l) {
+            XARCH::sgemm_nt(1, n, k, A + list[l] * lda, lda, Bt, k, C + l * ldc, ldc);
+        });
     }
 }
 
@@ -74,18 +79,13 @@ void FP::ApplyDiagonalTransform(intel_dnn_component_t *component) {
     auto B = reinterpret_cast<float *>(component->ptr_inputs);
     auto C = reinterpret_cast<float *>(component->ptr_outputs);
     auto bias = reinterpret_cast<float *>(transform->ptr_biases);
-    for (uint32_t i = 0; i < m; i++) {
+    InferenceEngine::parallel_for(m, [&](uint32_t i) {
+        const float *Brow = B + i * n;
+        float *Crow = C + i * ldc;
         for (uint32_t j = 0; j < n; j++) {
-            C[i * ldc + j] = bias[i];
+            Crow[j] = bias[i] + A[i] * Brow[j];
         }
-    }
-    std::vector<float> Arow(n);
-    for (uint32_t i = 0; i < m; i++) {
-        float *Brow = B + i * n;
-        float *Crow = C + i * ldc;
-        std::fill(std::begin(Arow), std::end(Arow), A[i]);
-        cblas_ssbmv1(CblasRowMajor, CblasLower, n, 0, 1.0, Arow.data(), 1, Brow, 1, 1.0, Crow, 1);
-    }
+    });
 }
 
 void FP::ApplyRecurrentTransform(intel_dnn_component_t *component, uint32_t row, void *ptr_feedbacks) {
@@ -106,7 +106,12 @@ void FP::ApplyRecurrentTransform(intel_dnn_component_t *component, uint32_t row,
     auto X = reinterpret_cast<float *>(transform->ptr_weights);
     auto B = reinterpret_cast<float *>(transform->ptr_biases);
     auto C = reinterpret_cast<float *>(component->ptr_outputs) + row * component->num_columns_out;
-    sgemv_split(n, k1, k2, A1, A2, X, B, C);
+    // C = X * [ A1 A2 ] + B, the rows of X are the weights of the outputs
+    for (uint32_t i = 0; i < n; i++) {
+        C[i] = B[i];
+    }
+    XARCH::sgemm_nt(1, n, k1, A1, k1, X, k1 + k2, C, n);
+    XARCH::sgemm_nt(1, n, k2, A2, k2, X + k1, k1 + k2, C, n);
 }
 
 void FP::ApplyConvolutional1DTransform(intel_dnn_component_t *component) {
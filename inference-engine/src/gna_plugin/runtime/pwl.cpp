@@ -26,6 +26,7 @@
 
 #include "pwl.h"
 #include "gna_plugin_log.hpp"
+#include "ie_parallel.hpp"
 #include "gna_slope_scale.h"
 #include "round_float_define.hpp"
 
@@ -944,6 +945,9 @@ void PwlApply16(intel_dnn_component_t *component,
     }
 }
 
+// the number of the activated elements below which the range is activated by the calling thread
+static constexpr uint64_t kPwlMinParallelSize = 4096;
+
 void PwlApply32(intel_dnn_component_t *component, uint32_t num_subset_size) {
     if (component->orientation_in == kDnnInterleavedOrientation) {  // subsets only supported in interleaved orientation
         PwlApply32(component, 0, num_subset_size - 1, 0, component->num_columns_in - 1);
@@ -957,6 +961,16 @@ void PwlApply32(intel_dnn_component_t *component,
                 uint32_t num_row_end,
                 uint32_t num_col_start,
                 uint32_t num_col_end) {
+    // the rows are activated independently, so large ranges are split between the threads by rows
+    const uint32_t num_rows = num_row_end - num_row_start + 1;
+    const uint32_t num_cols = num_col_end - num_col_start + 1;
+    if (num_rows > 1 && static_cast<uint64_t>(num_rows) * num_cols >= kPwlMinParallelSize) {
+        InferenceEngine::parallel_for(num_rows, [&](uint32_t row) {
+            PwlApply32(component, num_row_start + row, num_row_start + row, num_col_start, num_col_end);
+        });
+        return;
+    }
+
     intel_piecewiselinear_t *transform = reinterpret_cast<intel_piecewiselinear_t *>(&component->op.pwl);
     float *ptr_in = reinterpret_cast<float *>(component->ptr_inputs);
     float *ptr_out = reinterpret_cast<float *>(component->ptr_outputs);
@@ -0,0 +1,80 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "serial/gna_model_buffer.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include <ngraph/runtime/mapped_memory.hpp>
+
+#include "gna_plugin_log.hpp"
+
+using namespace GNAPluginNS;
+
+ModelBuffer ModelBuffer::FromFile(const std::string& path) {
+    if (auto memory = ngraph::runtime::MappedMemory::map_file(path)) {
+        const auto data = memory->data();
+        const auto size = memory->size();
+        return ModelBuffer(std::move(memory), data, size);
+    }
+
+    std::ifstream is(path, std::ios_base::in | std::ios_base::binary);
+    if (is.fail()) {
+        THROW_GNA_EXCEPTION << "Cannot open file to import model: " << path;
+    }
+    return FromStream(is);
+}
+
+ModelBuffer ModelBuffer::FromStream(std::istream& is) {
+    const auto startPos = is.tellg();
+    if (startPos == -1) {
+        THROW_GNA_EXCEPTION << "Can't open stream to import";
+    }
+    is.seekg(0, is.end);
+    const auto endPos = is.tellg();
+    if (endPos == -1) {
+        THROW_GNA_EXCEPTION << "Can't open file to import";
+    }
+    is.seekg(startPos, is.beg);
+
+    auto data = std::make_shared<std::vector<char>>(static_cast<size_t>(endPos - startPos));
+    if (!data->empty()) {
+        is.read(data->data(), data->size());
+        if (is.gcount() != static_cast<std::streamsize>(data->size())) {
+            THROW_GNA_EXCEPTION << "Can't read " << data->size() << " bytes of the model from the stream";
+        }
+        is.seekg(startPos, is.beg);
+    }
+    const auto ptr = data->data();
+    const auto size = data->size();
+    return ModelBuffer(std::move(data), ptr, size);
+}
+
+void ModelBuffer::CheckAvailable(size_t size) const {
+    if (size > Remaining()) {
+        THROW_GNA_EXCEPTION << "Imported file is truncated: " << size << " bytes requested at the offset "
+                            << _position << ", but the model has " << _size << " bytes";
+    }
+}
+
+void ModelBuffer::Read(void* dst, size_t size) {
+    CheckAvailable(size);
+    std::memcpy(dst, _data + _position, size);
+    _position += size;
+}
+
+void ModelBuffer::Skip(size_t size) {
+    CheckAvailable(size);
+    _position += size;
+}
+
+void ModelBuffer::Seek(size_t position) {
+    if (position > _size) {
+        THROW_GNA_EXCEPTION << "Imported file is truncated: the offset " << position << " is out of the model of "
+                            << _size << " bytes";
+    }
+    _position = position;
+}
@@ -0,0 +1,78 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace GNAPluginNS {
+
+/**
+ * @brief Read only view of an exported model with the position of the next read.
+ * The model is mapped from the file or read from the stream by a single call, so the headers are parsed
+ * in the memory and the regions of the GNA graph are placed by bulk copies instead of many small stream reads.
+ */
+class ModelBuffer {
+public:
+    /**
+     * @brief Maps the file of the model, reads it at once if the mapping is not supported
+     * @param path - path to the exported model
+     */
+    static ModelBuffer FromFile(const std::string& path);
+
+    /**
+     * @brief Reads the rest of the stream at once and moves the stream back to the beginning of the model,
+     * so the stream is advanced by Position() bytes after the import
+     * @param is - seekable stream positioned at the beginning of the model
+     */
+    static ModelBuffer FromStream(std::istream& is);
+
+    /**
+     * @brief Copies the next bytes of the model
+     * @throws the exception if the model is shorter than the position and the size
+     */
+    void Read(void* dst, size_t size);
+
+    template <class T>
+    void Read(T& obj) {
+        Read(&obj, sizeof(T));
+    }
+
+    void Skip(size_t size);
+
+    /**
+     * @brief Moves to the position from the beginning of the model
+     */
+    void Seek(size_t position);
+
+    size_t Position() const {
+        return _position;
+    }
+
+    size_t Size() const {
+        return _size;
+    }
+
+    size_t Remaining() const {
+        return _size - _position;
+    }
+
+private:
+    ModelBuffer(std::shared_ptr<void> holder, const char* data, size_t size)
+        : _holder(std::move(holder)), _data(data), _size(size) {}
+
+    void CheckAvailable(size_t size) const;
+
+    // keeps the mapping or the copy of the stream alive
+    std::shared_ptr<void> _holder;
+    const char* _data;
+    size_t _size;
+    size_t _position = 0;
+};
+
+}  // namespace GNAPluginNS
@@ -5,6 +5,7 @@
 #include "ie_metric_helpers.hpp"
 #include "hetero_executable_network.hpp"
 #include "hetero_async_infer_request.hpp"
+#include "hetero_pipelined_async_infer_request.hpp"
 #include "hetero_itt.hpp"
 #include "xml_parse_utils.h"
 #include <caseless.hpp>
@@ -421,12 +422,20 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
                 }
             }}.run_on_function(ngraph::clone_function(*function));
     }
+    // all the subgraph devices are passed at once as the CPU core groups split the cores between each other
+    std::string subgraphDevices;
     for (auto&& network : _networks) {
-        auto metaDevices = _heteroPlugin->GetDevicePlugins(network._device, _config);
-        metaDevices[network._device].emplace(CONFIG_KEY_INTERNAL(FORCE_DISABLE_CACHE), "");
+        subgraphDevices += (subgraphDevices.empty() ? "" : ",") + network._device;
+    }
+    auto metaDevices = _heteroPlugin->GetDevicePlugins(subgraphDevices, _config);
+    for (auto&& network : _networks) {
+        auto loadConfig = metaDevices[network._device];
+        loadConfig.emplace(CONFIG_KEY_INTERNAL(FORCE_DISABLE_CACHE), "");
         network._network = _heteroPlugin->GetCore()->LoadNetwork(network._clonedNetwork,
-            network._device, metaDevices[network._device]);
+            Engine::GetLoadDeviceName(network._device), loadConfig);
     }
+
+    InitPipeline();
 }
 
 HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&                               heteroModel,
@@ -477,18 +486,21 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
 
     std::vector<NetworkDesc> descs;
     pugi::xml_node subnetworksNode = heteroNode.child("subnetworks");
+    std::string subgraphDevices;
+    FOREACH_CHILD(subnetworkNode, subnetworksNode, "subnetwork") {
+        subgraphDevices += (subgraphDevices.empty() ? "" : ",") + GetStrAttr(subnetworkNode, "device");
+    }
+    auto metaDevices = _heteroPlugin->GetDevicePlugins(subgraphDevices, importedConfigs);
     FOREACH_CHILD(subnetworkNode, subnetworksNode, "subnetwork") {
         auto deviceName = GetStrAttr(subnetworkNode, "device");
-
-        auto metaDevices = _heteroPlugin->GetDevicePlugins(deviceName, importedConfigs);
-        assert(metaDevices.size() == 1);
         auto& loadConfig = metaDevices[deviceName];
+        auto loadDeviceName = Engine::GetLoadDeviceName(deviceName);
 
         InferenceEngine::SoExecutableNetworkInternal executableNetwork;
         CNNNetwork cnnnetwork;
         bool loaded = false;
         if (_heteroPlugin->GetCore()->DeviceSupportsImportExport(deviceName)) {
-            executableNetwork = _heteroPlugin->GetCore()->ImportNetwork(heteroModel, deviceName, loadConfig);
+            executableNetwork = _heteroPlugin->GetCore()->ImportNetwork(heteroModel, loadDeviceName, loadConfig);
         } else {
             // read XML content
             std::string xmlString;
@@ -524,7 +536,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
                 outputs[outputName]->setPrecision(Precision::FromStr(GetStrAttr(outputNode, "precision")));
             }
 
-            executableNetwork = _heteroPlugin->GetCore()->LoadNetwork(cnnnetwork, deviceName, loadConfig);
+            executableNetwork = _heteroPlugin->GetCore()->LoadNetwork(cnnnetwork, loadDeviceName, loadConfig);
             loaded = true;
         }
 
@@ -552,6 +564,75 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
     this->_config = importedConfigs;
     this->_networks = std::move(descs);
     this->SetPointerToPlugin(_heteroPlugin->shared_from_this());
+
+    InitPipeline();
+}
+
+void HeteroExecutableNetwork::InitPipeline() {
+    auto itPipeline = _config.find(HETERO_CONFIG_KEY(PIPELINE));
+    _pipelined = itPipeline != _config.end() && itPipeline->second == YES;
+    if (!_pipelined) {
+        return;
+    }
+    auto itPerfCount = _config.find(CONFIG_KEY(PERF_COUNT));
+    _needPerfCounters = itPerfCount != _config.end() && itPerfCount->second == YES;
+
+    _stages.resize(_networks.size());
+    for (std::size_t stageId = 0; stageId < _networks.size(); ++stageId) {
+        auto& network = _networks[stageId]._network;
+        unsigned int optimalNumOfRequests = 1u;
+        try {
+            optimalNumOfRequests = network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        } catch (const InferenceEngine::Exception&) {}
+
+        auto& stage = _stages[stageId];
+        for (unsigned int requestId = 0; requestId < std::max(1u, optimalNumOfRequests); ++requestId) {
+            stage._requests.emplace_back(new StageRequest);
+            auto stageRequest = stage._requests.back().get();
+            stageRequest->_inferRequest = { network, network->CreateInferRequest() };
+            stageRequest->_inferRequest->SetCallback([this, stageId, stageRequest] (std::exception_ptr exceptionPtr) {
+                std::map<std::string, InferenceEngineProfileInfo> perfMap;
+                if (_needPerfCounters && nullptr == exceptionPtr) {
+                    perfMap = stageRequest->_inferRequest->GetPerformanceCounts();
+                }
+                auto completion = std::move(stageRequest->_completion);
+                // the results are already in the blobs of the infer request, so the stage is free for the next one
+                ReleaseStageRequest(stageId, *stageRequest);
+                completion(exceptionPtr, perfMap);
+            });
+            stage._idleRequests.push_back(stageRequest);
+        }
+    }
+}
+
+void HeteroExecutableNetwork::ScheduleToStage(std::size_t stageId, StageDispatch dispatch) {
+    StageRequest* stageRequest = nullptr;
+    {
+        std::lock_guard<std::mutex> lock{_stagesMutex};
+        auto& stage = _stages[stageId];
+        if (stage._idleRequests.empty()) {
+            stage._waitingDispatches.push_back(std::move(dispatch));
+            return;
+        }
+        stageRequest = stage._idleRequests.front();
+        stage._idleRequests.pop_front();
+    }
+    dispatch(*stageRequest);
+}
+
+void HeteroExecutableNetwork::ReleaseStageRequest(std::size_t stageId, StageRequest& stageRequest) {
+    StageDispatch dispatch;
+    {
+        std::lock_guard<std::mutex> lock{_stagesMutex};
+        auto& stage = _stages[stageId];
+        if (stage._waitingDispatches.empty()) {
+            stage._idleRequests.push_back(&stageRequest);
+            return;
+        }
+        dispatch = std::move(stage._waitingDispatches.front());
+        stage._waitingDispatches.pop_front();
+    }
+    dispatch(stageRequest);
 }
 
 void HeteroExecutableNetwork::Export(std::ostream& heteroModel) {
@@ -646,6 +727,16 @@ void HeteroExecutableNetwork::Export(std::ostream& heteroModel) {
 IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
         InputsDataMap networkInputs,
         OutputsDataMap networkOutputs) {
+    if (_pipelined) {
+        std::vector<SoExecutableNetworkInternal> networks;
+        for (auto&& subnetwork : _networks) {
+            networks.push_back(subnetwork._network);
+        }
+        return std::make_shared<HeteroPipelinedInferRequest>(networkInputs,
+                                                             networkOutputs,
+                                                             networks,
+                                                             _blobNameMap);
+    }
     HeteroInferRequest::SubRequestsList inferRequests;
     int index = 0;
     for (auto&& subnetwork : _networks) {
@@ -661,6 +752,14 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
 }
 
 IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequest() {
+    if (_pipelined) {
+        auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+        syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+        return std::make_shared<HeteroPipelinedAsyncInferRequest>(
+            std::static_pointer_cast<HeteroPipelinedInferRequest>(syncRequestImpl),
+            std::static_pointer_cast<HeteroExecutableNetwork>(shared_from_this()),
+            _callbackExecutor);
+    }
     return CreateAsyncInferRequestFromSync<HeteroAsyncInferRequest>();
 }
 
@@ -674,6 +773,7 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string
             result = std::string{};
         }
     } else if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) ||
+               name == HETERO_CONFIG_KEY(PIPELINE) ||
                name == CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)) {
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
@@ -762,6 +862,7 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
         std::vector<std::string> heteroConfigKeys = {
             "TARGET_FALLBACK",
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PIPELINE),
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)
         };
 
@@ -785,8 +886,15 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
         IE_SET_METRIC_RETURN(NETWORK_NAME, _name);
     } else if (EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
         unsigned int value = 0u;
-        for (auto&& desc : _networks) {
-            value = std::max(value, desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+        if (_pipelined) {
+            // enough requests to keep the requests of every stage busy
+            for (auto&& stage : _stages) {
+                value += static_cast<unsigned int>(stage._requests.size());
+            }
+        } else {
+            for (auto&& desc : _networks) {
+                value = std::max(value, desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            }
         }
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
     } else {
@@ -8,7 +8,10 @@
  */
 #pragma once
 
+#include <deque>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <map>
@@ -58,9 +61,39 @@ public:
 
     void Export(std::ostream& modelFile) override;
 
+    /**
+     * @brief Request of a subnetwork in the pipelined mode, it runs the subnetwork for any of the infer requests
+     */
+    struct StageRequest {
+        using Completion = std::function<void(std::exception_ptr,
+                                              const std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>&)>;
+        InferenceEngine::SoIInferRequestInternal    _inferRequest;
+        Completion                                  _completion;
+    };
+    using StageDispatch = std::function<void(StageRequest&)>;
+
+    /**
+     * @brief Calls `dispatch` with an idle request of the subnetwork, if all of them are busy the dispatch waits
+     * in the queue of the stage until one of them is released
+     */
+    void ScheduleToStage(std::size_t stageId, StageDispatch dispatch);
+
+    /**
+     * @brief Passes the request to the next waiting dispatch of the stage or makes it idle
+     */
+    void ReleaseStageRequest(std::size_t stageId, StageRequest& stageRequest);
+
 private:
     void InitCNNImpl(const InferenceEngine::CNNNetwork&    network);
     void InitNgraph(const InferenceEngine::CNNNetwork&     network);
+    void InitPipeline();
+
+    struct PipelineStage {
+        std::vector<std::unique_ptr<StageRequest>>  _requests;
+        std::deque<StageRequest*>                   _idleRequests;
+        // the queue is bounded by the number of the infer requests as every request waits for one stage at a time
+        std::deque<StageDispatch>                   _waitingDispatches;
+    };
 
     struct NetworkDesc {
         std::string                                   _device;
@@ -73,6 +106,11 @@ private:
     std::string                                  _name;
     std::map<std::string, std::string>           _config;
     std::unordered_map<std::string, std::string> _blobNameMap;
+
+    bool                                         _pipelined = false;
+    bool                                         _needPerfCounters = false;
+    std::mutex                                   _stagesMutex;
+    std::vector<PipelineStage>                   _stages;
 };
 
 }  // namespace HeteroPlugin
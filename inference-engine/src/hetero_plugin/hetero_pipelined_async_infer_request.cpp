@@ -0,0 +1,80 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include "hetero_pipelined_async_infer_request.hpp"
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+
+HeteroPipelinedAsyncInferRequest::HeteroPipelinedAsyncInferRequest(const HeteroPipelinedInferRequest::Ptr&  request,
+                                                                   const HeteroExecutableNetwork::Ptr&      heteroExecutableNetwork,
+                                                                   const ITaskExecutor::Ptr&                callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(request, nullptr, callbackExecutor),
+    _heteroInferRequest(request),
+    _heteroExecutableNetwork(heteroExecutableNetwork) {
+    _pipeline.clear();
+    for (std::size_t stageId = 0; stageId < _heteroInferRequest->GetNumberOfSubnetworks(); ++stageId) {
+        // this executor waits for a request of the stage, the task (checking the result) is run on its completion
+        struct StageExecutor : ITaskExecutor {
+            StageExecutor(HeteroPipelinedAsyncInferRequest* _this_, std::size_t stageId) :
+                _this{_this_}, _stageId{stageId} {}
+            void run(Task task) override {
+                _task = std::move(task);
+                _this->_heteroExecutableNetwork->ScheduleToStage(_stageId,
+                [this] (HeteroExecutableNetwork::StageRequest& stageRequest) {
+                    stageRequest._completion = [this] (std::exception_ptr exceptionPtr,
+                                                       const std::map<std::string, InferenceEngineProfileInfo>& perfMap) {
+                        _exceptionPtr = exceptionPtr;
+                        for (auto&& perf : perfMap) {
+                            _this->_perfMap[std::string("subgraph") + std::to_string(_stageId) + ": " + perf.first] = perf.second;
+                        }
+                        auto capturedTask = std::move(_task);
+                        capturedTask();
+                    };
+                    try {
+                        _this->_heteroInferRequest->BindSubRequest(_stageId, stageRequest._inferRequest);
+                        stageRequest._inferRequest->StartAsync();
+                    } catch (...) {
+                        auto completion = std::move(stageRequest._completion);
+                        _this->_heteroExecutableNetwork->ReleaseStageRequest(_stageId, stageRequest);
+                        completion(std::current_exception(), {});
+                    }
+                });
+            };
+            HeteroPipelinedAsyncInferRequest*   _this = nullptr;
+            std::size_t                         _stageId = 0;
+            std::exception_ptr                  _exceptionPtr;
+            Task                                _task;
+        };
+
+        auto stageExecutor = std::make_shared<StageExecutor>(this, stageId);
+        _pipeline.emplace_back(stageExecutor, [stageExecutor] {
+            if (nullptr != stageExecutor->_exceptionPtr) {
+                std::rethrow_exception(stageExecutor->_exceptionPtr);
+            }
+        });
+    }
+}
+
+void HeteroPipelinedAsyncInferRequest::StartAsync_ThreadUnsafe() {
+    _heteroInferRequest->PreprocessInputs();
+    RunFirstStage(_pipeline.begin(), _pipeline.end(), _callbackExecutor);
+}
+
+void HeteroPipelinedAsyncInferRequest::Infer_ThreadUnsafe() {
+    InferUsingAsync();
+}
+
+std::map<std::string, InferenceEngineProfileInfo> HeteroPipelinedAsyncInferRequest::GetPerformanceCounts() const {
+    CheckState();
+    return _perfMap;
+}
+
+HeteroPipelinedAsyncInferRequest::~HeteroPipelinedAsyncInferRequest() {
+    StopAndWait();
+}
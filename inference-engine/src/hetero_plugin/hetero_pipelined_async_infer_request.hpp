@@ -0,0 +1,37 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include "cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp"
+#include "hetero_executable_network.hpp"
+#include "hetero_pipelined_infer_request.hpp"
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Runs every subnetwork on a request taken from the pool of the stage, so the consecutive infer requests
+ * occupy different stages at the same time
+ */
+class HeteroPipelinedAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<HeteroPipelinedAsyncInferRequest>;
+    HeteroPipelinedAsyncInferRequest(const HeteroPipelinedInferRequest::Ptr&     request,
+                                     const HeteroExecutableNetwork::Ptr&         heteroExecutableNetwork,
+                                     const InferenceEngine::ITaskExecutor::Ptr&  callbackExecutor);
+    ~HeteroPipelinedAsyncInferRequest();
+    void StartAsync_ThreadUnsafe() override;
+    void Infer_ThreadUnsafe() override;
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
+
+private:
+    HeteroPipelinedInferRequest::Ptr                                    _heteroInferRequest;
+    HeteroExecutableNetwork::Ptr                                        _heteroExecutableNetwork;
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>  _perfMap;
+};
+
+}  // namespace HeteroPlugin
@@ -0,0 +1,100 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_pipelined_infer_request.hpp"
+#include "hetero_itt.hpp"
+#include <ie_blob.h>
+#include <blob_factory.hpp>
+#include <ie_algorithm.hpp>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+HeteroPipelinedInferRequest::HeteroPipelinedInferRequest(InferenceEngine::InputsDataMap networkInputs,
+                                                         InferenceEngine::OutputsDataMap networkOutputs,
+                                                         const std::vector<SoExecutableNetworkInternal>& networks,
+                                                         const std::unordered_map<std::string, std::string>& blobNameMap) :
+    IInferRequestInternal(networkInputs, networkOutputs),
+    _networks(networks),
+    _blobNameMap(blobNameMap) {
+    if (_networkOutputs.empty() || _networkInputs.empty()) {
+        IE_THROW() << "Internal error: no information about network's output/input";
+    }
+
+    auto allocateBlob = [&] (const std::string& blobName, const TensorDesc& desc) {
+        std::string intermediateBlobName = blobName;
+        auto itName = _blobNameMap.find(blobName);
+        if (itName != _blobNameMap.end()) {
+            intermediateBlobName = itName->second;
+        }
+        if (contains(_blobs, intermediateBlobName)) {
+            return;
+        }
+        auto blob = make_blob_with_precision(desc);
+        blob->allocate();
+        _blobs[intermediateBlobName] = blob;
+        if (contains(_networkInputs, intermediateBlobName)) {
+            _inputs[intermediateBlobName] = blob;
+        } else if (contains(_networkOutputs, intermediateBlobName)) {
+            _outputs[intermediateBlobName] = blob;
+        }
+    };
+
+    // the blob of an intermediate result is described by the subnetwork which produces it
+    for (auto&& network : _networks) {
+        for (auto&& outputInfo : network->GetOutputsInfo()) {
+            allocateBlob(outputInfo.first, outputInfo.second->getTensorDesc());
+        }
+    }
+    for (auto&& network : _networks) {
+        for (auto&& inputInfo : network->GetInputsInfo()) {
+            allocateBlob(inputInfo.first, inputInfo.second->getTensorDesc());
+        }
+    }
+}
+
+void HeteroPipelinedInferRequest::InferImpl() {
+    // the subnetworks are run by the stages of HeteroPipelinedAsyncInferRequest
+    IE_THROW(NotImplemented);
+}
+
+Blob::Ptr HeteroPipelinedInferRequest::GetSubnetworkBlob(const std::string& name) {
+    std::string intermediateBlobName = name;
+    auto itName = _blobNameMap.find(name);
+    if (itName != _blobNameMap.end()) {
+        intermediateBlobName = itName->second;
+    }
+    // the network inputs and outputs could be replaced by the user
+    if (contains(_networkInputs, intermediateBlobName)) {
+        return _inputs[intermediateBlobName];
+    } else if (contains(_networkOutputs, intermediateBlobName)) {
+        return _outputs[intermediateBlobName];
+    }
+    return _blobs[intermediateBlobName];
+}
+
+void HeteroPipelinedInferRequest::BindSubRequest(std::size_t subnetworkId, SoIInferRequestInternal& request) {
+    OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, "BindSubRequest");
+    auto& network = _networks[subnetworkId];
+    for (auto&& inputInfo : network->GetInputsInfo()) {
+        auto blob = GetSubnetworkBlob(inputInfo.first);
+        if (request->GetBlob(inputInfo.first) != blob) {
+            request->SetBlob(inputInfo.first, blob);
+        }
+    }
+    for (auto&& outputInfo : network->GetOutputsInfo()) {
+        auto blob = GetSubnetworkBlob(outputInfo.first);
+        if (request->GetBlob(outputInfo.first) != blob) {
+            request->SetBlob(outputInfo.first, blob);
+        }
+    }
+}
+
+void HeteroPipelinedInferRequest::PreprocessInputs() {
+    execDataPreprocessing(_inputs);
+}
@@ -0,0 +1,55 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <ie_common.h>
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Infer request of the pipelined mode. It does not own the requests of the subnetworks but owns the blobs of
+ * all the subnetwork inputs, outputs and intermediate results, so any request of a subnetwork can run it in place.
+ */
+class HeteroPipelinedInferRequest : public InferenceEngine::IInferRequestInternal {
+public:
+    typedef std::shared_ptr<HeteroPipelinedInferRequest> Ptr;
+
+    explicit HeteroPipelinedInferRequest(InferenceEngine::InputsDataMap networkInputs,
+                                         InferenceEngine::OutputsDataMap networkOutputs,
+                                         const std::vector<InferenceEngine::SoExecutableNetworkInternal>& networks,
+                                         const std::unordered_map<std::string, std::string>& blobNameMap);
+
+    void InferImpl() override;
+
+    /**
+     * @brief Sets the blobs of this request to the inputs and outputs of the request of the subnetwork
+     */
+    void BindSubRequest(std::size_t subnetworkId, InferenceEngine::SoIInferRequestInternal& request);
+
+    std::size_t GetNumberOfSubnetworks() const {
+        return _networks.size();
+    }
+
+    /**
+     * @brief Runs the preprocessing of the inputs set by the user
+     */
+    void PreprocessInputs();
+
+private:
+    InferenceEngine::Blob::Ptr GetSubnetworkBlob(const std::string& name);
+
+    std::vector<InferenceEngine::SoExecutableNetworkInternal>   _networks;
+    std::unordered_map<std::string, std::string>                _blobNameMap;
+    std::map<std::string, InferenceEngine::Blob::Ptr>           _blobs;
+};
+
+}  // namespace HeteroPlugin
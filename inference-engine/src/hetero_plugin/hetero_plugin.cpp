@@ -4,6 +4,7 @@
 
 #include "ie_metric_helpers.hpp"
 #include "hetero_plugin.hpp"
+#include <algorithm>
 #include <memory>
 #include <vector>
 #include <map>
@@ -12,7 +13,9 @@
 #include <fstream>
 #include <unordered_set>
 #include "ie_plugin_config.hpp"
+#include "ie_system_conf.h"
 #include "hetero_executable_network.hpp"
+#include <ngraph/op/util/op_types.hpp>
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 
 using namespace InferenceEngine;
@@ -24,6 +27,7 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(PIPELINE)] = NO;
 }
 
 namespace {
@@ -34,8 +38,29 @@ Engine::Configs mergeConfigs(Engine::Configs config, const Engine::Configs & loc
     }
     return config;
 }
+
+// "CPU.<N>" does not select a separate device but a group of the CPU cores
+bool isCpuCoreGroup(const std::string& deviceWithID) {
+    DeviceIDParser deviceParser(deviceWithID);
+    return deviceParser.getDeviceName() == "CPU" && !deviceParser.getDeviceID().empty();
+}
+
+std::vector<std::string> getCpuCoreGroups(const std::vector<std::string>& devices) {
+    std::vector<std::string> coreGroups;
+    for (auto&& device : devices) {
+        if (isCpuCoreGroup(device) && coreGroups.end() == std::find(coreGroups.begin(), coreGroups.end(), device)) {
+            coreGroups.push_back(device);
+        }
+    }
+    std::sort(coreGroups.begin(), coreGroups.end(), [] (const std::string& lhs, const std::string& rhs) {
+        return std::stoi(DeviceIDParser(lhs).getDeviceID()) < std::stoi(DeviceIDParser(rhs).getDeviceID());
+    });
+    return coreGroups;
+}
+
 std::vector<std::string> supported_configKeys {
     HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+    HETERO_CONFIG_KEY(PIPELINE),
     "TARGET_FALLBACK",
     CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)
 };
@@ -102,9 +127,25 @@ Engine::DeviceMetaInformationMap Engine::GetDevicePlugins(const std::string& tar
             metaDevices[deviceName] = getDeviceConfig(deviceName);
         }
     }
+
+    // the physical cores are evenly split between the CPU core groups, threads of every group are pinned to its cores
+    auto coreGroups = getCpuCoreGroups(fallbackDevices);
+    if (!coreGroups.empty()) {
+        const int coresPerGroup = std::max(1, getNumberOfCPUCores() / static_cast<int>(coreGroups.size()));
+        for (std::size_t groupId = 0; groupId < coreGroups.size(); ++groupId) {
+            auto& groupConfig = metaDevices[coreGroups[groupId]];
+            groupConfig[KEY_CPU_THREADS_NUM] = std::to_string(coresPerGroup);
+            groupConfig[KEY_CPU_BIND_THREAD] = YES;
+            groupConfig[CONFIG_KEY_INTERNAL(CPU_BIND_THREAD_OFFSET)] = std::to_string(groupId * coresPerGroup);
+        }
+    }
     return metaDevices;
 }
 
+std::string Engine::GetLoadDeviceName(const std::string& device) {
+    return isCpuCoreGroup(device) ? std::string{"CPU"} : device;
+}
+
 void Engine::SetConfig(const Configs &configs) {
     for (auto && kvp : configs) {
         const auto& name = kvp.first;
@@ -139,7 +180,7 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork &network, const Configs
     std::map<std::string, QueryNetworkResult> queryResults;
     for (auto&& metaDevice : metaDevices) {
         auto& deviceName = metaDevice.first;
-        queryResults[deviceName] = GetCore()->QueryNetwork(network, deviceName, metaDevice.second);
+        queryResults[deviceName] = GetCore()->QueryNetwork(network, GetLoadDeviceName(deviceName), metaDevice.second);
     }
 
     //  WARNING: Here is devices with user set priority
@@ -147,7 +188,52 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork &network, const Configs
 
     for (auto&& deviceName : fallbackDevices) {
         for (auto&& layerQueryResult : queryResults[deviceName].supportedLayersMap) {
-            qr.supportedLayersMap.emplace(layerQueryResult);
+            qr.supportedLayersMap.emplace(layerQueryResult.first,
+                isCpuCoreGroup(deviceName) ? deviceName : layerQueryResult.second);
+        }
+    }
+
+    // the layers supported by CPU are split between the core groups into contiguous parts of the topological order
+    // with about the same number of operations, so the parts form a chain of subgraphs which can run pipelined
+    auto coreGroups = getCpuCoreGroups(fallbackDevices);
+    if (coreGroups.size() > 1) {
+        auto isCpuLayer = [&] (const std::string& name) {
+            auto itLayer = qr.supportedLayersMap.find(name);
+            return itLayer != qr.supportedLayersMap.end() && isCpuCoreGroup(itLayer->second);
+        };
+        auto isComputeOp = [] (const std::shared_ptr<ngraph::Node>& node) {
+            return !ngraph::op::is_constant(node) && !ngraph::op::is_output(node) && !ngraph::op::is_parameter(node);
+        };
+        auto orderedOps = function->get_ordered_ops();
+        std::size_t numCpuOps = 0;
+        for (auto&& node : orderedOps) {
+            if (isComputeOp(node) && isCpuLayer(node->get_friendly_name())) {
+                ++numCpuOps;
+            }
+        }
+        std::size_t cpuOpId = 0;
+        for (auto&& node : orderedOps) {
+            if (isComputeOp(node) && isCpuLayer(node->get_friendly_name())) {
+                qr.supportedLayersMap[node->get_friendly_name()] = coreGroups[cpuOpId++ * coreGroups.size() / numCpuOps];
+            }
+        }
+        // constants and parameters follow their first consumer, results follow their producer,
+        // the constants and parameters without consumers keep their own affinity
+        for (auto&& node : orderedOps) {
+            if (!isComputeOp(node) && isCpuLayer(node->get_friendly_name())) {
+                std::string nodeWithAffinityName = node->get_friendly_name();
+                if (ngraph::op::is_output(node)) {
+                    nodeWithAffinityName = node->input_value(0).get_node()->get_friendly_name();
+                } else {
+                    const auto consumers = node->output(0).get_target_inputs();
+                    if (!consumers.empty()) {
+                        nodeWithAffinityName = consumers.begin()->get_node()->get_friendly_name();
+                    }
+                }
+                if (isCpuLayer(nodeWithAffinityName)) {
+                    qr.supportedLayersMap[node->get_friendly_name()] = qr.supportedLayersMap[nodeWithAffinityName];
+                }
+            }
         }
     }
 
@@ -207,6 +293,11 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return { dump };
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE)) {
+        auto it = _config.find(HETERO_CONFIG_KEY(PIPELINE));
+        IE_ASSERT(it != _config.end());
+        bool pipeline = it->second == YES;
+        return { pipeline };
     } else if (name == "TARGET_FALLBACK") {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
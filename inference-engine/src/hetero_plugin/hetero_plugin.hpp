@@ -43,6 +43,11 @@ public:
     DeviceMetaInformationMap GetDevicePlugins(const std::string& targetFallback,
                                               const Configs & localConfig) const;
 
+    /**
+     * @brief Returns the device to load a subgraph assigned to `device` on, "CPU.<N>" core groups are loaded on CPU
+     */
+    static std::string GetLoadDeviceName(const std::string& device);
+
 private:
     Configs GetSupportedConfig(const Configs& config, const std::string & deviceName) const;
     std::string DeviceArchitecture(const std::string& targetFallback) const;
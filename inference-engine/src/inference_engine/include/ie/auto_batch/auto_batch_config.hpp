@@ -0,0 +1,59 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines advanced related properties for the Auto-Batching plugin.
+ * These properties should be used in SetConfig() and LoadNetwork() methods
+ *
+ * @file auto_batch_config.hpp
+ */
+
+#pragma once
+
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Auto-Batching plugin configuration
+ */
+namespace AutoBatchConfigParams {
+
+/**
+ * @def AUTO_BATCH_CONFIG_KEY(name)
+ * @brief A macro which provides an AUTO_BATCH-mangled name for configuration key with name `name`
+ */
+#define AUTO_BATCH_CONFIG_KEY(name) InferenceEngine::AutoBatchConfigParams::_CONFIG_KEY(AUTO_BATCH_##name)
+
+#define DECLARE_AUTO_BATCH_CONFIG_KEY(name) DECLARE_CONFIG_KEY(AUTO_BATCH_##name)
+
+/**
+ * @brief The device to execute the batched network on, with the optional batch size in brackets, e.g. "CPU(16)".
+ * The "BATCH:CPU(16)" device name sets this key implicitly
+ */
+DECLARE_AUTO_BATCH_CONFIG_KEY(DEVICE);
+
+/**
+ * @brief The time in milliseconds a request waits for the other requests to fill the batch,
+ * after the timeout the collected requests are executed as a partial batch
+ */
+DECLARE_AUTO_BATCH_CONFIG_KEY(TIMEOUT);
+
+}  // namespace AutoBatchConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief ExecutableNetwork metric to get the number of batched inferences per number of the collected requests
+ */
+DECLARE_METRIC_KEY(AUTO_BATCH_SIZE_DISTRIBUTION, std::map<unsigned int, uint64_t>);
+
+/**
+ * @brief ExecutableNetwork metric to get the time in milliseconds the requests wait for the batch to be collected,
+ * the "AVERAGE" and "MAX" values are reported
+ */
+DECLARE_METRIC_KEY(AUTO_BATCH_QUEUE_LATENCY, std::map<std::string, float>);
+
+}  // namespace Metrics
+}  // namespace InferenceEngine
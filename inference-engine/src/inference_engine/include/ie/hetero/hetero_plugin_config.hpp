@@ -34,5 +34,14 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of the pipelined execution of the subgraphs.
+ * Every subgraph gets a pool of device requests shared by all the infer requests of the network, so while one
+ * request runs its second subgraph the next one runs the first subgraph and the throughput approaches the
+ * throughput of the slowest subgraph.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINE);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
@@ -207,6 +207,54 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get a string with the compile profile of executable network: wall time of every transformation
+ * pass and compilation stage run by LoadNetwork and, if enabled by the plugin configuration, their node counts before
+ * and after and number of created nodes.
+ * The string is a JSON in the Chrome trace event format, so it can be saved to a file and opened by
+ * chrome://tracing or Perfetto. String value is "COMPILE_PROFILE"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(COMPILE_PROFILE, std::string);
+
+/**
+ * @brief Metric to get an unsigned integer estimate of Reorder layers that CPU plugin avoided by selecting layouts
+ * for the whole graph instead of selecting them per layer. The estimate is the number of edges with mismatching
+ * layouts removed by the selection, the later graph optimizations may fuse or drop some Reorders on the other edges,
+ * so the actual Reorders are the ones of the executable graph info. String value is "CPU_ESTIMATED_AVOIDED_REORDERS"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_ESTIMATED_AVOIDED_REORDERS, unsigned int);
+
+/**
+ * @brief Metric to get an unsigned integer number of inferences of CPU executable network which found the graph for
+ * their input shapes in the shape cache. String value is "CPU_SHAPE_CACHE_HITS"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_SHAPE_CACHE_HITS, unsigned int);
+
+/**
+ * @brief Metric to get an unsigned integer number of graphs CPU executable network compiled for the input shapes
+ * which were not in the shape cache. String value is "CPU_SHAPE_CACHE_MISSES"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_SHAPE_CACHE_MISSES, unsigned int);
+
+/**
+ * @brief Metric to get a float total time in milliseconds CPU executable network spent compiling the graphs of
+ * the shape cache. String value is "CPU_SHAPE_CACHE_COMPILE_TIME_MS"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_SHAPE_CACHE_COMPILE_TIME_MS, float);
+
+/**
+ * @brief Metric to get an unsigned integer time in microseconds of the longest path through the dependencies between
+ * the nodes of the last inference executed with CPU_PARALLEL_BRANCHES and perf counters enabled. It bounds the
+ * latency of the inference. String value is "CPU_PARALLEL_CRITICAL_PATH_US"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_PARALLEL_CRITICAL_PATH_US, unsigned int);
+
+/**
+ * @brief Metric to get an unsigned integer sum of the execution times in microseconds of all nodes of the same
+ * inference as CPU_PARALLEL_CRITICAL_PATH_US. String value is "CPU_PARALLEL_NODES_TIME_US"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_PARALLEL_NODES_TIME_US, unsigned int);
+
 }  // namespace Metrics
 
 /**
@@ -275,6 +323,51 @@ DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
 
+/**
+ * @brief The name for setting execution of independent graph branches in parallel inside one inference request.
+ *
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default)
+ * The option is useful in the latency mode (single stream) for topologies with many small parallel branches.
+ * It takes effect only if the Inference Engine is built with TBB.
+ */
+DECLARE_CONFIG_KEY(CPU_PARALLEL_BRANCHES);
+
+/**
+ * @brief The name for setting the number of graphs CPU executable network keeps compiled for the input shapes
+ * different from the ones the network was loaded with.
+ *
+ * It is passed to Core::SetConfig(), this option should be used with non-negative integer values, 0 is the default
+ * and disables the cache. When the cache is enabled, the input blobs of any shapes the network can be reshaped to
+ * may be set to an infer request. The graph for their shapes is compiled by the first inference and reused by the
+ * following ones until the graphs of the other shapes evict it. The constant data is shared by all the graphs.
+ * The output blobs are reallocated for the output shapes of every inference, so they should be taken by
+ * InferRequest::GetBlob after the inference. The option can't be used with the dynamic batch and the networks with
+ * variable states.
+ */
+DECLARE_CONFIG_KEY(CPU_SHAPE_CACHE_CAPACITY);
+
+/**
+ * @brief The name for setting the graph-wide layout selection of CPU plugin.
+ *
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES (default) or PluginConfigParams::NO
+ * When the option is enabled, the layouts of the nodes are chosen to minimize the number of the reorders in the graph
+ * instead of the best layout of every node alone. NO keeps the per-node choice, e.g. to compare the performance.
+ */
+DECLARE_CONFIG_KEY(CPU_LAYOUT_OPTIMIZATION);
+
+/**
+ * @brief The name for setting the node counts of the compile profile of CPU plugin.
+ *
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default)
+ * When the option is enabled, the COMPILE_PROFILE metric reports the node counts of every pass and stage besides
+ * their time. The nodes are counted by a walk over the whole network after every pass which changes it, so the option
+ * slows down LoadNetwork of the large networks.
+ */
+DECLARE_CONFIG_KEY(CPU_COMPILE_PROFILE_NODE_COUNTS);
+
 /**
  * @brief The name for setting performance counters option.
  *
@@ -390,6 +483,25 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
  */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
+/**
+ * @brief This key selects the allocator which is used by Blob::allocate() for blobs created without an allocator
+ *
+ * It is a process-wide setting, so it is accepted only without a device name:
+ *  - CONFIG_VALUE(SYSTEM) (default) - every blob allocates and releases its memory with new[] and delete[]
+ *  - CONFIG_VALUE(POOLED) - released memory is kept in cache line aligned size-class pools and is reused by the
+ *    next blobs of the same size class. Large blocks are 2 MB aligned, memory is placed on the NUMA node of the
+ *    thread which allocates it first.
+ *  - CONFIG_VALUE(POOLED_HUGE_PAGES) - the same as CONFIG_VALUE(POOLED), but large blocks are backed by huge pages
+ *
+ * @code
+ * ie.SetConfig({{CONFIG_KEY(BLOB_ALLOCATOR), CONFIG_VALUE(POOLED)}});
+ * @endcode
+ */
+DECLARE_CONFIG_KEY(BLOB_ALLOCATOR);
+DECLARE_CONFIG_VALUE(SYSTEM);
+DECLARE_CONFIG_VALUE(POOLED);
+DECLARE_CONFIG_VALUE(POOLED_HUGE_PAGES);
+
 }  // namespace PluginConfigParams
 
 /**
@@ -407,6 +519,7 @@ DECLARE_AUTO_CONFIG_KEY(DEVICE_LIST);
 
 }  // namespace InferenceEngine
 
+#include "auto_batch/auto_batch_config.hpp"
 #include "hetero/hetero_plugin_config.hpp"
 #include "multi-device/multi_device_config.hpp"
 
@@ -34,5 +34,26 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @brief The key defines how the inference requests are distributed between the devices:
+ *  - MULTI_PRIORITY (default) - a request goes to the first device in the DEVICE_PRIORITIES list which has an idle
+ *    worker request, so the next devices receive the requests only when the previous ones are busy
+ *  - MULTI_THROUGHPUT - a request goes to the device with the minimal expected completion time which is
+ *    estimated from the moving average of the inference time measured on the device and the number of requests
+ *    already assigned to the device, the request waits for the device if it finishes earlier than an idle one
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+DECLARE_MULTI_CONFIG_VALUE(PRIORITY);
+DECLARE_MULTI_CONFIG_VALUE(THROUGHPUT);
+
 }  // namespace MultiDeviceConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief ExecutableNetwork metric to get the number of inference requests dispatched to every device of the MULTI
+ */
+DECLARE_METRIC_KEY(MULTI_DISPATCH_COUNTS, std::map<std::string, uint64_t>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
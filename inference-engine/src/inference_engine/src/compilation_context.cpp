@@ -15,6 +15,7 @@
 #include "cpp/ie_cnn_network.h"
 #include "details/ie_exception.hpp"
 #include "file_utils.h"
+#include "ie_data_hash.hpp"
 #include "ie_itt.hpp"
 #include "ngraph/opsets/opset6.hpp"
 #include "ngraph/variant.hpp"
@@ -41,25 +42,14 @@ static int32_t as_int32_t(T v) {
 }
 
 class OstreamHashWrapper final : public std::streambuf {
-    std::size_t m_res = 0;
+    DataHash m_hash;
 
 public:
     std::size_t getResult() const {
-        return m_res;
+        return static_cast<std::size_t>(m_hash.digest());
     }
     std::streamsize xsputn(const char* s, std::streamsize n) override {
-        const std::int64_t* intS = (const std::int64_t*)s;
-        std::streamsize n64 = n / sizeof(std::int64_t);
-        std::streamsize i = 0;
-        // Using 64-bit values executes much faster than char
-        while (i++ < n64) {
-            m_res += *(intS++);
-        }
-
-        std::streamsize rest = n % sizeof(std::int64_t);
-        for (i = 0; i < rest; i++) {
-            m_res += s[n - rest + i];
-        }
+        m_hash.update(s, static_cast<std::size_t>(n));
         return n;
     }
 };
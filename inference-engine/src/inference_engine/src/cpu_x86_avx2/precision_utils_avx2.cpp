@@ -0,0 +1,219 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "precision_utils_avx2.hpp"
+
+#include <immintrin.h>
+#include <stdint.h>
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+namespace avx2 {
+
+namespace {
+
+// Loads 8 values of the precision converted to FP32 and stores 8 FP32 values converted to the precision
+template <Precision::ePrecision P>
+struct Vec8;
+
+template <>
+struct Vec8<Precision::U8> {
+    static __m256 load(const void* src, size_t i) {
+        auto v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(static_cast<const uint8_t*>(src) + i));
+        return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(v));
+    }
+
+    static void store(void* dst, size_t i, __m256 v) {
+        v = _mm256_min_ps(_mm256_max_ps(v, _mm256_set1_ps(0.f)), _mm256_set1_ps(255.f));
+        auto i32 = _mm256_cvttps_epi32(v);
+        auto i16 = _mm_packus_epi32(_mm256_castsi256_si128(i32), _mm256_extracti128_si256(i32, 1));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(static_cast<uint8_t*>(dst) + i), _mm_packus_epi16(i16, i16));
+    }
+};
+
+template <>
+struct Vec8<Precision::I8> {
+    static __m256 load(const void* src, size_t i) {
+        auto v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(static_cast<const int8_t*>(src) + i));
+        return _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(v));
+    }
+
+    static void store(void* dst, size_t i, __m256 v) {
+        v = _mm256_min_ps(_mm256_max_ps(v, _mm256_set1_ps(-128.f)), _mm256_set1_ps(127.f));
+        auto i32 = _mm256_cvttps_epi32(v);
+        auto i16 = _mm_packs_epi32(_mm256_castsi256_si128(i32), _mm256_extracti128_si256(i32, 1));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(static_cast<int8_t*>(dst) + i), _mm_packs_epi16(i16, i16));
+    }
+};
+
+template <>
+struct Vec8<Precision::U16> {
+    static __m256 load(const void* src, size_t i) {
+        auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(static_cast<const uint16_t*>(src) + i));
+        return _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(v));
+    }
+};
+
+template <>
+struct Vec8<Precision::I16> {
+    static __m256 load(const void* src, size_t i) {
+        auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(static_cast<const int16_t*>(src) + i));
+        return _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(v));
+    }
+};
+
+template <>
+struct Vec8<Precision::I32> {
+    static __m256 load(const void* src, size_t i) {
+        auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(static_cast<const int32_t*>(src) + i));
+        return _mm256_cvtepi32_ps(v);
+    }
+
+    static void store(void* dst, size_t i, __m256 v) {
+        // 2147483520 is the largest FP32 value below 2^31
+        v = _mm256_min_ps(_mm256_max_ps(v, _mm256_set1_ps(-2147483648.f)), _mm256_set1_ps(2147483520.f));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(static_cast<int32_t*>(dst) + i), _mm256_cvttps_epi32(v));
+    }
+};
+
+template <>
+struct Vec8<Precision::FP16> {
+    static __m256 load(const void* src, size_t i) {
+        return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(static_cast<const int16_t*>(src) + i)));
+    }
+
+    // vcvtps2ph rounds to the nearest even and produces infinities and denormals, so the rounding of f32tof16
+    // is repeated instead: the values are rounded half away from zero, saturated and the denormals are flushed
+    static void store(void* dst, size_t i, __m256 v) {
+        const auto u = _mm256_castps_si256(v);
+        const auto expMask = _mm256_set1_epi32(0x7F800000);
+        const auto sign = _mm256_and_si256(_mm256_srli_epi32(u, 16), _mm256_set1_epi32(0x8000));
+        const auto abs = _mm256_and_si256(u, _mm256_set1_epi32(0x7FFFFFFF));
+
+        const auto isNanInf = _mm256_cmpeq_epi32(_mm256_and_si256(abs, expMask), expMask);
+        const auto isNan = _mm256_cmpgt_epi32(abs, expMask);
+        const auto nan = _mm256_or_si256(_mm256_srli_epi32(abs, 23 - 10), _mm256_set1_epi32(0x0200));
+        const auto nanInf = _mm256_blendv_epi8(_mm256_set1_epi32(0x7C00), nan, isNan);
+
+        const auto halfULP = _mm256_mul_ps(_mm256_castsi256_ps(_mm256_and_si256(abs, expMask)),
+                                           _mm256_castsi256_ps(_mm256_set1_epi32((127 - 11) << 23)));
+        const auto rounded = _mm256_add_ps(_mm256_castsi256_ps(abs), halfULP);
+
+        const auto min16 = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 14) << 23));
+        const auto max16 = _mm256_castsi256_ps(_mm256_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+        auto res = _mm256_srli_epi32(_mm256_sub_epi32(_mm256_castps_si256(rounded), _mm256_set1_epi32((127 - 15) << 23)),
+                                     23 - 10);
+        res = _mm256_blendv_epi8(res, _mm256_set1_epi32(((15 + 15) << 10) | 0x3FF),
+                                 _mm256_castps_si256(_mm256_cmp_ps(rounded, max16, _CMP_GE_OQ)));
+        res = _mm256_blendv_epi8(res, _mm256_set1_epi32(1 << 10),
+                                 _mm256_castps_si256(_mm256_cmp_ps(rounded, min16, _CMP_LT_OQ)));
+        res = _mm256_blendv_epi8(res, _mm256_setzero_si256(),
+                                 _mm256_castps_si256(_mm256_cmp_ps(rounded, _mm256_mul_ps(min16, _mm256_set1_ps(0.5f)),
+                                                                   _CMP_LT_OQ)));
+        res = _mm256_blendv_epi8(res, nanInf, isNanInf);
+        res = _mm256_and_si256(_mm256_or_si256(res, sign), _mm256_set1_epi32(0xFFFF));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(static_cast<int16_t*>(dst) + i),
+                         _mm_packus_epi32(_mm256_castsi256_si128(res), _mm256_extracti128_si256(res, 1)));
+    }
+};
+
+template <>
+struct Vec8<Precision::BF16> {
+    static __m256 load(const void* src, size_t i) {
+        auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(static_cast<const uint16_t*>(src) + i));
+        return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(v), 16));
+    }
+
+    // vcvtneps2bf16 of AVX512_BF16 rounds differently from the BF16 type of the CPU plugin, so its rounding is repeated
+    static void store(void* dst, size_t i, __m256 v) {
+        const auto u = _mm256_castps_si256(v);
+        const auto lsb = _mm256_srli_epi32(_mm256_and_si256(u, _mm256_set1_epi32(0x00010000)), 1);
+        const auto res = _mm256_srli_epi32(_mm256_add_epi32(u, lsb), 16);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(static_cast<uint16_t*>(dst) + i),
+                         _mm_packus_epi32(_mm256_castsi256_si128(res), _mm256_extracti128_si256(res, 1)));
+    }
+};
+
+template <>
+struct Vec8<Precision::FP32> {
+    static __m256 load(const void* src, size_t i) {
+        return _mm256_loadu_ps(static_cast<const float*>(src) + i);
+    }
+
+    static void store(void* dst, size_t i, __m256 v) {
+        _mm256_storeu_ps(static_cast<float*>(dst) + i, v);
+    }
+};
+
+template <Precision::ePrecision S, Precision::ePrecision D>
+size_t convert(void* dst, const void* src, size_t nelem, float scale, float bias) {
+    const size_t count = nelem - nelem % 8;
+    if (scale == 1.f && bias == 0.f) {
+        for (size_t i = 0; i < count; i += 8)
+            Vec8<D>::store(dst, i, Vec8<S>::load(src, i));
+    } else {
+        // not fused to get the same results as the scalar code
+        const auto vscale = _mm256_set1_ps(scale);
+        const auto vbias = _mm256_set1_ps(bias);
+        for (size_t i = 0; i < count; i += 8)
+            Vec8<D>::store(dst, i, _mm256_add_ps(_mm256_mul_ps(Vec8<S>::load(src, i), vscale), vbias));
+    }
+    return count;
+}
+
+template <Precision::ePrecision S>
+size_t convertFrom(void* dst, Precision dstPrc, const void* src, size_t nelem, float scale, float bias) {
+    switch (dstPrc) {
+    case Precision::U8:
+        return convert<S, Precision::U8>(dst, src, nelem, scale, bias);
+    case Precision::I8:
+        return convert<S, Precision::I8>(dst, src, nelem, scale, bias);
+    case Precision::I32:
+        return convert<S, Precision::I32>(dst, src, nelem, scale, bias);
+    case Precision::FP16:
+        return convert<S, Precision::FP16>(dst, src, nelem, scale, bias);
+    case Precision::BF16:
+        return convert<S, Precision::BF16>(dst, src, nelem, scale, bias);
+    case Precision::FP32:
+        return convert<S, Precision::FP32>(dst, src, nelem, scale, bias);
+    default:
+        return 0;
+    }
+}
+
+}  // namespace
+
+size_t convertArrays(void* dst,
+                     Precision dstPrc,
+                     const void* src,
+                     Precision srcPrc,
+                     size_t nelem,
+                     float scale,
+                     float bias) {
+    switch (srcPrc) {
+    case Precision::U8:
+        return convertFrom<Precision::U8>(dst, dstPrc, src, nelem, scale, bias);
+    case Precision::I8:
+        return convertFrom<Precision::I8>(dst, dstPrc, src, nelem, scale, bias);
+    case Precision::U16:
+        return convertFrom<Precision::U16>(dst, dstPrc, src, nelem, scale, bias);
+    case Precision::I16:
+        return convertFrom<Precision::I16>(dst, dstPrc, src, nelem, scale, bias);
+    case Precision::I32:
+        return convertFrom<Precision::I32>(dst, dstPrc, src, nelem, scale, bias);
+    case Precision::FP16:
+        return convertFrom<Precision::FP16>(dst, dstPrc, src, nelem, scale, bias);
+    case Precision::BF16:
+        return convertFrom<Precision::BF16>(dst, dstPrc, src, nelem, scale, bias);
+    case Precision::FP32:
+        return convertFrom<Precision::FP32>(dst, dstPrc, src, nelem, scale, bias);
+    default:
+        return 0;
+    }
+}
+
+}  // namespace avx2
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
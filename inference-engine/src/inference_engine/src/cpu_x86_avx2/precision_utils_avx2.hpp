@@ -0,0 +1,36 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stddef.h>
+
+#include "ie_precision.hpp"
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+namespace avx2 {
+
+//------------------------------------------------------------------------
+//
+// Precision conversion manually vectored for AVX2 and F16C (w/o threads)
+//
+//------------------------------------------------------------------------
+
+/**
+ * Converts the leading elements of the arrays by groups of 8 elements, the pair of precisions must be supported
+ * by PrecisionUtils::convertArrays. The results are the same as the ones of the scalar conversion.
+ * @return the number of the converted elements, the rest ones must be converted by the caller
+ */
+size_t convertArrays(void* dst,
+                     Precision dstPrc,
+                     const void* src,
+                     Precision srcPrc,
+                     size_t nelem,
+                     float scale,
+                     float bias);
+
+}  // namespace avx2
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
@@ -28,6 +28,7 @@
 #include "ngraph/opsets/opset.hpp"
 #include "ngraph/pass/constant_folding.hpp"
 #include "openvino/runtime/core.hpp"
+#include "system_allocator.hpp"
 #include "xml_parse_utils.h"
 
 using namespace InferenceEngine::PluginConfigParams;
@@ -62,6 +63,9 @@ Parsed<T> parseDeviceNameIntoConfig(const std::string& deviceName, const std::ma
     } else if (deviceName_.find("MULTI:") == 0) {
         deviceName_ = "MULTI";
         config_[InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = deviceName.substr(6);
+    } else if (deviceName_.find("BATCH:") == 0) {
+        deviceName_ = "BATCH";
+        config_[InferenceEngine::AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE] = deviceName.substr(6);
     } else if (deviceName.find("AUTO") == 0) {
         deviceName_ = "MULTI";
         if (deviceName.find("AUTO:") == 0) {
@@ -146,6 +150,12 @@ class CoreImpl : public InferenceEngine::ICore, public std::enable_shared_from_t
 
                 config.erase(it);
             }
+
+            it = config.find(CONFIG_KEY(BLOB_ALLOCATOR));
+            if (it != config.end()) {
+                InferenceEngine::SetDefaultAllocatorType(it->second);
+                config.erase(it);
+            }
         }
 
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
@@ -442,6 +452,15 @@ public:
         return InferenceEngine::details::ReadNetwork(model, weights, extensions);
     }
 
+    InferenceEngine::CNNNetwork ReadNetwork(const std::string& model,
+                                            const InferenceEngine::Blob::CPtr& weights,
+                                            const std::vector<InferenceEngine::IExtensionPtr>& exts) const override {
+        OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::ReadNetwork from memory with extensions");
+        auto allExtensions = extensions;
+        allExtensions.insert(allExtensions.end(), exts.begin(), exts.end());
+        return InferenceEngine::details::ReadNetwork(model, weights, allExtensions);
+    }
+
     // TODO: In future this method can be added to ICore interface
     InferenceEngine::SoExecutableNetworkInternal LoadNetwork(const InferenceEngine::CNNNetwork& network,
                                                              const InferenceEngine::RemoteContext::Ptr& context,
@@ -578,6 +597,15 @@ public:
             }
         }
 
+        // BATCH case
+        {
+            if (deviceName.find("BATCH:") == 0) {
+                IE_THROW()
+                    << "You can get specific metrics with the GetMetric only for the BATCH itself (without devices). "
+                       "To get individual devices's metrics call GetMetric for each device separately";
+            }
+        }
+
         // AUTO case
         {
             if (deviceName.find("AUTO:") == 0) {
@@ -869,6 +897,12 @@ public:
                     deviceNames = InferenceEngine::DeviceIDParser::getMultiDevices(deviceName.substr(pos + 1));
                 }
                 deviceNames.push_back("MULTI");
+            } else if (deviceName.find("BATCH") == 0) {
+                auto pos = deviceName.find_first_of(":");
+                if (pos != std::string::npos) {
+                    deviceNames.push_back(deviceName.substr(pos + 1, deviceName.find_first_of("(") - pos - 1));
+                }
+                deviceNames.push_back("BATCH");
             } else if (deviceName.find("AUTO") == 0) {
                 auto pos = deviceName.find_first_of(":");
                 if (pos != std::string::npos) {
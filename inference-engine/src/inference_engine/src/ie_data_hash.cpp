@@ -0,0 +1,185 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_data_hash.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "ie_parallel.hpp"
+
+namespace InferenceEngine {
+
+namespace {
+
+// xxHash64 by Yann Collet, the main loop keeps four independent accumulators
+// which are processed in parallel by the out-of-order core
+
+constexpr uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t prime3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t read32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t mixRound(uint64_t acc, uint64_t input) {
+    acc += input * prime2;
+    acc = rotl(acc, 31);
+    return acc * prime1;
+}
+
+inline uint64_t mergeRound(uint64_t acc, uint64_t val) {
+    acc ^= mixRound(0, val);
+    return acc * prime1 + prime4;
+}
+
+inline uint64_t avalanche(uint64_t h) {
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+}
+
+uint64_t xxhash64(const uint8_t* p, size_t size, uint64_t seed) {
+    const uint8_t* const end = p + size;
+    uint64_t h;
+
+    if (size >= 32) {
+        const uint8_t* const limit = end - 32;
+        uint64_t v1 = seed + prime1 + prime2;
+        uint64_t v2 = seed + prime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - prime1;
+        do {
+            v1 = mixRound(v1, read64(p));
+            v2 = mixRound(v2, read64(p + 8));
+            v3 = mixRound(v3, read64(p + 16));
+            v4 = mixRound(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = mergeRound(h, v1);
+        h = mergeRound(h, v2);
+        h = mergeRound(h, v3);
+        h = mergeRound(h, v4);
+    } else {
+        h = seed + prime5;
+    }
+
+    h += static_cast<uint64_t>(size);
+
+    for (; end - p >= 8; p += 8) {
+        h ^= mixRound(0, read64(p));
+        h = rotl(h, 27) * prime1 + prime4;
+    }
+    if (end - p >= 4) {
+        h ^= static_cast<uint64_t>(read32(p)) * prime1;
+        h = rotl(h, 23) * prime2 + prime3;
+        p += 4;
+    }
+    for (; p < end; ++p) {
+        h ^= (*p) * prime5;
+        h = rotl(h, 11) * prime1;
+    }
+
+    return avalanche(h);
+}
+
+uint64_t finalize(uint64_t state, uint64_t totalSize, const uint8_t* tail, size_t tailSize) {
+    return avalanche(state ^ xxhash64(tail, tailSize, totalSize));
+}
+
+}  // namespace
+
+constexpr std::size_t DataHash::blockSize;
+
+class DataHash::Impl {
+public:
+    void combine(uint64_t blockDigest) {
+        state ^= mixRound(0, blockDigest);
+        state = rotl(state, 27) * prime1 + prime4;
+    }
+
+    uint64_t state = 0;
+    uint64_t totalSize = 0;
+    std::vector<uint8_t> tail;
+};
+
+DataHash::DataHash() : _impl(new Impl) {}
+
+DataHash::DataHash(DataHash&&) noexcept = default;
+
+DataHash& DataHash::operator=(DataHash&&) noexcept = default;
+
+DataHash::~DataHash() = default;
+
+void DataHash::update(const void* data, std::size_t size) {
+    auto bytes = static_cast<const uint8_t*>(data);
+    auto& tail = _impl->tail;
+    _impl->totalSize += size;
+
+    if (!tail.empty()) {
+        const size_t count = std::min(blockSize - tail.size(), size);
+        tail.insert(tail.end(), bytes, bytes + count);
+        bytes += count;
+        size -= count;
+        if (tail.size() < blockSize)
+            return;
+        _impl->combine(xxhash64(tail.data(), blockSize, 0));
+        tail.clear();
+    }
+
+    const size_t blocks = size / blockSize;
+    if (blocks > 1) {
+        std::vector<uint64_t> digests(blocks);
+        parallel_for(blocks, [&](size_t b) {
+            digests[b] = xxhash64(bytes + b * blockSize, blockSize, 0);
+        });
+        for (auto digest : digests)
+            _impl->combine(digest);
+    } else if (blocks == 1) {
+        _impl->combine(xxhash64(bytes, blockSize, 0));
+    }
+    bytes += blocks * blockSize;
+    size -= blocks * blockSize;
+
+    tail.assign(bytes, bytes + size);
+}
+
+std::uint64_t DataHash::digest() const {
+    return finalize(_impl->state, _impl->totalSize, _impl->tail.data(), _impl->tail.size());
+}
+
+std::uint64_t DataHash::hash(const void* data, std::size_t size) {
+    // the tail is hashed in place instead of being buffered by update()
+    const size_t blocksSize = size - size % blockSize;
+    DataHash hasher;
+    hasher.update(data, blocksSize);
+    return finalize(hasher._impl->state, size, static_cast<const uint8_t*>(data) + blocksSize, size - blocksSize);
+}
+
+std::uint64_t DataHash::xxHash64(const void* data, std::size_t size, std::uint64_t seed) {
+    return xxhash64(static_cast<const uint8_t*>(data), size, seed);
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,61 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_mmap_blob.hpp"
+
+#include <memory>
+
+#include <ngraph/runtime/mapped_memory.hpp>
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+/**
+ * @brief Allocator which keeps a read-only file mapping alive. alloc() hands out the mapped region,
+ * locking it for write fails, so the mapping is never written.
+ */
+class MappedFileAllocator : public IAllocator {
+public:
+    explicit MappedFileAllocator(std::shared_ptr<ngraph::runtime::MappedMemory> memory) : _memory(std::move(memory)) {}
+
+    void* lock(void* handle, LockOp op = LOCK_FOR_WRITE) noexcept override {
+        return op == LOCK_FOR_WRITE ? nullptr : handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        // IAllocator hands out non-const handles, they are only dereferenced through read locks
+        return size <= _memory->size() ? const_cast<char*>(_memory->data()) : nullptr;
+    }
+
+    bool free(void* handle) noexcept override {
+        return handle == _memory->data();
+    }
+
+private:
+    std::shared_ptr<ngraph::runtime::MappedMemory> _memory;
+};
+
+}  // namespace
+
+Blob::CPtr CreateMappedBlob(const std::string& path) noexcept {
+    try {
+        auto memory = ngraph::runtime::MappedMemory::map_file(path);
+        if (!memory)
+            return nullptr;
+        const auto size = memory->size();
+        auto blob = make_shared_blob<uint8_t>({Precision::U8, {size}, Layout::C},
+                                              std::make_shared<MappedFileAllocator>(std::move(memory)));
+        blob->allocate();
+        return blob;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
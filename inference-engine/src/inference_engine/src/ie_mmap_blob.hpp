@@ -0,0 +1,24 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+
+#include "ie_blob.h"
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Creates constant U8 blob which references a read-only memory-mapped file instead of a heap copy of it.
+ * Pages are loaded on demand and stay shared through the page cache with other processes mapping the same file.
+ * The mapping is shared with ngraph::runtime::MappedMemory::map_file, the blob can't be locked for write.
+ * @param path path to the file
+ * @return mapped blob or nullptr if memory mapping is not supported on the platform or failed
+ */
+Blob::CPtr CreateMappedBlob(const std::string& path) noexcept;
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -14,6 +14,7 @@
 #include "frontend_manager/frontend_manager.hpp"
 #include "ie_ir_version.hpp"
 #include "ie_itt.hpp"
+#include "ie_mmap_blob.hpp"
 #include "ie_reader.hpp"
 
 namespace InferenceEngine {
@@ -206,28 +207,33 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath,
                 }
             }
             if (!bPath.empty()) {
-                // Open weights file
+                Blob::CPtr weights;
+                {
+                    OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "ReadNetworkWeights");
+                    // Map weights file to avoid a heap copy of the whole file; constants reference the mapping
+                    weights = details::CreateMappedBlob(bPath);
+                    if (!weights) {
+                        // Open weights file
 #if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-                std::wstring weights_path = FileUtils::multiByteCharToWString(bPath.c_str());
+                        std::wstring weights_path = FileUtils::multiByteCharToWString(bPath.c_str());
 #else
-                std::string weights_path = bPath;
+                        std::string weights_path = bPath;
 #endif
-                std::ifstream binStream;
-                binStream.open(weights_path, std::ios::binary);
-                if (!binStream.is_open())
-                    IE_THROW() << "Weights file " << bPath << " cannot be opened!";
-
-                binStream.seekg(0, std::ios::end);
-                size_t fileSize = binStream.tellg();
-                binStream.seekg(0, std::ios::beg);
-
-                Blob::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, {fileSize}, C});
-
-                {
-                    OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "ReadNetworkWeights");
-                    weights->allocate();
-                    binStream.read(weights->buffer(), fileSize);
-                    binStream.close();
+                        std::ifstream binStream;
+                        binStream.open(weights_path, std::ios::binary);
+                        if (!binStream.is_open())
+                            IE_THROW() << "Weights file " << bPath << " cannot be opened!";
+
+                        binStream.seekg(0, std::ios::end);
+                        size_t fileSize = binStream.tellg();
+                        binStream.seekg(0, std::ios::beg);
+
+                        auto fileWeights = make_shared_blob<uint8_t>({Precision::U8, {fileSize}, C});
+                        fileWeights->allocate();
+                        binStream.read(fileWeights->buffer(), fileSize);
+                        binStream.close();
+                        weights = fileWeights;
+                    }
                 }
 
                 // read model with weights
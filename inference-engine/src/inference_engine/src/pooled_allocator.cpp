@@ -0,0 +1,200 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pooled_allocator.hpp"
+
+#ifdef _WIN32
+#    include <malloc.h>
+#else
+#    include <sys/mman.h>
+#    include <unistd.h>
+#    include <cstdlib>
+#    ifdef __linux__
+#        include <sched.h>
+#        include <sys/syscall.h>
+#    endif
+#endif
+
+#include <algorithm>
+#include <cstdint>
+
+namespace InferenceEngine {
+
+namespace {
+
+constexpr std::size_t pageSize = 4096;
+
+std::size_t roundUp(std::size_t size, std::size_t step) {
+    return (size + step - 1) / step * step;
+}
+
+// called for every allocation, so the vDSO backed wrapper of glibc is preferred over the system call
+int currentNumaNode() {
+#if defined(__linux__) && defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 29))
+    unsigned cpu = 0, node = 0;
+    if (::getcpu(&cpu, &node) == 0)
+        return static_cast<int>(node);
+#elif defined(__linux__) && defined(SYS_getcpu)
+    unsigned cpu = 0, node = 0;
+    if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+        return static_cast<int>(node);
+#endif
+    return 0;
+}
+
+// the kernel places a page on the NUMA node of the thread which touches it first
+void firstTouch(void* ptr, std::size_t size) {
+    auto bytes = static_cast<volatile std::uint8_t*>(ptr);
+    for (std::size_t offset = 0; offset < size; offset += pageSize)
+        bytes[offset] = 0;
+}
+
+}  // namespace
+
+constexpr std::size_t PooledMemoryAllocator::cacheLineSize;
+constexpr std::size_t PooledMemoryAllocator::hugePageSize;
+
+PooledMemoryAllocator::PooledMemoryAllocator(bool hugePages, std::size_t maxCachedBytes)
+    : _hugePages(hugePages),
+      _maxCachedBytes(maxCachedBytes) {}
+
+PooledMemoryAllocator::~PooledMemoryAllocator() {
+    for (auto&& block : _blocks)
+        releaseBlock(block.first, block.second.capacity);
+}
+
+std::size_t PooledMemoryAllocator::sizeClass(std::size_t size) {
+    if (size <= cacheLineSize)
+        return cacheLineSize;
+
+    int log2 = 0;
+    for (auto value = size - 1; value > 1; value >>= 1)
+        log2++;
+    const std::size_t step = std::max(cacheLineSize, std::size_t(1) << (log2 - 2));
+    const auto capacity = roundUp(size, step);
+    return capacity >= hugePageSize ? roundUp(capacity, hugePageSize) : capacity;
+}
+
+void* PooledMemoryAllocator::allocateBlock(std::size_t capacity) noexcept {
+    void* ptr = nullptr;
+#ifdef _WIN32
+    ptr = _aligned_malloc(capacity, capacity >= hugePageSize ? hugePageSize : cacheLineSize);
+#else
+    if (capacity >= hugePageSize) {
+        ptr = MAP_FAILED;
+#    ifdef MAP_HUGETLB
+        // succeeds only if huge pages are reserved in the system
+        if (_hugePages)
+            ptr = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#    endif
+        if (ptr == MAP_FAILED) {
+            // the mapping is only page aligned, so a hugePageSize aligned region is cut out of a larger one
+            const auto mappedSize = capacity + hugePageSize;
+            auto base = static_cast<std::uint8_t*>(
+                ::mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+            if (base == MAP_FAILED)
+                return nullptr;
+            auto aligned = reinterpret_cast<std::uint8_t*>(
+                roundUp(reinterpret_cast<std::uintptr_t>(base), hugePageSize));
+            const std::size_t head = aligned - base;
+            if (head != 0)
+                ::munmap(base, head);
+            if (hugePageSize - head != 0)
+                ::munmap(aligned + capacity, hugePageSize - head);
+            ptr = aligned;
+#    ifdef MADV_HUGEPAGE
+            if (_hugePages)
+                ::madvise(ptr, capacity, MADV_HUGEPAGE);
+#    endif
+        }
+    } else if (::posix_memalign(&ptr, cacheLineSize, capacity) != 0) {
+        ptr = nullptr;
+    }
+#endif
+    if (ptr != nullptr)
+        firstTouch(ptr, capacity);
+    return ptr;
+}
+
+void PooledMemoryAllocator::releaseBlock(void* ptr, std::size_t capacity) noexcept {
+#ifdef _WIN32
+    (void)capacity;
+    _aligned_free(ptr);
+#else
+    if (capacity >= hugePageSize)
+        ::munmap(ptr, capacity);
+    else
+        std::free(ptr);
+#endif
+}
+
+void* PooledMemoryAllocator::alloc(std::size_t size) noexcept {
+    const auto capacity = sizeClass(size);
+    const auto numaNode = currentNumaNode();
+    void* ptr = nullptr;
+    try {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            auto pool = _pools.find({numaNode, capacity});
+            if (pool != _pools.end() && !pool->second.empty()) {
+                ptr = pool->second.back();
+                pool->second.pop_back();
+                _cachedBytes -= capacity;
+                return ptr;
+            }
+        }
+
+        ptr = allocateBlock(capacity);
+        if (ptr == nullptr)
+            return nullptr;
+
+        std::lock_guard<std::mutex> lock{_mutex};
+        _blocks.emplace(ptr, Block{capacity, numaNode});
+        return ptr;
+    } catch (...) {
+        if (ptr != nullptr)
+            releaseBlock(ptr, capacity);
+        return nullptr;
+    }
+}
+
+bool PooledMemoryAllocator::free(void* handle) noexcept {
+    if (handle == nullptr)
+        return true;
+
+    Block block{0, 0};
+    try {
+        std::lock_guard<std::mutex> lock{_mutex};
+        auto it = _blocks.find(handle);
+        if (it == _blocks.end())
+            return false;
+        block = it->second;
+
+        if (_cachedBytes + block.capacity <= _maxCachedBytes) {
+            _pools[{block.numaNode, block.capacity}].push_back(handle);
+            _cachedBytes += block.capacity;
+            return true;
+        }
+        _blocks.erase(it);
+    } catch (...) {
+        return false;
+    }
+
+    releaseBlock(handle, block.capacity);
+    return true;
+}
+
+void PooledMemoryAllocator::trim() noexcept {
+    std::lock_guard<std::mutex> lock{_mutex};
+    for (auto&& pool : _pools) {
+        for (auto ptr : pool.second) {
+            _blocks.erase(ptr);
+            releaseBlock(ptr, pool.first.second);
+        }
+    }
+    _pools.clear();
+    _cachedBytes = 0;
+}
+
+}  // namespace InferenceEngine
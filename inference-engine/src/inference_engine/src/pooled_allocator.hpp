@@ -0,0 +1,81 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ie_allocator.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Allocator which keeps released blocks in size-class pools and hands them out again instead of going to
+ * the system allocator for every blob.
+ *
+ * Blocks are at least cache line aligned. Blocks of hugePageSize and larger are mapped directly, aligned to
+ * hugePageSize and, if requested, backed by huge pages (explicit ones if reserved, transparent otherwise).
+ * A new block is touched by the allocating thread, so its pages are placed on the NUMA node of that thread,
+ * and released blocks are pooled per NUMA node, so a stream pinned to a node gets node-local memory back.
+ */
+class PooledMemoryAllocator : public IAllocator {
+public:
+    static constexpr std::size_t cacheLineSize = 64;
+    static constexpr std::size_t hugePageSize = 2 * 1024 * 1024;
+
+    /**
+     * @param hugePages      back the large blocks by huge pages
+     * @param maxCachedBytes upper bound of the memory kept in the pools, released blocks above it are freed
+     */
+    explicit PooledMemoryAllocator(bool hugePages = false, std::size_t maxCachedBytes = std::size_t(1) << 30);
+    ~PooledMemoryAllocator();
+
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(std::size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+    /**
+     * @brief Returns all the pooled blocks to the system
+     */
+    void trim() noexcept;
+
+    /**
+     * @brief Rounds the size up to its size class, there are four classes per power of two
+     * @param size requested size in bytes
+     * @return capacity of the block which serves the request
+     */
+    static std::size_t sizeClass(std::size_t size);
+
+private:
+    struct Block {
+        std::size_t capacity;
+        int numaNode;
+    };
+
+    using PoolKey = std::pair<int, std::size_t>;
+
+    void* allocateBlock(std::size_t capacity) noexcept;
+    void releaseBlock(void* ptr, std::size_t capacity) noexcept;
+
+    const bool _hugePages;
+    const std::size_t _maxCachedBytes;
+
+    std::mutex _mutex;
+    std::unordered_map<void*, Block> _blocks;
+    std::map<PoolKey, std::vector<void*>> _pools;
+    std::size_t _cachedBytes = 0;
+};
+
+}  // namespace InferenceEngine
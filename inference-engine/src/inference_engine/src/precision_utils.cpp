@@ -6,21 +6,22 @@
 
 #include <stdint.h>
 
+#include "ie_common.h"
+#include "ie_system_conf.h"
+
+#ifdef HAVE_AVX2
+#    include "cpu_x86_avx2/precision_utils_avx2.hpp"
+#endif
+
 namespace InferenceEngine {
 namespace PrecisionUtils {
 
 void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
-    const ie_fp16* _src = reinterpret_cast<const ie_fp16*>(src);
-
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
-    }
+    convertArrays(dst, Precision::FP32, src, Precision::FP16, nelem, scale, bias);
 }
 
 void f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
-    }
+    convertArrays(dst, Precision::FP16, src, Precision::FP32, nelem, scale, bias);
 }
 
 // Function to convert F32 into F16
@@ -163,5 +164,154 @@ ie_fp16 f32tof16(float x) {
     return v.u | s;
 }
 
+namespace {
+
+// Converts a value of the precision to FP32 and a FP32 value to the precision, the vectored code must give the
+// same results
+template <Precision::ePrecision P>
+struct Scalar {
+    using value_type = typename PrecisionTrait<P>::value_type;
+
+    static float load(const void* src, size_t i) {
+        return static_cast<float>(static_cast<const value_type*>(src)[i]);
+    }
+
+    // NaN is converted to the lowest value as by vmaxps
+    static void store(void* dst, size_t i, float v) {
+        const float lowest = static_cast<float>(std::numeric_limits<value_type>::lowest());
+        // 2147483520 is the largest FP32 value below 2^31
+        const float max = std::is_same<value_type, int32_t>::value ? 2147483520.f
+                                                                   : static_cast<float>(std::numeric_limits<value_type>::max());
+        v = v > lowest ? v : lowest;
+        v = v < max ? v : max;
+        static_cast<value_type*>(dst)[i] = static_cast<value_type>(v);
+    }
+};
+
+template <>
+struct Scalar<Precision::FP16> {
+    static float load(const void* src, size_t i) {
+        return f16tof32(static_cast<const ie_fp16*>(src)[i]);
+    }
+
+    static void store(void* dst, size_t i, float v) {
+        static_cast<ie_fp16*>(dst)[i] = f32tof16(v);
+    }
+};
+
+template <>
+struct Scalar<Precision::BF16> {
+    static float load(const void* src, size_t i) {
+        return asfloat(static_cast<uint32_t>(static_cast<const uint16_t*>(src)[i]) << 16);
+    }
+
+    // the rounding of the BF16 type of the CPU plugin
+    static void store(void* dst, size_t i, float v) {
+        union {
+            float f;
+            uint32_t u;
+        } bits;
+        bits.f = v;
+        static_cast<uint16_t*>(dst)[i] = static_cast<uint16_t>((bits.u + ((bits.u & 0x00010000) >> 1)) >> 16);
+    }
+};
+
+template <>
+struct Scalar<Precision::FP32> {
+    static float load(const void* src, size_t i) {
+        return static_cast<const float*>(src)[i];
+    }
+
+    static void store(void* dst, size_t i, float v) {
+        static_cast<float*>(dst)[i] = v;
+    }
+};
+
+template <Precision::ePrecision S, Precision::ePrecision D>
+void convert(void* dst, const void* src, size_t start, size_t end, float scale, float bias) {
+    if (scale == 1.f && bias == 0.f) {
+        for (size_t i = start; i < end; i++)
+            Scalar<D>::store(dst, i, Scalar<S>::load(src, i));
+    } else {
+        for (size_t i = start; i < end; i++) {
+            const float scaled = Scalar<S>::load(src, i) * scale;
+            Scalar<D>::store(dst, i, scaled + bias);
+        }
+    }
+}
+
+template <Precision::ePrecision S>
+void convertFrom(void* dst, Precision dstPrc, const void* src, size_t start, size_t end, float scale, float bias) {
+    switch (dstPrc) {
+    case Precision::U8:
+        return convert<S, Precision::U8>(dst, src, start, end, scale, bias);
+    case Precision::I8:
+        return convert<S, Precision::I8>(dst, src, start, end, scale, bias);
+    case Precision::I32:
+        return convert<S, Precision::I32>(dst, src, start, end, scale, bias);
+    case Precision::FP16:
+        return convert<S, Precision::FP16>(dst, src, start, end, scale, bias);
+    case Precision::BF16:
+        return convert<S, Precision::BF16>(dst, src, start, end, scale, bias);
+    case Precision::FP32:
+        return convert<S, Precision::FP32>(dst, src, start, end, scale, bias);
+    default:
+        IE_THROW() << "Unsupported precision " << dstPrc << " of the destination array";
+    }
+}
+
+bool isIntegral(Precision prc) {
+    return prc == Precision::U8 || prc == Precision::I8 || prc == Precision::U16 || prc == Precision::I16 ||
+           prc == Precision::I32;
+}
+
+bool isFloatingPoint(Precision prc) {
+    return prc == Precision::FP16 || prc == Precision::BF16 || prc == Precision::FP32;
+}
+
+}  // namespace
+
+bool canConvertArrays(Precision srcPrc, Precision dstPrc) {
+    const bool srcSupported = isIntegral(srcPrc) || isFloatingPoint(srcPrc);
+    const bool dstSupported = dstPrc != Precision::U16 && dstPrc != Precision::I16 &&
+                              (isIntegral(dstPrc) || isFloatingPoint(dstPrc));
+    return srcSupported && dstSupported && srcPrc != dstPrc && (isFloatingPoint(srcPrc) || isFloatingPoint(dstPrc));
+}
+
+void convertArrays(void* dst, Precision dstPrc, const void* src, Precision srcPrc, size_t nelem, float scale,
+                   float bias) {
+    if (!canConvertArrays(srcPrc, dstPrc))
+        IE_THROW() << "Conversion of the arrays from " << srcPrc << " to " << dstPrc << " is not supported";
+
+    size_t start = 0;
+#ifdef HAVE_AVX2
+    // all the CPUs with AVX2 support F16C
+    static const bool useAvx2 = with_cpu_x86_avx2();
+    if (useAvx2)
+        start = avx2::convertArrays(dst, dstPrc, src, srcPrc, nelem, scale, bias);
+#endif
+
+    switch (srcPrc) {
+    case Precision::U8:
+        return convertFrom<Precision::U8>(dst, dstPrc, src, start, nelem, scale, bias);
+    case Precision::I8:
+        return convertFrom<Precision::I8>(dst, dstPrc, src, start, nelem, scale, bias);
+    case Precision::U16:
+        return convertFrom<Precision::U16>(dst, dstPrc, src, start, nelem, scale, bias);
+    case Precision::I16:
+        return convertFrom<Precision::I16>(dst, dstPrc, src, start, nelem, scale, bias);
+    case Precision::I32:
+        return convertFrom<Precision::I32>(dst, dstPrc, src, start, nelem, scale, bias);
+    case Precision::FP16:
+        return convertFrom<Precision::FP16>(dst, dstPrc, src, start, nelem, scale, bias);
+    case Precision::BF16:
+        return convertFrom<Precision::BF16>(dst, dstPrc, src, start, nelem, scale, bias);
+    case Precision::FP32:
+        return convertFrom<Precision::FP32>(dst, dstPrc, src, start, nelem, scale, bias);
+    default:
+        IE_THROW() << "Unsupported precision " << srcPrc << " of the source array";
+    }
+}
+
 }  // namespace PrecisionUtils
 }  // namespace InferenceEngine
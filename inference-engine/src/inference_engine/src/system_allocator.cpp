@@ -4,11 +4,52 @@
 
 #include "system_allocator.hpp"
 
+#include <atomic>
+
+#include "ie_plugin_config.hpp"
+#include "pooled_allocator.hpp"
+
 namespace InferenceEngine {
 
+namespace {
+
+enum class AllocatorType { System, Pooled, PooledHugePages };
+
+std::atomic<AllocatorType> defaultAllocatorType{AllocatorType::System};
+
+// the pools are shared by all the blobs, so the pooled allocators are process-wide singletons
+std::shared_ptr<IAllocator> getPooledAllocator(bool hugePages) {
+    static auto pooled = std::make_shared<PooledMemoryAllocator>(false);
+    static auto pooledHugePages = std::make_shared<PooledMemoryAllocator>(true);
+    return hugePages ? pooledHugePages : pooled;
+}
+
+}  // namespace
+
+void SetDefaultAllocatorType(const std::string& type) {
+    if (type == CONFIG_VALUE(SYSTEM)) {
+        defaultAllocatorType = AllocatorType::System;
+    } else if (type == CONFIG_VALUE(POOLED)) {
+        defaultAllocatorType = AllocatorType::Pooled;
+    } else if (type == CONFIG_VALUE(POOLED_HUGE_PAGES)) {
+        defaultAllocatorType = AllocatorType::PooledHugePages;
+    } else {
+        IE_THROW() << "Wrong value " << type << " for property key " << CONFIG_KEY(BLOB_ALLOCATOR)
+                   << ". Expected only " << CONFIG_VALUE(SYSTEM) << "/" << CONFIG_VALUE(POOLED) << "/"
+                   << CONFIG_VALUE(POOLED_HUGE_PAGES);
+    }
+}
+
 INFERENCE_ENGINE_API_CPP(std::shared_ptr<IAllocator>) CreateDefaultAllocator() noexcept {
     try {
-        return std::make_shared<SystemMemoryAllocator>();
+        switch (defaultAllocatorType.load()) {
+        case AllocatorType::Pooled:
+            return getPooledAllocator(false);
+        case AllocatorType::PooledHugePages:
+            return getPooledAllocator(true);
+        default:
+            return std::make_shared<SystemMemoryAllocator>();
+        }
     } catch (...) {
         return nullptr;
     }
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <string>
+
 #include "ie_allocator.hpp"
 
 namespace InferenceEngine {
@@ -33,4 +35,10 @@ public:
     }
 };
 
-}  // namespace InferenceEngine
\ No newline at end of file
+/**
+ * @brief Selects the allocator returned by CreateDefaultAllocator()
+ * @param type one of CONFIG_VALUE(SYSTEM), CONFIG_VALUE(POOLED) or CONFIG_VALUE(POOLED_HUGE_PAGES)
+ */
+void SetDefaultAllocatorType(const std::string& type);
+
+}  // namespace InferenceEngine
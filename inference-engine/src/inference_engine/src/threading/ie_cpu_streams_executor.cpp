@@ -8,6 +8,7 @@
 #include <cassert>
 #include <climits>
 #include <condition_variable>
+#include <cstddef>
 #include <memory>
 #include <mutex>
 #include <openvino/itt.hpp>
@@ -25,6 +26,124 @@
 using namespace openvino;
 
 namespace InferenceEngine {
+namespace {
+/**
+ * @brief Bounded multi-producer multi-consumer queue based on the ring buffer where each cell carries a sequence
+ * number (D. Vyukov's algorithm). Producers and consumers only contend on the `_enqueuePos`/`_dequeuePos` CAS.
+ * Tasks that do not fit into the ring go to the mutex-guarded overflow queue, so `Push` never fails.
+ * The order of tasks is preserved unless the ring overflows.
+ */
+class LockFreeTaskQueue {
+public:
+    explicit LockFreeTaskQueue(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        _mask = size - 1;
+        _cells.reset(new Cell[size]);
+        for (std::size_t i = 0; i < size; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    void Push(Task task) {
+        if (!TryPush(task)) {
+            std::lock_guard<std::mutex> lock{_overflowMutex};
+            _overflow.emplace(std::move(task));
+            _overflowSize._value.fetch_add(1);
+        }
+    }
+
+    bool Pop(Task& task) {
+        if (TryPop(task)) {
+            return true;
+        }
+        if (0 != _overflowSize._value.load()) {
+            std::lock_guard<std::mutex> lock{_overflowMutex};
+            if (!_overflow.empty()) {
+                task = std::move(_overflow.front());
+                _overflow.pop();
+                _overflowSize._value.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool Empty() const {
+        return _enqueuePos._value.load() == _dequeuePos._value.load() && 0 == _overflowSize._value.load();
+    }
+
+private:
+    using Difference = std::ptrdiff_t;
+    static constexpr std::size_t cacheLineSize = 64;
+
+    struct Cell {
+        std::atomic<std::size_t> _sequence;
+        Task _task;
+    };
+
+    bool TryPush(Task& task) {
+        Cell* cell = nullptr;
+        auto pos = _enqueuePos._value.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<Difference>(sequence) - static_cast<Difference>(pos);
+            if (0 == diff) {
+                if (_enqueuePos._value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // the ring is full
+            } else {
+                pos = _enqueuePos._value.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_task = std::move(task);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPop(Task& task) {
+        Cell* cell = nullptr;
+        auto pos = _dequeuePos._value.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<Difference>(sequence) - static_cast<Difference>(pos + 1);
+            if (0 == diff) {
+                if (_dequeuePos._value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // the ring is empty
+            } else {
+                pos = _dequeuePos._value.load(std::memory_order_relaxed);
+            }
+        }
+        task = std::move(cell->_task);
+        cell->_task = nullptr;
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::unique_ptr<Cell[]> _cells;
+    std::size_t _mask = 0;
+    // producers and consumers positions are kept on the separate cache lines to avoid false sharing
+    struct PaddedCounter {
+        char _pad[cacheLineSize];
+        std::atomic<std::size_t> _value = {0};
+    };
+    PaddedCounter _enqueuePos;
+    PaddedCounter _dequeuePos;
+    PaddedCounter _overflowSize;
+    std::mutex _overflowMutex;
+    std::queue<Task> _overflow;
+};
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -215,9 +334,16 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        if (Config::TaskQueueType::LOCK_FREE == _config._taskQueueType) {
+            _lockFreeQueue.reset(new LockFreeTaskQueue{lockFreeQueueCapacity});
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
+                if (nullptr != _lockFreeQueue) {
+                    LockFreeWorkerLoop();
+                    return;
+                }
                 for (bool stopped = false; !stopped;) {
                     Task task;
                     {
@@ -238,7 +364,45 @@ struct CPUStreamsExecutor::Impl {
         }
     }
 
+    void LockFreeWorkerLoop() {
+        for (;;) {
+            Task task;
+            bool popped = _lockFreeQueue->Pop(task);
+            // tasks usually come in bursts, so spinning for a while is cheaper than a round trip through the kernel
+            for (int spin = 0; !popped && spin < lockFreeSpinCount; ++spin) {
+                std::this_thread::yield();
+                popped = _lockFreeQueue->Pop(task);
+            }
+            if (popped) {
+                Execute(task, *(_streams.local()));
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(_mutex);
+            // `Enqueue` reads `_parkedThreads` after the push, so either it sees this increment
+            // or the predicate below sees the pushed task
+            _parkedThreads.fetch_add(1);
+            _queueCondVar.wait(lock, [&] {
+                return !_lockFreeQueue->Empty() || _isStopped;
+            });
+            _parkedThreads.fetch_sub(1);
+            if (_isStopped && _lockFreeQueue->Empty()) {
+                break;
+            }
+        }
+    }
+
     void Enqueue(Task task) {
+        if (nullptr != _lockFreeQueue) {
+            _lockFreeQueue->Push(std::move(task));
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (0 != _parkedThreads.load()) {
+                // taking the mutex guarantees that the parked thread is either waiting or has not checked
+                // the predicate yet
+                { std::lock_guard<std::mutex> lock(_mutex); }
+                _queueCondVar.notify_one();
+            }
+            return;
+        }
         {
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
@@ -284,6 +448,10 @@ struct CPUStreamsExecutor::Impl {
     std::condition_variable _queueCondVar;
     std::queue<Task> _taskQueue;
     bool _isStopped = false;
+    static constexpr std::size_t lockFreeQueueCapacity = 1024;
+    static constexpr int lockFreeSpinCount = 64;
+    std::unique_ptr<LockFreeTaskQueue> _lockFreeQueue;
+    std::atomic<int> _parkedThreads = {0};
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
@@ -25,6 +25,8 @@ std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() {
         CONFIG_KEY(CPU_BIND_THREAD),
         CONFIG_KEY(CPU_THREADS_NUM),
         CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM),
+        CONFIG_KEY_INTERNAL(CPU_LOCK_FREE_TASK_QUEUE),
+        CONFIG_KEY_INTERNAL(CPU_BIND_THREAD_OFFSET),
     };
 }
 
@@ -102,6 +104,28 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                        << ". Expected only non negative numbers (#threads)";
         }
         _threadsPerStream = val_i;
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_LOCK_FREE_TASK_QUEUE)) {
+        if (value == CONFIG_VALUE(YES)) {
+            _taskQueueType = TaskQueueType::LOCK_FREE;
+        } else if (value == CONFIG_VALUE(NO)) {
+            _taskQueueType = TaskQueueType::MUTEX;
+        } else {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_LOCK_FREE_TASK_QUEUE)
+                       << ". Expected only YES/NO";
+        }
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_BIND_THREAD_OFFSET)) {
+        int val_i;
+        try {
+            val_i = std::stoi(value);
+        } catch (const std::exception&) {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_BIND_THREAD_OFFSET)
+                       << ". Expected only non negative numbers (#core)";
+        }
+        if (val_i < 0) {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_BIND_THREAD_OFFSET)
+                       << ". Expected only non negative numbers (#core)";
+        }
+        _threadBindingOffset = val_i;
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
@@ -129,6 +153,10 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) {
         return {std::to_string(_threads)};
     } else if (key == CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM)) {
         return {std::to_string(_threadsPerStream)};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_LOCK_FREE_TASK_QUEUE)) {
+        return {_taskQueueType == TaskQueueType::LOCK_FREE ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_BIND_THREAD_OFFSET)) {
+        return {std::to_string(_threadBindingOffset)};
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
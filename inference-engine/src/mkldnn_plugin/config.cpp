@@ -67,6 +67,18 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // zero and any negative value will be treated
             // as default batch size
             batchLimit = std::max(val_i, 0);
+        } else if (key == PluginConfigParams::KEY_CPU_SHAPE_CACHE_CAPACITY) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHAPE_CACHE_CAPACITY
+                           << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHAPE_CACHE_CAPACITY
+                           << ". Expected only non-negative integer numbers";
+            shapeCacheCapacity = val_i;
         } else if (key == PluginConfigParams::KEY_PERF_COUNT) {
             if (val == PluginConfigParams::YES) collectPerfCounters = true;
             else if (val == PluginConfigParams::NO) collectPerfCounters = false;
@@ -79,6 +91,24 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS
                                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES) {
+            if (val == PluginConfigParams::YES) parallelBranches = true;
+            else if (val == PluginConfigParams::NO) parallelBranches = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_LAYOUT_OPTIMIZATION) {
+            if (val == PluginConfigParams::YES) layoutOptimization = true;
+            else if (val == PluginConfigParams::NO) layoutOptimization = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_LAYOUT_OPTIMIZATION
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_COMPILE_PROFILE_NODE_COUNTS) {
+            if (val == PluginConfigParams::YES) compileProfileNodeCounts = true;
+            else if (val == PluginConfigParams::NO) compileProfileNodeCounts = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_COMPILE_PROFILE_NODE_COUNTS
+                                   << ". Expected only YES/NO";
         } else if (key.compare(PluginConfigParams::KEY_DYN_BATCH_ENABLED) == 0) {
             if (val.compare(PluginConfigParams::YES) == 0)
                 enableDynamicBatch = true;
@@ -99,6 +129,12 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 lpTransformsMode = LPTransformsMode::On;
             else
                 IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE;
+        } else if (key == PluginConfigInternalParams::KEY_SNIPPETS_MODE) {
+            if (val == PluginConfigParams::YES) snippetsMode = true;
+            else if (val == PluginConfigParams::NO) snippetsMode = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_SNIPPETS_MODE
+                           << ". Expected only YES/NO";
         } else if (key == PluginConfigParams::KEY_ENFORCE_BF16) {
             if (val == PluginConfigParams::YES) {
                 if (with_cpu_x86_avx512_core()) {
@@ -148,12 +184,25 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS, PluginConfigParams::NO });
+        if (parallelBranches == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::NO });
+        if (layoutOptimization == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_LAYOUT_OPTIMIZATION, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_LAYOUT_OPTIMIZATION, PluginConfigParams::NO });
+        if (compileProfileNodeCounts == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_COMPILE_PROFILE_NODE_COUNTS, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_COMPILE_PROFILE_NODE_COUNTS, PluginConfigParams::NO });
         if (enableDynamicBatch == true)
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::NO });
 
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHAPE_CACHE_CAPACITY, std::to_string(shapeCacheCapacity) });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
         IE_SUPPRESS_DEPRECATED_START
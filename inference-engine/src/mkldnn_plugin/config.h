@@ -23,8 +23,13 @@ struct Config {
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool parallelBranches = false;
+    bool layoutOptimization = true;
+    bool compileProfileNodeCounts = false;
+    bool snippetsMode = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
+    int shapeCacheCapacity = 0;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
@@ -88,7 +88,8 @@ enum Type {
     ExtractImagePatches,
     NonMaxSuppression,
     MatrixNms,
-    MulticlassNms
+    MulticlassNms,
+    Subgraph
 };
 
 enum Algorithm {
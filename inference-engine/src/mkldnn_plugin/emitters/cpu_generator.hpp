@@ -0,0 +1,48 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <cpu/x64/jit_generator.hpp>
+#include "snippets/generator.hpp"
+
+namespace MKLDNNPlugin {
+
+// The code of all the emitters is generated directly into this buffer, so generate() has nothing to add
+class jit_snippet : public mkldnn::impl::cpu::x64::jit_generator {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_snippet)
+
+    ~jit_snippet() = default;
+
+    jit_snippet() : jit_generator() {}
+
+    void generate() override {}
+};
+
+class CPUTargetMachine : public ngraph::snippets::TargetMachine {
+public:
+    CPUTargetMachine(mkldnn::impl::cpu::x64::cpu_isa_t host_isa);
+
+    bool is_supported() const override;
+    ngraph::snippets::code get_snippet() const override;
+    size_t get_lanes() const override;
+
+private:
+    std::unique_ptr<jit_snippet> h;
+    mkldnn::impl::cpu::x64::cpu_isa_t isa;
+};
+
+/**
+ * @brief Snippets code generator producing the x64 code with the CPU plugin emitters for the given instruction set
+ */
+class CPUGenerator : public ngraph::snippets::Generator {
+public:
+    CPUGenerator(mkldnn::impl::cpu::x64::cpu_isa_t isa);
+    ~CPUGenerator() = default;
+};
+
+} // namespace MKLDNNPlugin
@@ -0,0 +1,266 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_snippets_emitters.hpp"
+
+#include <ngraph/variant.hpp>
+#include "snippets/op/kernel.hpp"
+#include "snippets/op/tile.hpp"
+#include "snippets/op/scalar.hpp"
+
+using namespace mkldnn::impl::utils;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_snippets_call_args, field)
+
+namespace MKLDNNPlugin {
+
+/// KERNEL ///
+KernelEmitter::KernelEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n), code(ngraph::as_type_ptr<ngraph::snippets::op::Kernel>(n)->region) {}
+
+void KernelEmitter::emit_code(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                              const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs) const {
+    const size_t num_params = in_idxs[0] + in_idxs[1];
+    if (num_params > max_snippet_args)
+        throw ngraph::ngraph_error("snippet kernel can't have more than " + std::to_string(max_snippet_args) + " arguments");
+
+    h->preamble();
+
+    for (size_t i = 0; i < num_params; i++)
+        h->mov(Reg64(static_cast<int>(reg64_tmp_start + i)), h->ptr[abi_param1 + GET_OFF(ptrs) + i * sizeof(void*)]);
+    h->mov(Reg64(static_cast<int>(reg64_tmp_start + num_params)), h->ptr[abi_param1 + GET_OFF(work_amount)]);
+
+    for (const auto& c : code)
+        c.first->emit_code(c.second.first, c.second.second, pool_vec_idxs, pool_gpr_idxs);
+
+    h->postamble();
+}
+
+/// TILE ///
+TileEmitter::TileEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n), code(ngraph::as_type_ptr<ngraph::snippets::op::Tile>(n)->region) {}
+
+void TileEmitter::emit_code(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                            const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs) const {
+    const size_t inc = in_idxs[0];
+    const size_t num_params = in_idxs[1];
+    Reg64 amount = Reg64(static_cast<int>(reg64_tmp_start + num_params));
+
+    // vector registers which are not referenced by the body are free, so the emitters may use them as auxiliary ones
+    // instead of spilling the allocated registers to the stack
+    std::vector<bool> is_used(get_max_vecs_count(), false);
+    for (const auto& c : code) {
+        for (auto idx : c.second.first)
+            is_used[idx] = true;
+        for (auto idx : c.second.second)
+            is_used[idx] = true;
+    }
+    std::vector<size_t> vec_pool;
+    for (size_t idx = 0; idx < is_used.size(); idx++) {
+        if (!is_used[idx])
+            vec_pool.push_back(idx);
+    }
+
+    Label for_body;
+    Label for_end;
+
+    h->L(for_body);
+    h->cmp(amount, inc);
+    h->jl(for_end, CodeGenerator::T_NEAR);
+
+    for (const auto& c : code)
+        c.first->emit_code(c.second.first, c.second.second, vec_pool, {});
+
+    h->sub(amount, inc);
+    h->jmp(for_body, CodeGenerator::T_NEAR);
+    h->L(for_end);
+}
+
+/// FAKE BROADCAST ///
+FakeBroadcastEmitter::FakeBroadcastEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    use_broadcast = n->get_input_shape(0).back() != n->get_output_shape(0).back();
+}
+
+void FakeBroadcastEmitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                     const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                     const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_idxs, out_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void FakeBroadcastEmitter::emit_isa(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_src0 = Vmm(in_idxs[0]);
+    Vmm vmm_dst = Vmm(out_idxs[0]);
+
+    if (use_broadcast) {
+        h->uni_vbroadcastss(vmm_dst, Xmm(in_idxs[0]));
+    } else if (in_idxs[0] != out_idxs[0]) {
+        h->uni_vmovups(vmm_dst, vmm_src0);
+    }
+}
+
+/// SCALAR ///
+ScalarEmitter::ScalarEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    value = float2int(ngraph::as_type_ptr<ngraph::snippets::op::Scalar>(n)->cast_vector<float>()[0]);
+    push_arg_entry_of("scalar", value, true);
+    prepare_table();
+}
+
+void ScalarEmitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                              const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                              const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_idxs, out_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void ScalarEmitter::emit_isa(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_dst = Vmm(out_idxs[0]);
+    // the table entry is already broadcasted to the vector length
+    h->uni_vmovups(vmm_dst, table_val("scalar"));
+}
+
+/// MEMORY ///
+MemoryEmitter::MemoryEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    auto& rt = n->get_rt_info();
+    auto it = rt.find("effectiveAddress");
+    if (it == rt.end())
+        throw ngraph::ngraph_error("effective address is not assigned for " + n->get_friendly_name());
+    ea = static_cast<size_t>(ngraph::as_type_ptr<ngraph::VariantWrapper<int64_t>>(it->second)->get());
+}
+
+/// STORE ///
+void StoreEmitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                             const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                             const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_idxs, out_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void StoreEmitter::emit_isa(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 out_reg(static_cast<int>(ea));
+    Vmm vmm_src0 = Vmm(in_idxs[0]);
+
+    h->uni_vmovups(h->ptr[out_reg], vmm_src0);
+    h->add(out_reg, get_vec_length());
+}
+
+/// SCALAR STORE ///
+void ScalarStoreEmitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                   const emitter_context *emit_context) const {
+    Reg64 out_reg(static_cast<int>(ea));
+
+    h->uni_vmovss(h->ptr[out_reg], Xmm(in_idxs[0]));
+    h->add(out_reg, sizeof(float));
+}
+
+/// LOAD ///
+LoadEmitter::LoadEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : MemoryEmitter(h, isa, n) {
+    should_post_increment = n->get_output_shape(0).back() != 1;
+}
+
+void LoadEmitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                            const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                            const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_idxs, out_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void LoadEmitter::emit_isa(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 in_reg(static_cast<int>(ea));
+    Vmm vmm_dst = Vmm(out_idxs[0]);
+
+    if (should_post_increment) {
+        h->uni_vmovups(vmm_dst, h->ptr[in_reg]);
+        h->add(in_reg, get_vec_length());
+    } else {
+        h->uni_vbroadcastss(vmm_dst, h->ptr[in_reg]);
+    }
+}
+
+/// BROADCAST LOAD ///
+void BroadcastLoadEmitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                     const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                     const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_idxs, out_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_idxs, out_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void BroadcastLoadEmitter::emit_isa(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 in_reg(static_cast<int>(ea));
+    Vmm vmm_dst = Vmm(out_idxs[0]);
+
+    // the pointer is not advanced: the same element is used for the whole row
+    h->uni_vbroadcastss(vmm_dst, h->ptr[in_reg]);
+}
+
+/// SCALAR LOAD ///
+ScalarLoadEmitter::ScalarLoadEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : MemoryEmitter(h, isa, n) {
+    should_post_increment = n->get_output_shape(0).back() != 1;
+}
+
+void ScalarLoadEmitter::emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                                  const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                  const emitter_context *emit_context) const {
+    Reg64 in_reg(static_cast<int>(ea));
+
+    h->uni_vmovss(Xmm(out_idxs[0]), h->ptr[in_reg]);
+    if (should_post_increment)
+        h->add(in_reg, sizeof(float));
+}
+
+} // namespace MKLDNNPlugin
@@ -0,0 +1,207 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "jit_emitter.hpp"
+#include "snippets/emitter.hpp"
+
+namespace MKLDNNPlugin {
+
+// snippets::Generator limits the number of the kernel arguments (inputs and outputs in total)
+static constexpr size_t max_snippet_args = 7;
+
+/**
+ * @brief Arguments of the kernel generated for a snippet: pointers to the inputs followed by pointers to the outputs
+ * and the number of elements in the innermost dimension to be processed by the call
+ */
+struct jit_snippets_call_args {
+    const void *ptrs[max_snippet_args] = {};
+    size_t work_amount = 0;
+};
+
+// snippets::pass::AssignRegisters maps the kernel arguments to R8, R9, ... in order of the inputs and then the outputs,
+// the register following the last argument is used as the loop counter
+static constexpr size_t reg64_tmp_start = 8;
+
+/// KERNEL ///
+// Loads the arguments into the registers expected by the body and emits the tiles between the function preamble and postamble
+class KernelEmitter : public jit_emitter {
+public:
+    KernelEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+    // in_idxs contain the number of inputs and the number of outputs of the snippet
+    void emit_code(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs = {}, const std::vector<size_t> &pool_gpr_idxs = {}) const override;
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override {}
+
+    std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>> code;
+};
+
+/// TILE ///
+// Loop over the innermost dimension processing the given number of elements per iteration, until the rest is less than the increment
+class TileEmitter : public jit_emitter {
+public:
+    TileEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+    // in_idxs contain the increment of the loop and the number of the kernel arguments
+    void emit_code(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs = {}, const std::vector<size_t> &pool_gpr_idxs = {}) const override;
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override {}
+
+    std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>> code;
+};
+
+/// NOP ///
+// Parameters and Results are the part of the kernel signature and do not produce any code
+class NopEmitter : public jit_emitter {
+public:
+    NopEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+        : jit_emitter(h, isa, n) {}
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override {}
+};
+
+/// FAKE BROADCAST ///
+// Broadcasts the first lane if the innermost dimension is broadcasted, the broadcasting over the outer dimensions is
+// handled by the node through the input offsets, so a plain move is enough in this case
+class FakeBroadcastEmitter : public jit_emitter {
+public:
+    FakeBroadcastEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 1; }
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs) const;
+
+    bool use_broadcast;
+};
+
+/// SCALAR ///
+class ScalarEmitter : public jit_emitter {
+public:
+    ScalarEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs) const;
+
+    int32_t value;
+};
+
+/// MEMORY ///
+// Base class for the emitters accessing the kernel arguments. The general purpose register holding the pointer is
+// assigned by snippets::pass::AssignRegisters and stored in the runtime info of the operation as the effective address
+class MemoryEmitter : public jit_emitter {
+public:
+    MemoryEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 1; }
+
+protected:
+    size_t ea;
+};
+
+class StoreEmitter : public MemoryEmitter {
+public:
+    StoreEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+        : MemoryEmitter(h, isa, n) {}
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs) const;
+};
+
+class ScalarStoreEmitter : public MemoryEmitter {
+public:
+    ScalarStoreEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+        : MemoryEmitter(h, isa, n) {}
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override;
+};
+
+// The input with the innermost dimension equal to 1 is broadcasted and the pointer is not advanced
+class LoadEmitter : public MemoryEmitter {
+public:
+    LoadEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs) const;
+
+    bool should_post_increment;
+};
+
+class BroadcastLoadEmitter : public MemoryEmitter {
+public:
+    BroadcastLoadEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+        : MemoryEmitter(h, isa, n) {}
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs) const;
+};
+
+class ScalarLoadEmitter : public MemoryEmitter {
+public:
+    ScalarLoadEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
+                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                   const emitter_context *emit_context) const override;
+
+    bool should_post_increment;
+};
+
+} // namespace MKLDNNPlugin
@@ -10,6 +10,7 @@
 #include "mkldnn_infer_request.h"
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
+#include "mkldnn_serialize.h"
 #include "nodes/mkldnn_memory_node.hpp"
 #include <threading/ie_executor_manager.hpp>
 #if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
@@ -21,8 +22,11 @@
 #include <algorithm>
 #include <unordered_set>
 #include <utility>
+#include <chrono>
 #include <cstring>
+#include <sstream>
 #include <ngraph/opsets/opset1.hpp>
+#include <ngraph/op/read_value.hpp>
 #include <transformations/utils/utils.hpp>
 
 using namespace MKLDNNPlugin;
@@ -44,15 +48,21 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
 };
 
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
+                                     const InferenceEngine::CNNNetwork &exportNetwork,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const NetworkReshaper &reshaper,
+                                     const std::shared_ptr<ngraph::pass::Profiler> &compileProfile) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
     _numaNodesWeights(numaNodesWeights),
-        _network(network) {
+    _reshaper(reshaper),
+    _compileProfile(compileProfile ? compileProfile : std::make_shared<ngraph::pass::Profiler>(cfg.compileProfileNodeCounts)),
+        _network(network),
+        _exportNetwork(exportNetwork) {
     auto function = network.getFunction();
     if (function == nullptr) {
         IE_THROW() << "CPU plug-in doesn't support not ngraph-based model!";
@@ -66,6 +76,21 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         }
     }
 
+    if (_cfg.shapeCacheCapacity > 0) {
+        if (!_reshaper)
+            IE_THROW() << "Shape cache is not supported for the network " << _name;
+        if (_cfg.batchLimit > 0)
+            IE_THROW() << "Shape cache can't be used with the dynamic batch";
+        // the variable states are bound to the MemoryInput nodes of one graph
+        const auto ops = function->get_ops();
+        if (std::any_of(ops.begin(), ops.end(), [](const std::shared_ptr<ngraph::Node>& op) {
+                return std::dynamic_pointer_cast<ngraph::op::ReadValueBase>(op) != nullptr;
+            })) {
+            IE_THROW() << "Shape cache can't be used for the network with variable states";
+        }
+        _inputShapes = _network.getInputShapes();
+    }
+
     if (cfg.exclusiveAsyncRequests) {
         // special case when all InferRequests are muxed into a single queue
         _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
@@ -100,6 +125,10 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
+    if (_cfg.shapeCacheCapacity > 0) {
+        for (int i = 0; i < streams; i++)
+            _shapeCaches.emplace_back(static_cast<size_t>(_cfg.shapeCacheCapacity));
+    }
     if (_cfg.streamExecutorConfig._streams != 0) {
         for (auto&& task : tasks) {
             task = [this] {
@@ -126,7 +155,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                 if (suffix_idx != std::string::npos)
                     state_name = state_name.substr(0, suffix_idx);
 
-                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+                memoryStates.emplace_back(new MKLDNNVariableState(state_name, *state_store, memoryNode->getEngine()));
             }
         }
     }
@@ -145,6 +174,8 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
         std::exception_ptr exception;
         auto makeGraph = [&] {
             try {
+                // the graphs of the streams are created by their threads
+                ngraph::pass::Profiler::Activation compileProfileActivation(_compileProfile);
                 {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
@@ -166,6 +197,69 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
     return graphLock;
 }
 
+MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph(const InferenceEngine::ICNNNetwork::InputShapes& shapes) {
+    if (_shapeCaches.empty() || shapes == _inputShapes)
+        return GetGraph();
+
+    int streamId = 0;
+    int numaNodeId = 0;
+    auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    if (nullptr != streamsExecutor) {
+        streamId = streamsExecutor->GetStreamId();
+        numaNodeId = streamsExecutor->GetNumaNodeId();
+    }
+
+    auto& cache = _shapeCaches[streamId % _shapeCaches.size()];
+    std::shared_ptr<Graph> graph;
+    {
+        std::lock_guard<std::mutex> lock{cache._mutex};
+        if (!cache._graphs.get(shapes, graph)) {
+            // the graph is compiled out of the cache lock, so the requests with other shapes are not blocked
+            graph = std::make_shared<Graph>();
+            cache._graphs.put(shapes, graph);
+        }
+    }
+
+    // the requests with the same new shapes wait for the one which compiles the graph
+    auto graphLock = Graph::Lock(graph);
+    if (graphLock._graph.IsReady()) {
+        _shapeCacheHits++;
+        return graphLock;
+    }
+
+    _shapeCacheMisses++;
+    const auto start = std::chrono::steady_clock::now();
+    std::exception_ptr exception;
+    auto makeGraph = [&] {
+        try {
+            {
+                std::lock_guard<std::mutex> lock{_cfgMutex};
+                graphLock._graph.setConfig(_cfg);
+            }
+            // the constants are the same as in the other graphs, so they are taken from the weights sharing
+            graphLock._graph.CreateGraph(_reshaper(shapes), extensionManager, _numaNodesWeights[numaNodeId]);
+        } catch(...) {
+            exception = std::current_exception();
+        }
+    };
+    if (nullptr != streamsExecutor) {
+        streamsExecutor->Execute(makeGraph);
+    } else {
+        makeGraph();
+    }
+    _shapeCacheCompileTimeUs += std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    if (exception) {
+        // the failed graph is not kept, so the next request with these shapes tries again
+        std::lock_guard<std::mutex> lock{cache._mutex};
+        std::shared_ptr<Graph> cached;
+        if (cache._graphs.get(shapes, cached) && cached == graph)
+            cache._graphs.erase(shapes);
+        std::rethrow_exception(exception);
+    }
+    return graphLock;
+}
+
 MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
     int streamId = 0;
     int numaNodeId = 0;
@@ -190,6 +284,11 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
             graphLock._graph.setProperty(properties);
         }
     }
+    // the graphs of the shape cache are compiled again with the new config
+    for (auto& cache : _shapeCaches) {
+        std::lock_guard<std::mutex> lock{cache._mutex};
+        cache._graphs.clear();
+    }
 }
 
 InferenceEngine::IInferRequestInternal::Ptr MKLDNNExecNetwork::CreateInferRequest() {
@@ -203,6 +302,12 @@ InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetExecGraphInfo() {
     return GetGraph()._graph.dump();
 }
 
+void MKLDNNExecNetwork::Export(std::ostream& modelStream) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::Export");
+    CNNNetworkSerializer serializer(modelStream, extensionManager->getOpSets());
+    serializer.serialize(_exportNetwork, _exportNetwork.getFunction() == _network.getFunction());
+}
+
 Parameter MKLDNNExecNetwork::GetConfig(const std::string &name) const {
     if (_graphs.size() == 0) IE_THROW() << "No graph was found";
     Config engConfig = GetGraph()._graph.getProperty();
@@ -226,6 +331,13 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(COMPILE_PROFILE));
+        metrics.push_back(METRIC_KEY(CPU_ESTIMATED_AVOIDED_REORDERS));
+        metrics.push_back(METRIC_KEY(CPU_SHAPE_CACHE_HITS));
+        metrics.push_back(METRIC_KEY(CPU_SHAPE_CACHE_MISSES));
+        metrics.push_back(METRIC_KEY(CPU_SHAPE_CACHE_COMPILE_TIME_MS));
+        metrics.push_back(METRIC_KEY(CPU_PARALLEL_CRITICAL_PATH_US));
+        metrics.push_back(METRIC_KEY(CPU_PARALLEL_NODES_TIME_US));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -240,6 +352,24 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(COMPILE_PROFILE)) {
+        std::ostringstream profile;
+        _compileProfile->serialize(profile);
+        IE_SET_METRIC_RETURN(COMPILE_PROFILE, profile.str());
+    } else if (name == METRIC_KEY(CPU_ESTIMATED_AVOIDED_REORDERS)) {
+        IE_SET_METRIC_RETURN(CPU_ESTIMATED_AVOIDED_REORDERS,
+                             static_cast<unsigned int>(GetGraph()._graph.GetEstimatedAvoidedReorders()));
+    } else if (name == METRIC_KEY(CPU_SHAPE_CACHE_HITS)) {
+        IE_SET_METRIC_RETURN(CPU_SHAPE_CACHE_HITS, static_cast<unsigned int>(_shapeCacheHits));
+    } else if (name == METRIC_KEY(CPU_SHAPE_CACHE_MISSES)) {
+        IE_SET_METRIC_RETURN(CPU_SHAPE_CACHE_MISSES, static_cast<unsigned int>(_shapeCacheMisses));
+    } else if (name == METRIC_KEY(CPU_SHAPE_CACHE_COMPILE_TIME_MS)) {
+        IE_SET_METRIC_RETURN(CPU_SHAPE_CACHE_COMPILE_TIME_MS, static_cast<float>(_shapeCacheCompileTimeUs) / 1000.0f);
+    } else if (name == METRIC_KEY(CPU_PARALLEL_CRITICAL_PATH_US)) {
+        IE_SET_METRIC_RETURN(CPU_PARALLEL_CRITICAL_PATH_US,
+                             static_cast<unsigned int>(GetGraph()._graph.GetCriticalPathTime()));
+    } else if (name == METRIC_KEY(CPU_PARALLEL_NODES_TIME_US)) {
+        IE_SET_METRIC_RETURN(CPU_PARALLEL_NODES_TIME_US, static_cast<unsigned int>(GetGraph()._graph.GetTotalNodesTime()));
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -9,12 +9,15 @@
 
 #include "mkldnn_graph.h"
 #include "mkldnn_extension_mngr.h"
+#include "utils/lru_cache.hpp"
 #include <threading/ie_thread_local.hpp>
+#include <ngraph/pass/profiler.hpp>
 
 #include <vector>
 #include <memory>
 #include <map>
 #include <string>
+#include <functional>
 #include <unordered_map>
 
 namespace MKLDNNPlugin {
@@ -29,8 +32,22 @@ public:
 
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
 
-    MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+    /**
+     * Returns the transformed network reshaped to the given input shapes
+     */
+    using NetworkReshaper = std::function<InferenceEngine::CNNNetwork(const InferenceEngine::ICNNNetwork::InputShapes&)>;
+
+    /**
+     * @param network transformed network the graphs are created from
+     * @param exportNetwork network written by Export. It is either the same network or the original one
+     *        when the transformed function can not be serialized
+     * @param reshaper creates the networks of the graphs of the shape cache, it is required if the cache is enabled
+     * @param compileProfile profile of the network transformations the creation of the graphs is added to
+     */
+    MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const InferenceEngine::CNNNetwork &exportNetwork,
+                      const Config &cfg, const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const NetworkReshaper &reshaper = {},
+                      const std::shared_ptr<ngraph::pass::Profiler> &compileProfile = nullptr);
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
@@ -40,6 +57,8 @@ public:
 
     InferenceEngine::CNNNetwork GetExecGraphInfo() override;
 
+    void Export(std::ostream& modelStream) override;
+
     INFERENCE_ENGINE_DEPRECATED("Use InferRequest::QueryState instead")
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
@@ -48,6 +67,7 @@ protected:
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
     const InferenceEngine::CNNNetwork           _network;
+    const InferenceEngine::CNNNetwork           _exportNetwork;
     std::mutex                                  _cfgMutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
@@ -56,7 +76,15 @@ protected:
         std::mutex  _mutex;
         struct Lock : public std::unique_lock<std::mutex> {
             explicit Lock(Graph& graph) : std::unique_lock<std::mutex>(graph._mutex), _graph(graph) {}
+            // the graph of the shape cache stays alive until it is unlocked even if it is evicted meanwhile
+            explicit Lock(const std::shared_ptr<Graph>& graph) : Lock(*graph) { _owner = graph; }
+            Lock(Lock&&) = default;
+            ~Lock() {
+                if (owns_lock())
+                    unlock();
+            }
             Graph&                          _graph;
+            std::shared_ptr<Graph>          _owner;
         };
     };
 
@@ -64,6 +92,20 @@ protected:
     mutable std::deque<Graph>                   _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
 
+    // graphs compiled for the input shapes other than the ones of _network, one cache per stream as _graphs
+    struct ShapeCache {
+        explicit ShapeCache(size_t capacity) : _graphs(capacity) {}
+        std::mutex                                                              _mutex;
+        LruCache<InferenceEngine::ICNNNetwork::InputShapes, std::shared_ptr<Graph>> _graphs;
+    };
+    mutable std::deque<ShapeCache>              _shapeCaches;
+    NetworkReshaper                             _reshaper;
+    InferenceEngine::ICNNNetwork::InputShapes   _inputShapes;
+    std::atomic<uint64_t>                       _shapeCacheHits = {0};
+    std::atomic<uint64_t>                       _shapeCacheMisses = {0};
+    std::atomic<uint64_t>                       _shapeCacheCompileTimeUs = {0};
+    std::shared_ptr<ngraph::pass::Profiler>     _compileProfile;
+
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
      *       even from main thread
@@ -71,6 +113,11 @@ protected:
     Graph::Lock GetGraph();
     Graph::Lock GetGraph() const;
 
+    /* Returns the graph of the current stream compiled for the given input shapes. It is the graph of GetGraph()
+     * for the shapes of the network, otherwise the graph is taken from the shape cache or compiled and put there.
+     */
+    Graph::Lock GetGraph(const InferenceEngine::ICNNNetwork::InputShapes& shapes);
+
 
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
 };
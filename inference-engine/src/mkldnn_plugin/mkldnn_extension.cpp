@@ -0,0 +1,38 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_extension.h"
+#include "ngraph_transformations/op/fully_connected.hpp"
+#include "ngraph_transformations/op/leaky_relu.hpp"
+#include "ngraph_transformations/op/power_static.hpp"
+#include "ngraph_transformations/op/swish_cpu.hpp"
+
+#include <ngraph/opsets/opset.hpp>
+
+namespace MKLDNNPlugin {
+
+void MKLDNNExtension::GetVersion(const InferenceEngine::Version*& versionInfo) const noexcept {
+    static const InferenceEngine::Version version = {
+        {1, 0},             // extension API version
+        "1.0",
+        "MKLDNNExtension"   // extension description message
+    };
+
+    versionInfo = &version;
+}
+
+void MKLDNNExtension::Unload() noexcept {}
+
+std::map<std::string, ngraph::OpSet> MKLDNNExtension::getOpSets() {
+    std::map<std::string, ngraph::OpSet> opsets;
+    ngraph::OpSet opset;
+    opset.insert<FullyConnectedNode>();
+    opset.insert<LeakyReluNode>();
+    opset.insert<PowerStaticNode>();
+    opset.insert<SwishNode>();
+    opsets["cpu_plugin_opset"] = opset;
+    return opsets;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,25 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_iextension.h>
+
+#include <map>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Exposes CPU plugin specific operations (FullyConnected, LeakyRelu, PowerStatic, SwishCPU)
+ * as "cpu_plugin_opset" so that a transformed ngraph::Function can be serialized and read back by IR reader.
+ */
+class MKLDNNExtension : public InferenceEngine::IExtension {
+public:
+    void GetVersion(const InferenceEngine::Version*& versionInfo) const noexcept override;
+    void Unload() noexcept override;
+    std::map<std::string, ngraph::OpSet> getOpSets() override;
+};
+
+}  // namespace MKLDNNPlugin
@@ -15,6 +15,16 @@ void MKLDNNExtensionManager::AddExtension(const IExtensionPtr& extension) {
     _extensions.push_back(extension);
 }
 
+std::map<std::string, ngraph::OpSet> MKLDNNExtensionManager::getOpSets() const {
+    std::map<std::string, ngraph::OpSet> opsets;
+    for (const auto& ext : _extensions) {
+        for (const auto& opset : ext->getOpSets()) {
+            opsets.insert(opset);
+        }
+    }
+    return opsets;
+}
+
 InferenceEngine::ILayerImpl::Ptr MKLDNNExtensionManager::CreateImplementation(const std::shared_ptr<ngraph::Node>& op) {
     if (!op)
         IE_THROW() << "Cannot get nGraph operation!";
@@ -7,6 +7,7 @@
 #include <map>
 #include <vector>
 #include <memory>
+#include <string>
 #include <ie_iextension.h>
 #include "nodes/list.hpp"
 
@@ -19,6 +20,7 @@ public:
     InferenceEngine::ILayerImpl::Ptr CreateImplementation(const std::shared_ptr<ngraph::Node>& op);
     std::shared_ptr<InferenceEngine::ILayerImplFactory> CreateExtensionFactory(const std::shared_ptr<ngraph::Node>& op);
     void AddExtension(const InferenceEngine::IExtensionPtr& extension);
+    std::map<std::string, ngraph::OpSet> getOpSets() const;
 
 private:
     std::vector<InferenceEngine::IExtensionPtr> _extensions;
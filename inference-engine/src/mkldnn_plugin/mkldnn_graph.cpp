@@ -17,6 +17,7 @@
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
 #include "mkldnn_graph_optimizer.h"
+#include "mkldnn_layout_optimizer.h"
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_memory_solver.hpp"
@@ -43,10 +44,17 @@
 
 #include <ngraph/node.hpp>
 #include <ngraph/function.hpp>
+#include <ngraph/pass/profiler.hpp>
 #include <ngraph/variant.hpp>
 #include <ngraph/ops.hpp>
 #include <transformations/utils/utils.hpp>
 #include <low_precision/low_precision.hpp>
+#include <ie_parallel.hpp>
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
+#endif
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -58,10 +66,31 @@ typedef std::vector<edge_cluster_t> edge_clusters_t;
 
 mkldnn::engine MKLDNNGraph::eng(mkldnn::engine::kind::cpu, 0);
 
+namespace {
+
+// Reports the stage with the number of graph nodes before and after it to the compile profile of the executable
+// network, if the profile is active for the thread compiling the graph
+class GraphStageProfile {
+public:
+    GraphStageProfile(const char* name, const std::vector<MKLDNNNodePtr>& nodes)
+        : scope(name, "graph"), nodes(nodes), nodesBefore(static_cast<int64_t>(nodes.size())) {}
+    ~GraphStageProfile() {
+        scope.set_nodes(nodesBefore, static_cast<int64_t>(nodes.size()));
+    }
+
+private:
+    ngraph::pass::Profiler::Scope scope;
+    const std::vector<MKLDNNNodePtr>& nodes;
+    const int64_t nodesBefore;
+};
+
+}  // namespace
+
 template<typename NET>
 void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMgr,
         MKLDNNWeightsSharing::Ptr &w_cache) {
     OV_ITT_SCOPE(FIRST_INFERENCE, MKLDNNPlugin::itt::domains::MKLDNN_LT, "CreateGraph");
+    GraphStageProfile profile("MKLDNNGraph::CreateGraph", graphNodes);
 
     if (IsReady())
         ForgetGraphData();
@@ -82,6 +111,8 @@ template void MKLDNNGraph::CreateGraph(const CNNNetwork&,
         const MKLDNNExtensionManager::Ptr&, MKLDNNWeightsSharing::Ptr&);
 
 void MKLDNNGraph::Replicate(const std::shared_ptr<const ngraph::Function> &subgraph, const MKLDNNExtensionManager::Ptr& extMgr) {
+    GraphStageProfile profile("MKLDNNGraph::Replicate", graphNodes);
+
     this->_name = "subgraph";
     this->reuse_io_tensors = false;
 
@@ -172,6 +203,7 @@ void MKLDNNGraph::Replicate(const std::shared_ptr<const ngraph::Function> &subgr
 
 void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr) {
     OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::MKLDNN_LT, "MKLDNNGraph::Replicate", "CNNNetwork");
+    GraphStageProfile profile("MKLDNNGraph::Replicate", graphNodes);
 
     InputsDataMap inputsInfo = network.getInputsInfo();
     OutputsDataMap outputsInfo = network.getOutputsInfo();
@@ -317,17 +349,31 @@ void MKLDNNGraph::InitGraph() {
     SortTopologically();
     InitNodes();
 
-    optimizer.ApplyCommonGraphOptimizations(*this);
+    {
+        GraphStageProfile profile("MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations", graphNodes);
+        optimizer.ApplyCommonGraphOptimizations(*this);
+    }
     SortTopologically();
 
     InitDescriptors();
     RemoveDroppedEdges();
 
+    if (config.layoutOptimization) {
+        GraphStageProfile profile("MKLDNNLayoutOptimizer::Optimize", graphNodes);
+        MKLDNNLayoutOptimizer layoutOptimizer;
+        estimatedAvoidedReorders = layoutOptimizer.Optimize(*this);
+    } else {
+        estimatedAvoidedReorders = 0;
+    }
+
     InitOptimalPrimitiveDescriptors();
 
     InitEdges();
 
-    optimizer.ApplyImplSpecificGraphOptimizations(*this);
+    {
+        GraphStageProfile profile("MKLDNNGraphOptimizer::ApplyImplSpecificGraphOptimizations", graphNodes);
+        optimizer.ApplyImplSpecificGraphOptimizations(*this);
+    }
     SortTopologically();
 
     Allocate();
@@ -341,11 +387,18 @@ void MKLDNNGraph::InitGraph() {
 #endif
     ExtractConstantNodes();
 
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO) && !defined(CPU_DEBUG_CAPS)
+    if (config.parallelBranches)
+        InitParallelSchedule();
+#endif
+    memoryClusters.clear();
+
     ExecuteConstantNodesOnly();
 }
 
 void MKLDNNGraph::InitNodes() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::InitNodes");
+    GraphStageProfile profile("MKLDNNGraph::InitNodes", graphNodes);
     for (auto &node : graphNodes) {
         node->init();
     }
@@ -353,6 +406,7 @@ void MKLDNNGraph::InitNodes() {
 
 void MKLDNNGraph::InitDescriptors() {
     OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "InitDescriptors", "Prepare");
+    GraphStageProfile profile("MKLDNNGraph::InitDescriptors", graphNodes);
 
     for (auto &node : graphNodes) {
         if (node->getType() == Input && _normalizePreprocMap.find(node->getName()) != _normalizePreprocMap.end()) {
@@ -378,6 +432,7 @@ void MKLDNNGraph::InitDescriptors() {
 
 void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::InitOptimalPrimitiveDescriptors");
+    GraphStageProfile profile("MKLDNNGraph::InitOptimalPrimitiveDescriptors", graphNodes);
     for (auto &node : graphNodes) {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.initOptimalPrimitiveDescriptor);
         node->initOptimalPrimitiveDescriptor();
@@ -386,6 +441,7 @@ void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
 
 void MKLDNNGraph::ExtractConstantNodes() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::ExtractConstantNodes");
+    GraphStageProfile profile("MKLDNNGraph::ExtractConstantNodes", graphNodes);
     for (auto& graphNode : graphNodes) {
         if (graphNode->isConstant())
             constantGraphNodes.emplace_back(graphNode);
@@ -396,6 +452,7 @@ void MKLDNNGraph::ExtractConstantNodes() {
 
 void MKLDNNGraph::ExecuteConstantNodesOnly() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::ExecuteConstantNodesOnly");
+    GraphStageProfile profile("MKLDNNGraph::ExecuteConstantNodesOnly", graphNodes);
     mkldnn::stream stream(eng);
 
     using shared_memory_ptr = MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr;
@@ -455,6 +512,7 @@ static bool isReorderAvailable(const MemoryDesc& parentDesc, const MemoryDesc& c
 
 void MKLDNNGraph::InitEdges() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::InitEdges");
+    GraphStageProfile profile("MKLDNNGraph::InitEdges", graphNodes);
 
     size_t numberOfEdges = graphEdges.size();
 
@@ -644,6 +702,14 @@ void MKLDNNGraph::AllocateWithReuse() {
     if (edge_clusters.empty())
         return;
 
+    if (config.parallelBranches) {
+        for (int i = 0; i < edge_clusters.size(); i++) {
+            memoryClusters.push_back({{edge_clusters[i].begin(), edge_clusters[i].end()},
+                                      memSolver.getOffset(i) * alignment,
+                                      boxes[i].size * alignment});
+        }
+    }
+
     auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
 
     for (int i = 0; i < edge_clusters.size(); i++) {
@@ -670,6 +736,7 @@ void MKLDNNGraph::AllocateWithReuse() {
 
 void MKLDNNGraph::Allocate() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::Allocate");
+    GraphStageProfile profile("MKLDNNGraph::Allocate", graphNodes);
 
     // resolve edges. Define which will be a view on others
     //   NeedAllocation - real blob
@@ -688,6 +755,7 @@ void MKLDNNGraph::Allocate() {
 
 void MKLDNNGraph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::CreatePrimitives");
+    GraphStageProfile profile("MKLDNNGraph::CreatePrimitives", graphNodes);
     for (auto& node : graphNodes) {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.createPrimitive);
         node->createPrimitive();
@@ -808,22 +876,207 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
     }
 #endif
 
-    for (const auto& node : mutableGraphNodes) {
-        PERF(config.collectPerfCounters, node);
-        if (request != nullptr)
-            request->ThrowIfCanceled();
+    if (!parallelSchedule.roots.empty()) {
+        InferParallel(request);
+    } else {
+        for (const auto& node : mutableGraphNodes) {
+            PERF(config.collectPerfCounters, node);
+            if (request != nullptr)
+                request->ThrowIfCanceled();
 
-        ENABLE_CPU_DEBUG_CAP(nd.dumpInputBlobs(node));
+            ENABLE_CPU_DEBUG_CAP(nd.dumpInputBlobs(node));
 
-        OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profiling.execute);
-        node->execute(stream);
+            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profiling.execute);
+            node->execute(stream);
 
-        ENABLE_CPU_DEBUG_CAP(nd.dumpOutputBlobs(node));
+            ENABLE_CPU_DEBUG_CAP(nd.dumpOutputBlobs(node));
+        }
     }
 
     if (infer_count != -1) infer_count++;
 }
 
+void MKLDNNGraph::InitParallelSchedule() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::InitParallelSchedule");
+    GraphStageProfile profile("MKLDNNGraph::InitParallelSchedule", graphNodes);
+    const size_t nodesCount = mutableGraphNodes.size();
+
+    std::unordered_map<const MKLDNNNode*, size_t> nodeIndex;
+    for (size_t i = 0; i < nodesCount; i++)
+        nodeIndex[mutableGraphNodes[i].get()] = i;
+
+    auto getIndex = [&](const MKLDNNNodePtr& node, size_t& idx) {
+        auto it = nodeIndex.find(node.get());
+        if (it == nodeIndex.end())
+            return false;
+        idx = it->second;
+        return true;
+    };
+
+    // mutableGraphNodes are sorted in the execution order, so a dependency is always directed from
+    // the earlier node to the later one. That keeps the sequential semantics and the graph acyclic.
+    std::vector<std::unordered_set<size_t>> predecessors(nodesCount);
+    auto addDependency = [&](size_t a, size_t b) {
+        if (a != b)
+            predecessors[std::max(a, b)].insert(std::min(a, b));
+    };
+
+    // data dependencies
+    for (size_t i = 0; i < nodesCount; i++) {
+        const auto& node = mutableGraphNodes[i];
+        for (size_t j = 0; j < node->getChildEdges().size(); j++) {
+            size_t child;
+            if (getIndex(node->getChildEdgeAt(j)->getChild(), child))
+                addDependency(i, child);
+        }
+    }
+
+    struct ClusterAccess {
+        std::unordered_set<size_t> readers;
+        std::unordered_set<size_t> writers;
+        size_t first = std::numeric_limits<size_t>::max();
+    };
+    std::vector<ClusterAccess> accesses(memoryClusters.size());
+    for (size_t c = 0; c < memoryClusters.size(); c++) {
+        auto& access = accesses[c];
+        for (const auto& edge : memoryClusters[c].edges) {
+            size_t idx;
+            if (getIndex(edge->getParent(), idx)) {
+                access.writers.insert(idx);
+                access.first = std::min(access.first, idx);
+            }
+            if (getIndex(edge->getChild(), idx)) {
+                access.readers.insert(idx);
+                access.first = std::min(access.first, idx);
+            }
+        }
+
+        // In-place node writes memory it also reads, so it must wait for all other readers of the tensor.
+        // Nodes writing different views of the same tensor (e.g. inputs of in-place Concat) stay independent.
+        for (auto node : access.writers) {
+            if (access.readers.count(node)) {
+                for (auto reader : access.readers)
+                    addDependency(reader, node);
+            }
+        }
+    }
+
+    // Memory reused by MemorySolver: tensors placed in the intersecting parts of the workspace have disjoint
+    // lifetimes, so all accesses to the earlier tensor must complete before the later one is written
+    for (size_t a = 0; a < memoryClusters.size(); a++) {
+        for (size_t b = a + 1; b < memoryClusters.size(); b++) {
+            const auto& clusterA = memoryClusters[a];
+            const auto& clusterB = memoryClusters[b];
+            if (clusterA.offset >= clusterB.offset + clusterB.size || clusterB.offset >= clusterA.offset + clusterA.size)
+                continue;
+            if (accesses[a].first == std::numeric_limits<size_t>::max() ||
+                accesses[b].first == std::numeric_limits<size_t>::max())
+                continue;
+            const bool aIsFirst = accesses[a].first < accesses[b].first;
+            const auto& earlier = aIsFirst ? accesses[a] : accesses[b];
+            const auto& later = aIsFirst ? accesses[b] : accesses[a];
+            for (auto writer : later.writers) {
+                for (auto reader : earlier.readers)
+                    addDependency(reader, writer);
+                for (auto earlierWriter : earlier.writers)
+                    addDependency(earlierWriter, writer);
+            }
+        }
+    }
+
+    // Memory nodes communicate through the variable state instead of edges, keep their relative order
+    size_t lastMemoryNode = std::numeric_limits<size_t>::max();
+    for (size_t i = 0; i < nodesCount; i++) {
+        const auto type = mutableGraphNodes[i]->getType();
+        if (type == MemoryInput || type == MemoryOutput) {
+            if (lastMemoryNode != std::numeric_limits<size_t>::max())
+                addDependency(lastMemoryNode, i);
+            lastMemoryNode = i;
+        }
+    }
+
+    parallelSchedule.successors.assign(nodesCount, {});
+    parallelSchedule.predecessors.assign(nodesCount, {});
+    parallelSchedule.roots.clear();
+    for (size_t i = 0; i < nodesCount; i++) {
+        parallelSchedule.predecessors[i].assign(predecessors[i].begin(), predecessors[i].end());
+        for (auto pred : predecessors[i])
+            parallelSchedule.successors[pred].push_back(i);
+        if (predecessors[i].empty())
+            parallelSchedule.roots.push_back(i);
+    }
+}
+
+void MKLDNNGraph::InferParallel(MKLDNNInferRequest* request) {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    const size_t nodesCount = mutableGraphNodes.size();
+    const bool collectPerfCounters = config.collectPerfCounters;
+
+    std::unique_ptr<std::atomic<size_t>[]> pending(new std::atomic<size_t>[nodesCount]);
+    for (size_t i = 0; i < nodesCount; i++)
+        pending[i] = parallelSchedule.predecessors[i].size();
+    // the longest (by execution time) path which ends with the node
+    std::vector<uint64_t> pathTime(collectPerfCounters ? nodesCount : 0, 0);
+    std::atomic<uint64_t> nodesTime{0};
+
+    tbb::task_group taskGroup;
+    std::function<void(size_t)> executeFrom = [&](size_t idx) {
+        mkldnn::stream stream(eng);
+        while (true) {
+            const auto& node = mutableGraphNodes[idx];
+            if (request != nullptr)
+                request->ThrowIfCanceled();
+
+            const auto start = std::chrono::steady_clock::now();
+            {
+                PERF(collectPerfCounters, node);
+                OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profiling.execute);
+                // Isolation prevents the thread from picking up another node while it waits inside the node's
+                // own parallel region: both nodes would share the thread-local primitive scratchpad
+                tbb::this_task_arena::isolate([&] {
+                    node->execute(stream);
+                });
+            }
+            if (collectPerfCounters) {
+                const uint64_t time = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+                uint64_t predTime = 0;
+                for (auto pred : parallelSchedule.predecessors[idx])
+                    predTime = std::max(predTime, pathTime[pred]);
+                pathTime[idx] = predTime + time;
+                nodesTime += time;
+            }
+
+            // continue with the first ready successor in the current task, spawn tasks for the rest
+            size_t next = nodesCount;
+            for (auto succ : parallelSchedule.successors[idx]) {
+                if (--pending[succ] == 0) {
+                    if (next == nodesCount) {
+                        next = succ;
+                    } else {
+                        taskGroup.run([&executeFrom, succ] { executeFrom(succ); });
+                    }
+                }
+            }
+            if (next == nodesCount)
+                break;
+            idx = next;
+        }
+    };
+
+    for (auto root : parallelSchedule.roots)
+        taskGroup.run([&executeFrom, root] { executeFrom(root); });
+    taskGroup.wait();
+
+    if (collectPerfCounters) {
+        criticalPathTime = pathTime.empty() ? 0 : *std::max_element(pathTime.begin(), pathTime.end());
+        totalNodesTime = nodesTime;
+    }
+#else
+    IE_THROW() << "Parallel execution of graph branches requires TBB threading";
+#endif
+}
+
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
@@ -847,6 +1100,7 @@ void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sort
 
 void MKLDNNGraph::SortTopologically() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::SortTopologically");
+    GraphStageProfile profile("MKLDNNGraph::SortTopologically", graphNodes);
 
     std::vector<MKLDNNNodePtr> unsorted;
     std::vector<MKLDNNNodePtr> sorted;
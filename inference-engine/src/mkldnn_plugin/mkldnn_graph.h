@@ -99,6 +99,22 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    /**
+     * @brief Estimated number of Reorders avoided by the graph-level layout selection comparing with the per-node
+     * selection, it is counted from the edge layouts before the Reorders are inserted and fused
+     */
+    size_t GetEstimatedAvoidedReorders() const {
+        return estimatedAvoidedReorders;
+    }
+
+    uint64_t GetCriticalPathTime() const {
+        return criticalPathTime;
+    }
+
+    uint64_t GetTotalNodesTime() const {
+        return totalNodesTime;
+    }
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void RemoveEdge(MKLDNNEdgePtr& edge);
@@ -205,6 +221,7 @@ protected:
     std::string _name;
 
     bool isQuantizedFlag = false;
+    size_t estimatedAvoidedReorders = 0;
 
     static mkldnn::engine eng;
 
@@ -220,6 +237,8 @@ protected:
     void CreatePrimitives();
     void ExtractConstantNodes();
     void ExecuteConstantNodesOnly();
+    void InitParallelSchedule();
+    void InferParallel(MKLDNNInferRequest* request);
 
     friend class MKLDNNInferRequest;
     friend class MKLDNNGraphlessInferRequest;
@@ -231,6 +250,27 @@ private:
     std::vector<MKLDNNNodePtr> constantGraphNodes;
     std::vector<MKLDNNNodePtr> mutableGraphNodes;
 
+    // Part of the workspace shared by a cluster of edges, saved by AllocateWithReuse for InitParallelSchedule
+    struct MemoryCluster {
+        std::vector<MKLDNNEdgePtr> edges;
+        int64_t offset;
+        int64_t size;
+    };
+    std::vector<MemoryCluster> memoryClusters;
+
+    // Dependencies between mutableGraphNodes (by index) which are used to execute independent nodes in parallel.
+    // Besides data dependencies they order the nodes which access the same memory because of in-place
+    // or reused (by MemorySolver) tensors.
+    struct ParallelSchedule {
+        std::vector<std::vector<size_t>> successors;
+        std::vector<std::vector<size_t>> predecessors;
+        std::vector<size_t> roots;
+    } parallelSchedule;
+
+    // Per-infer statistics of the parallel execution (collected with perf counters enabled)
+    uint64_t criticalPathTime = 0;
+    uint64_t totalNodesTime = 0;
+
     void EnforceBF16();
 };
 
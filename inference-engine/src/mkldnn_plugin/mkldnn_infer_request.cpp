@@ -7,6 +7,7 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <unordered_map>
 #include <blob_factory.hpp>
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
@@ -60,7 +61,7 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
                 if (suffix_idx != std::string::npos)
                     state_name = state_name.substr(0, suffix_idx);
 
-                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+                memoryStates.emplace_back(new MKLDNNVariableState(state_name, *state_store, memoryNode->getEngine()));
            }
         }
     } else {
@@ -127,40 +128,50 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == MemoryInput) {
-            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
-                }
+    auto& bindings = stateBindings[graph];
+    if (bindings.empty()) {
+        // every stream graph has its own MemoryInput nodes, so the states are matched to them by the variable id
+        // once per graph
+        std::unordered_map<std::string, MKLDNNVariableState*> states;
+        for (auto& memoryState : memoryStates) {
+            auto state = std::dynamic_pointer_cast<MKLDNNVariableState>(memoryState);
+            IE_ASSERT(state != nullptr);
+            states[state->GetName()] = state.get();
+        }
+        std::vector<std::pair<MKLDNNMemoryInputNode*, MKLDNNVariableState*>> graphBindings;
+        for (auto &node : graph->GetNodes()) {
+            if (node->getType() == MemoryInput) {
+                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+                IE_ASSERT(memoryNode != nullptr);
+                auto stateName = memoryNode->getId();
+                // Remove suffix with pair ID. Internal information.
+                auto suffixIdx = stateName.find("/id=");
+                if (suffixIdx != std::string::npos)
+                    stateName = stateName.substr(0, suffixIdx);
+
+                auto state = states.find(stateName);
+                if (state == states.end())
+                    IE_THROW() << "There is no variable state for the MemoryInput node with id " << stateName;
+                graphBindings.emplace_back(memoryNode, state->second);
             }
         }
+        if (graphBindings.size() != memoryStates.size()) {
+            IE_THROW() << "Graph contains " << graphBindings.size() << " MemoryInput nodes, but there are "
+                       << memoryStates.size() << " variable states";
+        }
+        bindings = std::move(graphBindings);
+    }
+
+    // no data is copied here: the nodes read and write the state buffers directly
+    for (auto& binding : bindings) {
+        binding.first->assignStores(binding.second->currentStore(), binding.second->nextStore());
     }
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == MemoryInput) {
-            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
-                }
-            }
-        }
+    for (auto& binding : stateBindings[graph]) {
+        if (binding.first->isStateStored())
+            binding.second->swapStores();
     }
 }
 
@@ -168,14 +179,24 @@ void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
-    auto graphLock = execNetwork->GetGraph();
+    auto graphLock = execNetwork->_shapeCaches.empty() ? execNetwork->GetGraph() : execNetwork->GetGraph(getInputShapes());
     graph = &(graphLock._graph);
+    shapeGraph = graphLock._owner;
 
     ThrowIfCanceled();
 
     execDataPreprocessing(_inputs);
 
-    changeDefaultPtr();
+    if (!execNetwork->_shapeCaches.empty()) {
+        reallocateOutputs();
+        // the blobs are passed to the graph of the network shapes without copies, the graphs of the shape cache
+        // keep their own memory
+        if (!shapeGraph)
+            updateExternalPtr();
+    }
+
+    if (!shapeGraph)
+        changeDefaultPtr();
 
     ThrowIfCanceled();
 
@@ -196,6 +217,75 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     graph->PullOutputData(_outputs);
 }
 
+InferenceEngine::ICNNNetwork::InputShapes MKLDNNPlugin::MKLDNNInferRequest::getInputShapes() const {
+    InferenceEngine::ICNNNetwork::InputShapes shapes;
+    for (const auto& input : _networkInputs) {
+        auto blob = _inputs.find(input.first);
+        shapes[input.first] = blob != _inputs.end() ? blob->second->getTensorDesc().getDims() : input.second->getTensorDesc().getDims();
+    }
+    return shapes;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::reallocateOutputs() {
+    for (auto& output : _outputs) {
+        auto pBlob = graph->getOutputBlob(output.first);
+        if (!pBlob)
+            IE_THROW() << "MKLDNN graph doesn't contain output node with name: " << output.first;
+        const auto& dims = pBlob->getTensorDesc().getDims();
+        if (output.second->getTensorDesc().getDims() == dims)
+            continue;
+
+        if (userOutputs.count(output.first)) {
+            IE_THROW(ParameterMismatch) << "Output blob " << output.first << " has shape "
+                                        << vec2str(output.second->getTensorDesc().getDims())
+                                        << ", but the input shapes produce the output shape " << vec2str(dims);
+        }
+
+        // the output shapes follow the input shapes, so the blob of the previous shapes is replaced
+        const auto& desc = output.second->getTensorDesc();
+        output.second = make_blob_with_precision(InferenceEngine::TensorDesc(desc.getPrecision(), dims,
+                                                                             InferenceEngine::TensorDesc::getLayoutByDims(dims)));
+        output.second->allocate();
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::updateExternalPtr() {
+    // the same conditions as for the blobs created by GetBlob and set by SetBlob without the shape cache
+    for (const auto& input : _inputs) {
+        auto pBlob = graph->getInputBlob(input.first);
+        if (pBlob && input.second->getTensorDesc() == pBlob->getTensorDesc() &&
+            graph->_normalizePreprocMap.find(input.first) == graph->_normalizePreprocMap.end()) {
+            externalPtr[input.first] = input.second->buffer();
+        } else {
+            externalPtr.erase(input.first);
+        }
+    }
+    for (const auto& output : _outputs) {
+        if (_inputs.count(output.first))
+            continue;
+        auto pBlob = graph->getOutputBlob(output.first);
+        if (pBlob && output.second->getTensorDesc() == pBlob->getTensorDesc()) {
+            externalPtr[output.first] = output.second->buffer();
+        } else {
+            externalPtr.erase(output.first);
+        }
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::checkBlobs() {
+    if (execNetwork->_shapeCaches.empty()) {
+        IInferRequestInternal::checkBlobs();
+        return;
+    }
+    // the input shapes select the graph and the output shapes are checked against it by the inference
+    for (const auto& input : _inputs) {
+        checkBlob(input.second, input.first, true, input.second->getTensorDesc().getDims());
+    }
+    for (const auto& output : _outputs) {
+        checkBlob(output.second, output.first, false, output.second->getTensorDesc().getDims());
+    }
+}
+
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts() const {
     if (!graph || !graph->IsReady())
         IE_THROW() << "Graph is not ready!";
@@ -239,12 +329,14 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
             _inputs[name] = make_blob_with_precision(desc);
             _inputs[name]->allocate();
             if (pBlob->getTensorDesc() == desc &&
-                graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
+                graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit &&
+                !graph->getProperty().shapeCacheCapacity) {
                 externalPtr[name] = _inputs[name]->buffer();
             }
         }
         data = _inputs[name];
-        checkBlob(data, name, true);
+        checkBlob(data, name, true, execNetwork->_shapeCaches.empty() ? InferenceEngine::SizeVector{}
+                                                                       : data->getTensorDesc().getDims());
         // check if preprocess required, but still wasn't set
         auto preProcessedInput = std::find_if(std::begin(_networkInputs), std::end(_networkInputs),
             [&](const std::pair<std::string, InferenceEngine::InputInfo::Ptr>& pair)
@@ -301,12 +393,14 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
             }
 
             _outputs[name] = data;
-            if (!externalPtr.count(name) && data->getTensorDesc() == pBlob->getTensorDesc() && !graph->getProperty().batchLimit) {
+            if (!externalPtr.count(name) && data->getTensorDesc() == pBlob->getTensorDesc() && !graph->getProperty().batchLimit &&
+                !graph->getProperty().shapeCacheCapacity) {
                 externalPtr[name] = data->buffer();
             }
         }
         data = _outputs[name];
-        checkBlob(data, name, false);
+        checkBlob(data, name, false, execNetwork->_shapeCaches.empty() ? InferenceEngine::SizeVector{}
+                                                                        : data->getTensorDesc().getDims());
     }
     if (!data) {
         IE_THROW() << "Cannot find blob with name: " << name;
@@ -355,21 +449,33 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             // pre-processing
             _preProcData[name]->setRoiBlob(data);
         } else {
-            size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
-                ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
-                : 1;
-            if (dataSize != inputSize) {
-                IE_THROW() << "Input blob size is not equal network input size ("
-                                   << dataSize << "!=" << inputSize << ").";
-            }
+            if (graph->getProperty().shapeCacheCapacity) {
+                // the graph for the shapes of the blob is taken from the shape cache by the inference
+                if (foundInput->getTensorDesc().getDims().size() != data->getTensorDesc().getDims().size()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set input blob. Rank mismatch.";
+                }
+                if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                    foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                    foundInput->getTensorDesc().getLayout() != data->getTensorDesc().getLayout()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set input blob. Layout mismatch.";
+                }
+            } else {
+                size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
+                    ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
+                    : 1;
+                if (dataSize != inputSize) {
+                    IE_THROW() << "Input blob size is not equal network input size ("
+                                       << dataSize << "!=" << inputSize << ").";
+                }
 
-            if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-                IE_THROW(ParameterMismatch) << "Failed to set input blob. Dimensions mismatch.";
-            }
+                if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set input blob. Dimensions mismatch.";
+                }
 
-            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
-                foundInput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
-                IE_THROW(ParameterMismatch) << "Failed to set input blob. Blocking descriptor mismatch.";
+                if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                    foundInput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set input blob. Blocking descriptor mismatch.";
+                }
             }
 
             auto pBlob = graph->getInputBlob(name);
@@ -378,7 +484,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             }
 
             if (data->getTensorDesc() == pBlob->getTensorDesc() &&
-                graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
+                graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit &&
+                !graph->getProperty().shapeCacheCapacity) {
                 externalPtr[name] = data->buffer();
             } else if (externalPtr.find(name) != externalPtr.end()) {
                 externalPtr.erase(name);
@@ -395,19 +502,31 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             IE_THROW(ParameterMismatch) << "Failed to set output blob with precision: "
                                << data->getTensorDesc().getPrecision() << ", if CNNNetwork output blob precision is: " << foundOutput->getPrecision();
         }
-        size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
-            ? InferenceEngine::details::product(foundOutput->getDims())
-            : 1;
-        if (dataSize != outputSize) {
-            IE_THROW() << "Output blob size is not equal network output size ("
-                               << dataSize << "!=" << outputSize << ").";
-        }
-        if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-            IE_THROW(ParameterMismatch) << "Failed to set output Blob. Dimensions mismatch.";
-        }
-        if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
-            foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
-                IE_THROW(ParameterMismatch) << "Failed to set output blob. Blocking descriptor mismatch.";
+        if (graph->getProperty().shapeCacheCapacity) {
+            // the shape of the blob is checked against the graph selected by the input shapes of the inference
+            if (foundOutput->getTensorDesc().getDims().size() != data->getTensorDesc().getDims().size()) {
+                IE_THROW(ParameterMismatch) << "Failed to set output blob. Rank mismatch.";
+            }
+            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                foundOutput->getTensorDesc().getLayout() != data->getTensorDesc().getLayout()) {
+                IE_THROW(ParameterMismatch) << "Failed to set output blob. Layout mismatch.";
+            }
+        } else {
+            size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
+                ? InferenceEngine::details::product(foundOutput->getDims())
+                : 1;
+            if (dataSize != outputSize) {
+                IE_THROW() << "Output blob size is not equal network output size ("
+                                   << dataSize << "!=" << outputSize << ").";
+            }
+            if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                IE_THROW(ParameterMismatch) << "Failed to set output Blob. Dimensions mismatch.";
+            }
+            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set output blob. Blocking descriptor mismatch.";
+            }
         }
 
         auto pBlob = graph->getOutputBlob(name);
@@ -415,12 +534,13 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             IE_THROW() << "MKLDNN graph doesn't contain output node with name: " << name;
 
         if (data->getTensorDesc() == pBlob->getTensorDesc() &&
-                !graph->getProperty().batchLimit) {
+                !graph->getProperty().batchLimit && !graph->getProperty().shapeCacheCapacity) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
         }
         _outputs[name] = data;
+        userOutputs.insert(name);
     }
 }
 
@@ -8,12 +8,18 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
 
 class MKLDNNExecNetwork;
 class MKLDNNAsyncInferRequest;
+class MKLDNNMemoryInputNode;
+class MKLDNNVariableState;
 
 class MKLDNNInferRequest : public InferenceEngine::IInferRequestInternal {
 public:
@@ -47,6 +53,12 @@ public:
      */
     void ThrowIfCanceled() const;
 
+    /**
+     * @brief With the shape cache the blobs are checked against the shapes of the graph selected for them by
+     * the inference instead of the shapes of the network
+     */
+    void checkBlobs() override;
+
 private:
     void PushInputData();
     void PushStates();
@@ -54,12 +66,22 @@ private:
 
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
+    InferenceEngine::ICNNNetwork::InputShapes getInputShapes() const;
+    void reallocateOutputs();
+    void updateExternalPtr();
+
     void changeDefaultPtr();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
+    // keeps the graph of the shape cache used by the last inference alive for GetPerformanceCounts
+    std::shared_ptr<MKLDNNGraph>        shapeGraph;
     std::map<std::string, void*>        externalPtr;
+    // outputs set by SetBlob, they are not reallocated for the shapes of the shape cache graphs
+    std::unordered_set<std::string>     userOutputs;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
+    std::unordered_map<const MKLDNNGraph*,
+                       std::vector<std::pair<MKLDNNMemoryInputNode*, MKLDNNVariableState*>>> stateBindings;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
 };
 }  // namespace MKLDNNPlugin
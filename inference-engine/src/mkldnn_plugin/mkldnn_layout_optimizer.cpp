@@ -0,0 +1,290 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_layout_optimizer.h"
+#include "mkldnn_itt.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+using namespace MKLDNNPlugin;
+
+constexpr float MKLDNNLayoutOptimizer::infiniteCost;
+
+namespace {
+
+float elementsCount(const MKLDNNEdgePtr& edge) {
+    const auto& shape = edge->getShape();
+    return shape.isStatic() ? static_cast<float>(shape.getElementsCount()) : 1.f;
+}
+
+const MemoryDesc* getInputDesc(const NodeDesc& pd, const MKLDNNEdgePtr& edge) {
+    const auto& inConfs = pd.getConfig().inConfs;
+    int outNum = edge->getOutputNum();
+    if (outNum < 0 || outNum >= inConfs.size())
+        return nullptr;
+    return inConfs[outNum].desc.get();
+}
+
+const MemoryDesc* getOutputDesc(const NodeDesc& pd, const MKLDNNEdgePtr& edge) {
+    const auto& outConfs = pd.getConfig().outConfs;
+    if (outConfs.empty())
+        return nullptr;
+    int inNum = edge->getInputNum();
+    if (inNum < 0 || inNum >= outConfs.size())
+        inNum = 0;
+    return outConfs[inNum].desc.get();
+}
+
+bool isCompatible(const MemoryDesc* parentDesc, const MemoryDesc* childDesc) {
+    return parentDesc == nullptr || childDesc == nullptr || childDesc->isCompatible(*parentDesc);
+}
+
+// Reorders for the constant inputs are executed once on the load network stage
+bool isConstInput(const MKLDNNEdgePtr& edge) {
+    return edge->getOutputNum() > 0 && edge->getParent()->isConstant() && !edge->getChild()->isConstant();
+}
+
+// The node implementation dominates the execution time, so only descriptors of the most preferable
+// implementation type are considered
+bool isComputeBound(const MKLDNNNodePtr& node) {
+    switch (node->getType()) {
+        case Convolution:
+        case Deconvolution:
+        case BinaryConvolution:
+        case DeformableConvolution:
+        case FullyConnected:
+        case MatMul:
+        case RNNCell:
+        case RNNSeq:
+            return true;
+        default:
+            return false;
+    }
+}
+
+}  // namespace
+
+bool MKLDNNLayoutOptimizer::isReselectable(const MKLDNNNodePtr& node) const {
+    // The nodes with the own selection logic (in-place Concat/Split, Eltwise broadcasting rules)
+    // and the graph boundaries keep the local choice
+    switch (node->getType()) {
+        case Input:
+        case Output:
+        case Reorder:
+        case Concatenation:
+        case Split:
+        case Eltwise:
+        case MemoryInput:
+        case MemoryOutput:
+        case TensorIterator:
+            return false;
+        default:
+            break;
+    }
+    return !node->isConstant() && node->getSupportedPrimitiveDescriptors().size() > 1 &&
+           node->getSelectedPrimitiveDescriptor() != nullptr;
+}
+
+std::vector<int> MKLDNNLayoutOptimizer::getCandidates(const MKLDNNNodePtr& node) const {
+    std::vector<int> candidates;
+    const auto& pds = node->getSupportedPrimitiveDescriptors();
+    for (int i = 0; i < pds.size(); i++) {
+        if (pds[i].getConfig().inConfs.size() > node->getParentEdges().size())
+            continue;
+        if (implCost(node, i) == infiniteCost)
+            continue;
+        candidates.push_back(i);
+    }
+    // the locally selected descriptor is always a valid candidate
+    if (candidates.empty())
+        candidates.push_back(node->selectedPrimitiveDescriptorIndex);
+    return candidates;
+}
+
+float MKLDNNLayoutOptimizer::implCost(const MKLDNNNodePtr& node, int pdIdx) const {
+    const auto& priority = node->getPrimitivesPriority();
+    auto rank = [&](impl_desc_type type) {
+        return static_cast<size_t>(std::distance(priority.begin(), std::find(priority.begin(), priority.end(), type)));
+    };
+
+    const auto& pds = node->getSupportedPrimitiveDescriptors();
+    size_t bestRank = priority.size();
+    for (const auto& pd : pds)
+        bestRank = std::min(bestRank, rank(pd.getImplementationType()));
+
+    const auto type = pds[pdIdx].getImplementationType();
+    const auto bestType = pds[node->selectedPrimitiveDescriptorIndex].getImplementationType();
+    const size_t currentRank = rank(type);
+    if (currentRank == bestRank || type == bestType)
+        return 0.f;
+    if (isComputeBound(node) || ((type & impl_desc_type::ref) && !(bestType & impl_desc_type::ref)))
+        return infiniteCost;
+
+    // every step down the priority list is estimated as one extra pass over the node outputs
+    float outputs = 0.f;
+    for (size_t i = 0; i < node->getChildEdges().size(); i++)
+        outputs = std::max(outputs, elementsCount(node->getChildEdgeAt(i)));
+    return static_cast<float>(currentRank - bestRank) * outputs;
+}
+
+float MKLDNNLayoutOptimizer::edgeCost(const MKLDNNEdgePtr& edge, int parentPdIdx, int childPdIdx) const {
+    if (isConstInput(edge))
+        return 0.f;
+    const auto parent = edge->getParent();
+    const auto child = edge->getChild();
+    if (parentPdIdx < 0 || childPdIdx < 0)
+        return 0.f;
+    const auto* parentDesc = getOutputDesc(parent->getSupportedPrimitiveDescriptors()[parentPdIdx], edge);
+    const auto* childDesc = getInputDesc(child->getSupportedPrimitiveDescriptors()[childPdIdx], edge);
+    return isCompatible(parentDesc, childDesc) ? 0.f : elementsCount(edge);
+}
+
+float MKLDNNLayoutOptimizer::consumersCost(const MKLDNNNodePtr& node, int pdIdx) const {
+    float cost = 0.f;
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        auto edge = node->getChildEdgeAt(i);
+        auto child = edge->getChild();
+        if (!isReselectable(child)) {
+            cost += edgeCost(edge, pdIdx, child->selectedPrimitiveDescriptorIndex);
+            continue;
+        }
+        // the consumer will be reselected later, so it is enough that at least one of its descriptors fits
+        float minCost = infiniteCost;
+        for (auto childPdIdx : getCandidates(child))
+            minCost = std::min(minCost, edgeCost(edge, pdIdx, childPdIdx));
+        cost += minCost;
+    }
+    return cost;
+}
+
+void MKLDNNLayoutOptimizer::optimizeChain(const std::vector<MKLDNNNodePtr>& chain, std::unordered_set<MKLDNNNode*>& changed) {
+    std::vector<std::vector<int>> candidates(chain.size());
+    // cost[i][k] - minimal cost of the chain prefix [0..i] with the k-th candidate selected for the i-th node
+    std::vector<std::vector<float>> cost(chain.size());
+    std::vector<std::vector<int>> prev(chain.size());
+
+    for (size_t i = 0; i < chain.size(); i++) {
+        const auto& node = chain[i];
+        candidates[i] = getCandidates(node);
+        cost[i].assign(candidates[i].size(), infiniteCost);
+        prev[i].assign(candidates[i].size(), -1);
+
+        for (size_t k = 0; k < candidates[i].size(); k++) {
+            const int pdIdx = candidates[i][k];
+            float nodeCost = implCost(node, pdIdx);
+            MKLDNNEdgePtr chainEdge;
+            for (size_t j = 0; j < node->getParentEdges().size(); j++) {
+                auto edge = node->getParentEdgeAt(j);
+                if (i > 0 && edge->getParent() == chain[i - 1]) {
+                    chainEdge = edge;
+                    continue;
+                }
+                nodeCost += edgeCost(edge, edge->getParent()->selectedPrimitiveDescriptorIndex, pdIdx);
+            }
+            if (i + 1 == chain.size())
+                nodeCost += consumersCost(node, pdIdx);
+
+            if (i == 0) {
+                cost[i][k] = nodeCost;
+                continue;
+            }
+            for (size_t p = 0; p < candidates[i - 1].size(); p++) {
+                if (cost[i - 1][p] == infiniteCost)
+                    continue;
+                const float total = cost[i - 1][p] + nodeCost + edgeCost(chainEdge, candidates[i - 1][p], pdIdx);
+                if (total < cost[i][k]) {
+                    cost[i][k] = total;
+                    prev[i][k] = static_cast<int>(p);
+                }
+            }
+        }
+    }
+
+    // Prefer the local choice in case of a tie, so the pass never makes the graph worse according to the cost model
+    auto& lastCosts = cost.back();
+    int best = -1;
+    for (size_t k = 0; k < lastCosts.size(); k++) {
+        const bool isLocal = candidates.back()[k] == chain.back()->selectedPrimitiveDescriptorIndex;
+        if (best < 0 || lastCosts[k] < lastCosts[best] || (lastCosts[k] == lastCosts[best] && isLocal))
+            best = static_cast<int>(k);
+    }
+    if (best < 0 || lastCosts[best] == infiniteCost)
+        return;
+
+    for (int i = static_cast<int>(chain.size()) - 1; i >= 0 && best >= 0; i--) {
+        if (chain[i]->selectedPrimitiveDescriptorIndex != candidates[i][best]) {
+            chain[i]->selectPrimitiveDescriptorByIndex(candidates[i][best]);
+            changed.insert(chain[i].get());
+        }
+        best = prev[i][best];
+    }
+}
+
+size_t MKLDNNLayoutOptimizer::countReorders(const MKLDNNGraph& graph) {
+    size_t reorders = 0;
+    for (const auto& node : graph.GetNodes()) {
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto edge = node->getChildEdgeAt(i);
+            auto parentPd = node->getSelectedPrimitiveDescriptor();
+            auto childPd = edge->getChild()->getSelectedPrimitiveDescriptor();
+            if (parentPd == nullptr || childPd == nullptr || isConstInput(edge))
+                continue;
+            if (!isCompatible(getOutputDesc(*parentPd, edge), getInputDesc(*childPd, edge)))
+                reorders++;
+        }
+    }
+    return reorders;
+}
+
+size_t MKLDNNLayoutOptimizer::Optimize(MKLDNNGraph& graph) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNLayoutOptimizer::Optimize");
+
+    const size_t localReorders = countReorders(graph);
+
+    // nodes are topologically sorted, so the producers outside of the chain are already finalized
+    std::unordered_set<MKLDNNNode*> visited;
+    std::unordered_set<MKLDNNNode*> changed;
+    for (const auto& node : graph.GetNodes()) {
+        if (visited.count(node.get()))
+            continue;
+        visited.insert(node.get());
+        if (!isReselectable(node)) {
+            // the custom selection logic depends on the producers, so it is repeated if they were changed
+            bool producerChanged = false;
+            for (size_t j = 0; j < node->getParentEdges().size(); j++)
+                producerChanged |= changed.count(node->getParentEdgeAt(j)->getParent().get()) != 0;
+            if (producerChanged && node->getType() != Input) {
+                const auto localIdx = node->selectedPrimitiveDescriptorIndex;
+                node->selectOptimalPrimitiveDescriptor();
+                if (node->selectedPrimitiveDescriptorIndex != localIdx)
+                    changed.insert(node.get());
+            }
+            continue;
+        }
+
+        std::vector<MKLDNNNodePtr> chain = {node};
+        for (;;) {
+            const auto& last = chain.back();
+            if (last->getChildEdges().size() != 1)
+                break;
+            auto next = last->getChildEdgeAt(0)->getChild();
+            if (visited.count(next.get()) || !isReselectable(next))
+                break;
+            size_t producers = 0;
+            for (size_t j = 0; j < next->getParentEdges().size(); j++) {
+                if (!isConstInput(next->getParentEdgeAt(j)))
+                    producers++;
+            }
+            if (producers != 1)
+                break;
+            visited.insert(next.get());
+            chain.push_back(next);
+        }
+        optimizeChain(chain, changed);
+    }
+
+    const size_t reorders = countReorders(graph);
+    return localReorders > reorders ? localReorders - reorders : 0;
+}
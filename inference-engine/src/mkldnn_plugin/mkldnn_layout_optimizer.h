@@ -0,0 +1,47 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_graph.h"
+#include <limits>
+#include <unordered_set>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Graph-level selection of primitive descriptors.
+ *
+ * MKLDNNNode::selectOptimalPrimitiveDescriptor() picks the descriptor looking only at the already selected parents,
+ * so a single planar node inside a blocked sub-graph may cause a pair of Reorders. This pass revisits the local
+ * choice: the graph is split into chains (node with a single consumer followed by the node with a single
+ * non-constant producer) and for each chain descriptors are assigned by dynamic programming over the cost of the
+ * Reorders on the edges and the cost of switching to less preferable implementation. At the chain ends (branch
+ * points) the cost of the consumer edges is estimated by checking whether any descriptor of the consumer accepts
+ * the produced layout.
+ */
+class MKLDNNLayoutOptimizer {
+public:
+    /**
+     * @brief Reselects primitive descriptors of the graph nodes. Must be called after MKLDNNGraph::InitDescriptors()
+     * @return number of edges with mismatching layouts removed comparing with the per-node selection, an estimate
+     *         of avoided Reorders
+     */
+    size_t Optimize(MKLDNNGraph& graph);
+
+private:
+    static constexpr float infiniteCost = std::numeric_limits<float>::max();
+
+    bool isReselectable(const MKLDNNNodePtr& node) const;
+    std::vector<int> getCandidates(const MKLDNNNodePtr& node) const;
+    float implCost(const MKLDNNNodePtr& node, int pdIdx) const;
+    float edgeCost(const MKLDNNEdgePtr& edge, int parentPdIdx, int childPdIdx) const;
+    float consumersCost(const MKLDNNNodePtr& node, int pdIdx) const;
+    void optimizeChain(const std::vector<MKLDNNNodePtr>& chain, std::unordered_set<MKLDNNNode*>& changed);
+
+    static size_t countReorders(const MKLDNNGraph& graph);
+};
+
+}  // namespace MKLDNNPlugin
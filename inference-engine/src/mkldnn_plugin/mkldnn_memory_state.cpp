@@ -10,8 +10,33 @@ using namespace InferenceEngine;
 
 namespace MKLDNNPlugin {
 
-void  MKLDNNVariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+MKLDNNVariableState::MKLDNNVariableState(std::string name, const MKLDNNMemory& storage, const mkldnn::engine& eng) :
+        InferenceEngine::IVariableStateInternal{name} {
+    for (auto& buffer : buffers) {
+        buffer = std::make_shared<MKLDNNMemory>(eng);
+        buffer->Create(storage.GetDesc());
+    }
+    cpu_memcpy(buffers[current]->GetData(), storage.GetData(), storage.GetSize());
+}
+
+void MKLDNNVariableState::Reset() {
+    buffers[current]->FillZero();
+}
+
+void MKLDNNVariableState::SetState(const Blob::Ptr& newState) {
+    auto& store = buffers[current];
+    if (!newState || newState->byteSize() != store->GetSize())
+        IE_THROW() << "Cannot set state '" << name << "': blob size doesn't match the state size " << store->GetSize();
+
+    cpu_memcpy(store->GetData(), newState->cbuffer().as<const void*>(), store->GetSize());
+}
+
+Blob::CPtr MKLDNNVariableState::GetState() const {
+    const auto& store = buffers[current];
+    auto blob = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(store->GetDesc()));
+    blob->allocate();
+    cpu_memcpy(blob->buffer(), store->GetData(), store->GetSize());
+    return blob;
 }
 
 }  // namespace MKLDNNPlugin
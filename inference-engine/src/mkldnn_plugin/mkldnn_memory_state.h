@@ -14,16 +14,37 @@
 
 namespace MKLDNNPlugin {
 
+/**
+ * @brief Variable state which is read and written by the graph in place.
+ * The state keeps two buffers: MemoryInput reads the current one while MemoryOutput writes the next one,
+ * the buffers are swapped after the inference. So the data is copied only by explicit GetState/SetState calls.
+ */
 class MKLDNNVariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
-            InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->GetDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
-    }
+    MKLDNNVariableState(std::string name, const MKLDNNMemory& storage, const mkldnn::engine& eng);
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    MKLDNNMemoryPtr currentStore() const {
+        return buffers[current];
+    }
+
+    MKLDNNMemoryPtr nextStore() const {
+        return buffers[current ^ 1];
+    }
+
+    /**
+     * @brief Makes the next buffer current, is called after the graph has written the new state value
+     */
+    void swapStores() {
+        current ^= 1;
+    }
+
+private:
+    MKLDNNMemoryPtr buffers[2];
+    size_t current = 0;
 };
 
-}  // namespace MKLDNNPlugin
\ No newline at end of file
+}  // namespace MKLDNNPlugin
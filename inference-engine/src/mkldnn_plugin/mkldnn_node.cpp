@@ -7,6 +7,7 @@
 #include "mkldnn_itt.h"
 
 #include "caseless.hpp"
+#include "ie_data_hash.hpp"
 #include <vector>
 #include <string>
 #include <limits>
@@ -228,7 +229,8 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "ExtractImagePatches", ExtractImagePatches},
         { "NonMaxSuppressionIEInternal", NonMaxSuppression},
         { "MatrixNms", MatrixNms},
-        { "MulticlassNms", MulticlassNms}
+        { "MulticlassNms", MulticlassNms},
+        { "Subgraph", Subgraph}
 };
 
 Type TypeFromName(const std::string type) {
@@ -450,6 +452,27 @@ void MKLDNNNode::selectPreferPrimitiveDescriptor(const std::vector<impl_desc_typ
     selectPrimitiveDescriptorByIndex(0);
 }
 
+bool MKLDNNNode::selectPrimitiveDescriptorByParentLayout(size_t port) {
+    auto parentEdge = getParentEdgeAt(port);
+    auto parent_spd = parentEdge->getParent()->getSelectedPrimitiveDescriptor();
+    if (parent_spd == nullptr || parent_spd->getConfig().outConfs.empty())
+        return false;
+
+    int inNum = parentEdge->getInputNum();
+    if (inNum < 0 || inNum >= parent_spd->getConfig().outConfs.size()) {
+        inNum = 0;
+    }
+    auto& parentDesc = parent_spd->getConfig().outConfs[inNum].desc;
+    for (size_t i = 0; i < getSupportedPrimitiveDescriptors().size(); i++) {
+        const auto& inConfs = getSupportedPrimitiveDescriptors()[i].getConfig().inConfs;
+        if (port < inConfs.size() && inConfs[port].desc->isCompatible(*parentDesc)) {
+            selectPrimitiveDescriptorByIndex(static_cast<int>(i));
+            return true;
+        }
+    }
+    return false;
+}
+
 bool MKLDNNNode::canBeInPlace() const {
     if (getParentEdges().size() != 1 || getParentEdgeAt(0)->getParent()->getChildEdges().size() != 1 ||
             (getParentEdgeAt(0)->getParent()->isConstant() && !getParentEdgeAt(0)->getChild()->isConstant()))
@@ -823,8 +846,8 @@ void MKLDNNNode::prepareMemory(const NodeDesc *selected_pd, mkldnn::primitive_de
 
         MKLDNNMemoryPtr ptr;
         if (weightCache != nullptr) {
-            const uint64_t data_hash = weightCache->GetHashFunc().hash(
-                    internalBlob->buffer(), internalBlob->byteSize());
+            const uint64_t data_hash = InferenceEngine::DataHash::hash(
+                    internalBlob->cbuffer().as<const uint8_t*>(), internalBlob->byteSize());
 
             const std::string string_hash = name + "_" + std::to_string(i)
                                             + "_" + std::to_string(internalBlob->byteSize())
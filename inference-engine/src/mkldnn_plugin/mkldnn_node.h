@@ -200,6 +200,8 @@ static std::string NameFromType(Type type) {
             return "MatrixNms";
         case MulticlassNms:
             return "MulticlassNms";
+        case Subgraph:
+            return "Subgraph";
         default:
             return "Unknown";
     }
@@ -716,9 +718,16 @@ protected:
     friend class MKLDNNEdge;
     friend class MKLDNNGraph;
     friend class MKLDNNGraphOptimizer;
+    friend class MKLDNNLayoutOptimizer;
     friend class NodeDumper;
 
     void selectPreferPrimitiveDescriptor(const std::vector<impl_desc_type>& priority, bool ignoreConstInputs);
+    /**
+     * @brief Selects the first supported descriptor accepting the layout selected by the parent on the input port,
+     * whatever its implementation type is
+     * @return false if the parent has no selected descriptor or none of the supported descriptors accepts its layout
+     */
+    bool selectPrimitiveDescriptorByParentLayout(size_t port);
     bool isConfigDefined(const NodeConfig &config) const;
     virtual bool canBeInPlace() const;
 
@@ -5,11 +5,14 @@
 #include "ie_metric_helpers.hpp"
 #include "mkldnn_plugin.h"
 #include "mkldnn_extension_mngr.h"
+#include "mkldnn_extension.h"
+#include "mkldnn_serialize.h"
 #include "mkldnn_weights_cache.hpp"
 #include "mkldnn_itt.h"
 
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
+#include <mutex>
 #include <ie_plugin_config.hpp>
 #include <vector>
 #include <tuple>
@@ -73,6 +76,7 @@
 #include <ngraph/opsets/opset6.hpp>
 #include <ngraph/op/util/op_types.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pass/profiler.hpp>
 #include <ngraph/graph_util.hpp>
 
 #include <transformations/common_optimizations/lin_op_sequence_fusion.hpp>
@@ -89,10 +93,13 @@
 
 #include <ie_algorithm.hpp>
 
+#include <snippets/pass/collapse_subgraph.hpp>
+
 #include "nodes/mkldnn_mvn_node.h"
 #include "nodes/mkldnn_fake_quantize_node.h"
 #include "nodes/mkldnn_normalize_node.h"
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
+#include "ngraph_transformations/op/fully_connected.hpp"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
 # ifdef _WIN32
@@ -109,6 +116,7 @@ using namespace InferenceEngine;
 Engine::Engine() {
     _pluginName = "CPU";
     extensionManager->AddExtension(std::make_shared<Extensions::Cpu::MKLDNNExtensions>());
+    extensionManager->AddExtension(std::make_shared<MKLDNNExtension>());
 }
 
 Engine::~Engine() {
@@ -322,11 +330,15 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
         });
     }
 
-    manager.run_passes(nGraphFunc);
+    {
+        ngraph::pass::Profiler::Scope profile("CommonTransformations", "stage");
+        manager.run_passes(nGraphFunc);
+    }
 
     using namespace ngraph::pass::low_precision;
     if (useLpt) {
         OV_ITT_SCOPE(FIRST_INFERENCE, MKLDNNPlugin::itt::domains::MKLDNN_LT, "LowPrecisionTransformations");
+        ngraph::pass::Profiler::Scope profile("LowPrecisionTransformations", "stage");
 
         auto supportedPrecisions = std::vector<OperationPrecisionRestriction>({
             OperationPrecisionRestriction::create<ngraph::opset1::Convolution>({
@@ -395,9 +407,61 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
         return node->get_rt_info().count("UNROLL_TI") == 0;
     });
 
-    postLPTPassManager.run_passes(nGraphFunc);
+    {
+        ngraph::pass::Profiler::Scope profile("PostLPTTransformations", "stage");
+        postLPTPassManager.run_passes(nGraphFunc);
+    }
+
+    {
+        ngraph::pass::Profiler::Scope profile("ConvertToCPUSpecificOpset", "stage");
+        ConvertToCPUSpecificOpset(nGraphFunc);
+    }
 
-    ConvertToCPUSpecificOpset(nGraphFunc);
+    if (conf.snippetsMode && with_cpu_x86_sse42()) {
+        ngraph::pass::Manager tokenization;
+        tokenization.register_pass<ngraph::snippets::pass::TokenizeSnippets>();
+        // Eltwise consumers of the heavy operations are left outside of the subgraphs to be fused as post ops
+        tokenization.get_pass_config()->set_callback<ngraph::snippets::pass::StartSubgraph,
+                                                     ngraph::snippets::pass::AttachToSubgraph>([](const_node_ptr &node) -> bool {
+            for (const auto& input : node->inputs()) {
+                const auto parent = input.get_source_output().get_node_shared_ptr();
+                if (ngraph::is_type<ngraph::opset1::Constant>(parent) || parent->get_output_target_inputs(0).size() != 1)
+                    continue;
+                if (ngraph::is_type<ngraph::opset1::Convolution>(parent) ||
+                    ngraph::is_type<ngraph::opset1::GroupConvolution>(parent) ||
+                    ngraph::is_type<ngraph::opset1::ConvolutionBackpropData>(parent) ||
+                    ngraph::is_type<ngraph::opset1::GroupConvolutionBackpropData>(parent) ||
+                    ngraph::is_type<ngraph::opset1::BinaryConvolution>(parent) ||
+                    ngraph::is_type<ngraph::opset1::MatMul>(parent) ||
+                    ngraph::is_type<MKLDNNPlugin::FullyConnectedNode>(parent))
+                    return true;
+            }
+            return false;
+        });
+        ngraph::pass::Profiler::Scope profile("SnippetsTokenization", "stage");
+        tokenization.run_passes(nGraphFunc);
+    }
+}
+
+// The networks of the shape cache are reshaped before the transformations, since the shape inference of
+// the transformed operations doesn't cover all the shapes the original network can be reshaped to.
+static MKLDNNExecNetwork::NetworkReshaper MakeReshaper(const CNNNetwork& network, const Config& conf) {
+    if (conf.shapeCacheCapacity <= 0)
+        return {};
+
+    auto originalNetwork = InferenceEngine::details::cloneNetwork(network);
+    auto cloneMutex = std::make_shared<std::mutex>();
+    return [originalNetwork, conf, cloneMutex](const ICNNNetwork::InputShapes& shapes) {
+        CNNNetwork reshapedNetwork;
+        {
+            // the streams compile their graphs concurrently, while the original function is shared by them
+            std::lock_guard<std::mutex> lock{*cloneMutex};
+            reshapedNetwork = InferenceEngine::details::cloneNetwork(originalNetwork);
+        }
+        reshapedNetwork.reshape(shapes);
+        Transformation(reshapedNetwork, conf);
+        return reshapedNetwork;
+    };
 }
 
 InferenceEngine::IExecutableNetworkInternal::Ptr
@@ -433,11 +497,68 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
+    // the passes and the stages run by this thread are reported to the compile profile, the graphs of the streams
+    // report to it by the executable network
+    auto compileProfile = std::make_shared<ngraph::pass::Profiler>(conf.compileProfileNodeCounts);
+    ngraph::pass::Profiler::Activation compileProfileActivation(compileProfile);
+
     CNNNetwork clonedNetwork = InferenceEngine::details::cloneNetwork(network);
 
-    Transformation(clonedNetwork, conf);
+    {
+        ngraph::pass::Profiler::Scope profile("Transformation", "stage");
+        if (conf.compileProfileNodeCounts) {
+            const auto nodesBefore = static_cast<int64_t>(clonedNetwork.getFunction()->get_ops().size());
+            Transformation(clonedNetwork, conf);
+            profile.set_nodes(nodesBefore, static_cast<int64_t>(clonedNetwork.getFunction()->get_ops().size()));
+        } else {
+            Transformation(clonedNetwork, conf);
+        }
+    }
+
+    // Operations with relaxed precisions and some internal operations can not be read back from IR.
+    // In this case the original network is exported and transformations are applied again on import,
+    // so the quantized networks (LPT produces relaxed precisions for them) don't save the transformations time.
+    CNNNetwork exportNetwork = isSerializable(clonedNetwork.getFunction(), extensionManager->getOpSets()) ?
+                               clonedNetwork : InferenceEngine::details::cloneNetwork(network);
+
+    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, exportNetwork, conf, extensionManager, weightsSharing,
+                                               MakeReshaper(network, conf), compileProfile);
+}
+
+InferenceEngine::IExecutableNetworkInternal::Ptr
+Engine::ImportNetwork(std::istream& networkModel, const std::map<std::string, std::string>& config) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::ImportNetwork");
+
+    CNNNetworkDeserializer deserializer(networkModel,
+        [this](const std::string& model, const Blob::CPtr& weights) {
+            // CPU specific operations are not registered in Core, so the plugin opset is passed explicitly
+            return GetCore()->ReadNetwork(model, weights, {std::make_shared<MKLDNNExtension>()});
+        });
+
+    CNNNetwork network;
+    const bool isTransformed = deserializer.deserialize(network);
+
+    Config conf = engConfig;
+    conf.readProperties(config);
+
+    if (conf.enableDynamicBatch) {
+        conf.batchLimit = static_cast<int>(network.getBatchSize());
+    }
+
+    CNNNetwork transformedNetwork = network;
+    MKLDNNExecNetwork::NetworkReshaper reshaper;
+    if (!isTransformed) {
+        transformedNetwork = InferenceEngine::details::cloneNetwork(network);
+        Transformation(transformedNetwork, conf);
+        // the shape cache needs the original network, which is not exported when the transformed one is
+        reshaper = MakeReshaper(network, conf);
+    }
+
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(transformedNetwork, network, conf, extensionManager, weightsSharing,
+                                                           reshaper);
+    SetExeNetworkInfo(execNetwork, constMapCast(network.getInputsInfo()), constMapCast(network.getOutputsInfo()));
 
-    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    return execNetwork;
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -480,6 +601,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(IMPORT_EXPORT_SUPPORT));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -526,6 +648,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
     } else {
         IE_THROW() << "Unsupported metric key " << name;
     }
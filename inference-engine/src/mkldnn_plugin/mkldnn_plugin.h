@@ -25,6 +25,9 @@ public:
     LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network,
                        const std::map<std::string, std::string> &config) override;
 
+    std::shared_ptr<InferenceEngine::IExecutableNetworkInternal>
+    ImportNetwork(std::istream& networkModel, const std::map<std::string, std::string>& config) override;
+
     void AddExtension(const InferenceEngine::IExtensionPtr& extension) override;
 
     void SetConfig(const std::map<std::string, std::string> &config) override;
@@ -0,0 +1,330 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_serialize.h"
+#include "utils/rt_info/memory_formats_attribute.hpp"
+
+#include <ie_common.h>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset2.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/opsets/opset4.hpp>
+#include <ngraph/opsets/opset5.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/opsets/opset7.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/op/util/sub_graph_base.hpp>
+#include <ngraph/variant.hpp>
+#include <ngraph_ops/type_relaxed.hpp>
+#include <transformations/rt_info/fused_names_attribute.hpp>
+#include <transformations/serialize.hpp>
+
+#include <pugixml.hpp>
+
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+namespace {
+
+constexpr const char* seqAxisAttr = "seqAxis";
+constexpr const char* originalLayersNamesAttr = "originalLayersNames";
+constexpr int serializationVersion = 1;
+
+bool isSerializableOp(const std::shared_ptr<ngraph::Node>& op,
+                      const std::map<std::string, ngraph::OpSet>& customOpsets) {
+    static const std::vector<std::reference_wrapper<const ngraph::OpSet>> opsets = {
+        ngraph::get_opset1(), ngraph::get_opset2(), ngraph::get_opset3(), ngraph::get_opset4(),
+        ngraph::get_opset5(), ngraph::get_opset6(), ngraph::get_opset7(), ngraph::get_opset8()};
+
+    // TypeRelaxed operations have the same type info as their base operations but different output precisions,
+    // so the base operation created by IR reader would not match them
+    if (std::dynamic_pointer_cast<ngraph::op::TypeRelaxedBase>(op))
+        return false;
+
+    if (const auto subgraph = std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(op)) {
+        if (!isSerializable(subgraph->get_function(), customOpsets))
+            return false;
+    } else if (std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(op)) {
+        return false;
+    }
+
+    for (const auto& opset : opsets) {
+        if (opset.get().contains_op_type(op.get()))
+            return true;
+    }
+    for (const auto& opset : customOpsets) {
+        if (opset.second.contains_op_type(op.get()))
+            return true;
+    }
+    return false;
+}
+
+void writeData(std::ostream& ostream, const char* data, uint64_t size) {
+    ostream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    ostream.write(data, size);
+}
+
+uint64_t readSize(std::istream& istream) {
+    uint64_t size = 0;
+    istream.read(reinterpret_cast<char*>(&size), sizeof(size));
+    if (!istream.good())
+        IE_THROW(NetworkNotRead) << "Unexpected end of the CPU plugin exported network stream";
+    return size;
+}
+
+void serializeRtInfo(pugi::xml_node& root, const std::shared_ptr<const ngraph::Function>& function) {
+    for (const auto& op : function->get_ops()) {
+        const auto& rtInfo = op->get_rt_info();
+        pugi::xml_node node;
+        auto getNode = [&]() -> pugi::xml_node& {
+            if (node.empty()) {
+                node = root.append_child("node");
+                node.append_attribute("name").set_value(op->get_friendly_name().c_str());
+            }
+            return node;
+        };
+
+        const auto fusedNames = ngraph::getFusedNames(op);
+        if (!fusedNames.empty())
+            getNode().append_attribute("fused_names").set_value(fusedNames.c_str());
+
+        auto it = rtInfo.find(originalLayersNamesAttr);
+        if (it != rtInfo.end()) {
+            if (auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second))
+                getNode().append_attribute(originalLayersNamesAttr).set_value(value->get().c_str());
+        }
+
+        it = rtInfo.find(seqAxisAttr);
+        if (it != rtInfo.end()) {
+            if (auto value = std::dynamic_pointer_cast<ngraph::VariantWrapper<int64_t>>(it->second))
+                getNode().append_attribute(seqAxisAttr).set_value(static_cast<long long>(value->get()));
+        }
+
+        const auto inputMemoryFormats = ngraph::getMLKDNNInputMemoryFormats(op);
+        if (!inputMemoryFormats.empty())
+            getNode().append_attribute(ngraph::MLKDNNInputMemoryFormatsAttr).set_value(inputMemoryFormats.c_str());
+
+        const auto outputMemoryFormats = ngraph::getMLKDNNOutputMemoryFormats(op);
+        if (!outputMemoryFormats.empty())
+            getNode().append_attribute(ngraph::MLKDNNOutputMemoryFormatsAttr).set_value(outputMemoryFormats.c_str());
+    }
+}
+
+void deserializeRtInfo(const pugi::xml_node& root, const std::shared_ptr<ngraph::Function>& function) {
+    std::unordered_map<std::string, std::shared_ptr<ngraph::Node>> ops;
+    for (const auto& op : function->get_ops())
+        ops.emplace(op->get_friendly_name(), op);
+
+    for (const auto& node : root.children("node")) {
+        auto it = ops.find(node.attribute("name").value());
+        if (it == ops.end())
+            continue;
+        auto& rtInfo = it->second->get_rt_info();
+
+        if (const auto attr = node.attribute("fused_names")) {
+            ngraph::FusedNames fusedNames;
+            std::istringstream stream(attr.value());
+            std::string name;
+            while (std::getline(stream, name, ',')) {
+                fusedNames.fuseWith(ngraph::FusedNames(name));
+            }
+            rtInfo[ngraph::VariantWrapper<ngraph::FusedNames>::type_info.name] =
+                std::make_shared<ngraph::VariantWrapper<ngraph::FusedNames>>(fusedNames);
+        }
+        if (const auto attr = node.attribute(originalLayersNamesAttr)) {
+            rtInfo[originalLayersNamesAttr] = std::make_shared<ngraph::VariantWrapper<std::string>>(attr.value());
+        }
+        if (const auto attr = node.attribute(seqAxisAttr)) {
+            rtInfo[seqAxisAttr] = std::make_shared<ngraph::VariantWrapper<int64_t>>(attr.as_llong());
+        }
+        if (const auto attr = node.attribute(ngraph::MLKDNNInputMemoryFormatsAttr)) {
+            rtInfo[ngraph::MLKDNNInputMemoryFormatsAttr] =
+                std::make_shared<ngraph::VariantWrapper<ngraph::MLKDNNInputMemoryFormats>>(ngraph::MLKDNNInputMemoryFormats(attr.value()));
+        }
+        if (const auto attr = node.attribute(ngraph::MLKDNNOutputMemoryFormatsAttr)) {
+            rtInfo[ngraph::MLKDNNOutputMemoryFormatsAttr] =
+                std::make_shared<ngraph::VariantWrapper<ngraph::MLKDNNOutputMemoryFormats>>(ngraph::MLKDNNOutputMemoryFormats(attr.value()));
+        }
+    }
+}
+
+}  // namespace
+
+bool isSerializable(const std::shared_ptr<const ngraph::Function>& function,
+                    const std::map<std::string, ngraph::OpSet>& customOpsets) {
+    for (const auto& op : function->get_ops()) {
+        if (!isSerializableOp(op, customOpsets))
+            return false;
+    }
+    return true;
+}
+
+CNNNetworkSerializer::CNNNetworkSerializer(std::ostream& ostream, const std::map<std::string, ngraph::OpSet>& customOpsets)
+    : _ostream(ostream)
+    , _customOpsets(customOpsets) {
+}
+
+void CNNNetworkSerializer::serialize(const CNNNetwork& network, bool isTransformed) {
+    auto function = network.getFunction();
+    if (!function)
+        IE_THROW() << "CPU plug-in doesn't support not ngraph-based model!";
+
+    pugi::xml_document doc;
+    auto root = doc.append_child("cpu_network");
+    root.append_attribute("version").set_value(serializationVersion);
+    root.append_attribute("transformed").set_value(isTransformed);
+
+    std::vector<Blob::Ptr> meanImages;
+    auto inputsNode = root.append_child("inputs");
+    for (const auto& input : network.getInputsInfo()) {
+        auto inputNode = inputsNode.append_child("input");
+        inputNode.append_attribute("name").set_value(input.first.c_str());
+        inputNode.append_attribute("precision").set_value(input.second->getPrecision().name());
+        inputNode.append_attribute("layout").set_value(static_cast<int>(input.second->getLayout()));
+
+        const auto& preProcess = input.second->getPreProcess();
+        auto preProcessNode = inputNode.append_child("pre-process");
+        preProcessNode.append_attribute("mean_variant").set_value(static_cast<int>(preProcess.getMeanVariant()));
+        preProcessNode.append_attribute("resize_algorithm").set_value(static_cast<int>(preProcess.getResizeAlgorithm()));
+        preProcessNode.append_attribute("color_format").set_value(static_cast<int>(preProcess.getColorFormat()));
+        for (size_t c = 0; c < preProcess.getNumberOfChannels(); c++) {
+            auto channelNode = preProcessNode.append_child("channel");
+            channelNode.append_attribute("mean_value").set_value(preProcess[c]->meanValue);
+            channelNode.append_attribute("std_scale").set_value(preProcess[c]->stdScale);
+            if (preProcess.getMeanVariant() == MEAN_IMAGE && preProcess[c]->meanData) {
+                const auto& dims = preProcess[c]->meanData->getTensorDesc().getDims();
+                std::ostringstream dimsStream;
+                for (size_t i = 0; i < dims.size(); i++)
+                    dimsStream << (i ? "," : "") << dims[i];
+                channelNode.append_attribute("mean_image_dims").set_value(dimsStream.str().c_str());
+                meanImages.push_back(preProcess[c]->meanData);
+            }
+        }
+    }
+
+    auto outputsNode = root.append_child("outputs");
+    for (const auto& output : network.getOutputsInfo()) {
+        auto outputNode = outputsNode.append_child("output");
+        outputNode.append_attribute("name").set_value(output.first.c_str());
+        outputNode.append_attribute("precision").set_value(output.second->getPrecision().name());
+        outputNode.append_attribute("layout").set_value(static_cast<int>(output.second->getLayout()));
+    }
+
+    auto rtInfoNode = root.append_child("rt_info");
+    serializeRtInfo(rtInfoNode, function);
+
+    doc.save(_ostream, nullptr, pugi::format_raw);
+    _ostream << std::endl;
+
+    std::stringstream xmlFile, binFile;
+    ngraph::pass::Serialize serializer(xmlFile, binFile, ngraph::pass::Serialize::Version::IR_V10, _customOpsets);
+    serializer.run_on_function(std::const_pointer_cast<ngraph::Function>(function));
+
+    const auto model = xmlFile.str();
+    const auto constants = binFile.str();
+    writeData(_ostream, model.c_str(), model.size());
+    writeData(_ostream, constants.c_str(), constants.size());
+
+    for (const auto& meanImage : meanImages) {
+        auto memory = as<MemoryBlob>(meanImage);
+        IE_ASSERT(memory != nullptr);
+        auto locked = memory->rmap();
+        writeData(_ostream, locked.as<const char*>(), memory->byteSize());
+    }
+}
+
+CNNNetworkDeserializer::CNNNetworkDeserializer(std::istream& istream, NetworkBuilder networkBuilder)
+    : _istream(istream)
+    , _networkBuilder(std::move(networkBuilder)) {
+}
+
+bool CNNNetworkDeserializer::deserialize(CNNNetwork& network) {
+    std::string header;
+    std::getline(_istream, header);
+
+    pugi::xml_document doc;
+    auto res = doc.load_string(header.c_str());
+    if (res.status != pugi::status_ok)
+        IE_THROW(NetworkNotRead) << "Error reading CPU plugin exported network: " << res.description();
+
+    auto root = doc.child("cpu_network");
+    if (root.attribute("version").as_int() != serializationVersion)
+        IE_THROW(NetworkNotRead) << "Unsupported version of CPU plugin exported network";
+    const bool isTransformed = root.attribute("transformed").as_bool();
+
+    std::string model;
+    model.resize(readSize(_istream));
+    _istream.read(&model[0], model.size());
+
+    Blob::Ptr weights;
+    const auto weightsSize = readSize(_istream);
+    if (weightsSize != 0) {
+        weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {static_cast<size_t>(weightsSize)}, Layout::C));
+        weights->allocate();
+        _istream.read(weights->buffer(), weightsSize);
+    }
+    if (!_istream.good())
+        IE_THROW(NetworkNotRead) << "Unexpected end of the CPU plugin exported network stream";
+
+    network = _networkBuilder(model, weights);
+
+    auto inputsInfo = network.getInputsInfo();
+    for (const auto& inputNode : root.child("inputs").children("input")) {
+        auto it = inputsInfo.find(inputNode.attribute("name").value());
+        if (it == inputsInfo.end())
+            IE_THROW(NetworkNotRead) << "Input " << inputNode.attribute("name").value() << " was not found in exported network";
+        auto& input = it->second;
+        input->setPrecision(Precision::FromStr(inputNode.attribute("precision").value()));
+        input->setLayout(static_cast<Layout>(inputNode.attribute("layout").as_int()));
+
+        const auto preProcessNode = inputNode.child("pre-process");
+        auto& preProcess = input->getPreProcess();
+        const auto channels = std::distance(preProcessNode.children("channel").begin(), preProcessNode.children("channel").end());
+        if (channels > 0) {
+            preProcess.init(channels);
+            size_t c = 0;
+            for (const auto& channelNode : preProcessNode.children("channel")) {
+                preProcess[c]->meanValue = channelNode.attribute("mean_value").as_float();
+                preProcess[c]->stdScale = channelNode.attribute("std_scale").as_float();
+                if (const auto dimsAttr = channelNode.attribute("mean_image_dims")) {
+                    SizeVector dims;
+                    std::istringstream stream(dimsAttr.value());
+                    std::string dim;
+                    while (std::getline(stream, dim, ','))
+                        dims.push_back(std::stoul(dim));
+                    auto meanData = make_shared_blob<float>(TensorDesc(Precision::FP32, dims, TensorDesc::getLayoutByDims(dims)));
+                    meanData->allocate();
+                    const auto size = readSize(_istream);
+                    if (size != meanData->byteSize())
+                        IE_THROW(NetworkNotRead) << "Mean image size mismatch in CPU plugin exported network";
+                    _istream.read(meanData->buffer(), size);
+                    preProcess.setMeanImageForChannel(meanData, c);
+                }
+                c++;
+            }
+        }
+        preProcess.setVariant(static_cast<MeanVariant>(preProcessNode.attribute("mean_variant").as_int()));
+        preProcess.setResizeAlgorithm(static_cast<ResizeAlgorithm>(preProcessNode.attribute("resize_algorithm").as_int()));
+        preProcess.setColorFormat(static_cast<ColorFormat>(preProcessNode.attribute("color_format").as_int()));
+    }
+
+    auto outputsInfo = network.getOutputsInfo();
+    for (const auto& outputNode : root.child("outputs").children("output")) {
+        auto it = outputsInfo.find(outputNode.attribute("name").value());
+        if (it == outputsInfo.end())
+            IE_THROW(NetworkNotRead) << "Output " << outputNode.attribute("name").value() << " was not found in exported network";
+        it->second->setPrecision(Precision::FromStr(outputNode.attribute("precision").value()));
+        it->second->setLayout(static_cast<Layout>(outputNode.attribute("layout").as_int()));
+    }
+
+    deserializeRtInfo(root.child("rt_info"), network.getFunction());
+
+    return isTransformed;
+}
+
+}  // namespace MKLDNNPlugin
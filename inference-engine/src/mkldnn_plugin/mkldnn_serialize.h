@@ -0,0 +1,72 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+#include <ngraph/opsets/opset.hpp>
+
+#include <functional>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Checks that every operation of the function (including sub-graph bodies) can be written to IR
+ * and read back without losing information. Operations with relaxed types (produced by LPT) and internal
+ * operations that have no opset are not serializable.
+ */
+bool isSerializable(const std::shared_ptr<const ngraph::Function>& function,
+                    const std::map<std::string, ngraph::OpSet>& customOpsets);
+
+/**
+ * @brief Writes CNNNetwork together with its inputs/outputs info, preprocessing and the runtime info
+ * required by the CPU graph into a stream.
+ *
+ * Stream layout:
+ *   - pugixml document with network description, terminated with a line break
+ *   - uint64_t IR xml size, IR xml
+ *   - uint64_t weights size, weights
+ *   - for each input with MEAN_IMAGE preprocessing and for each its channel: uint64_t size, mean data
+ */
+class CNNNetworkSerializer {
+public:
+    CNNNetworkSerializer(std::ostream& ostream, const std::map<std::string, ngraph::OpSet>& customOpsets);
+
+    /**
+     * @param network network to serialize
+     * @param isTransformed true if plugin transformations were already applied to the network
+     */
+    void serialize(const InferenceEngine::CNNNetwork& network, bool isTransformed);
+
+private:
+    std::ostream& _ostream;
+    std::map<std::string, ngraph::OpSet> _customOpsets;
+};
+
+/**
+ * @brief Restores CNNNetwork written by CNNNetworkSerializer
+ */
+class CNNNetworkDeserializer {
+public:
+    using NetworkBuilder = std::function<InferenceEngine::CNNNetwork(const std::string& model,
+                                                                      const InferenceEngine::Blob::CPtr& weights)>;
+
+    CNNNetworkDeserializer(std::istream& istream, NetworkBuilder networkBuilder);
+
+    /**
+     * @param network restored network
+     * @return true if plugin transformations were already applied to the network
+     */
+    bool deserialize(InferenceEngine::CNNNetwork& network);
+
+private:
+    std::istream& _istream;
+    NetworkBuilder _networkBuilder;
+};
+
+}  // namespace MKLDNNPlugin
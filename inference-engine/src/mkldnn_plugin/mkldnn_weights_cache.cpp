@@ -9,8 +9,6 @@
 
 namespace MKLDNNPlugin {
 
-const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
-
 MKLDNNWeightsSharing::MKLDNNSharedMemory::MKLDNNSharedMemory(
         std::unique_lock<std::mutex> && lock,
         const MKLDNNMemoryInfo::Ptr & memory,
@@ -26,9 +26,10 @@ MKLDNNPlugin::FullyConnectedNode::FullyConnectedNode(const ngraph::Output<Node>&
 std::shared_ptr<ngraph::Node> MKLDNNPlugin::FullyConnectedNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
     check_new_args_count(this, new_args);
     if (new_args.size() == 2) {
-        return std::make_shared<MKLDNNPlugin::FullyConnectedNode>(new_args.at(0), new_args.at(1), m_output_shape);
+        return std::make_shared<MKLDNNPlugin::FullyConnectedNode>(new_args.at(0), new_args.at(1), m_output_shape, m_output_type);
     } else if (new_args.size() == 3) {
-        return std::make_shared<MKLDNNPlugin::FullyConnectedNode>(new_args.at(0), new_args.at(1), new_args.at(2), m_output_shape);
+        return std::make_shared<MKLDNNPlugin::FullyConnectedNode>(new_args.at(0), new_args.at(1), new_args.at(2), m_output_shape,
+                                                                  m_output_type);
     }
 
     throw ngraph::ngraph_error("Unsupported number of arguments for FullyConnected operation");
@@ -41,5 +42,7 @@ void MKLDNNPlugin::FullyConnectedNode::validate_and_infer_types() {
 
 bool MKLDNNPlugin::FullyConnectedNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
     visitor.on_attribute("out-size", m_output_size);
+    visitor.on_attribute("out-shape", m_output_shape);
+    visitor.on_attribute("out-type", m_output_type);
     return true;
 }
@@ -42,7 +42,7 @@ public:
 private:
     size_t m_output_size = 0;
     ngraph::Shape m_output_shape = {};
-    ngraph::element::Type m_output_type;
+    ngraph::element::Type m_output_type = ngraph::element::undefined;
 };
 
 }  // namespace MKLDNNPlugin
@@ -14,6 +14,8 @@ public:
     static constexpr const ::ngraph::Node::type_info_t& get_type_info_static() { return type_info; }
     const ngraph::NodeTypeInfo& get_type_info() const override { return type_info; }
 
+    LeakyReluNode() = default;
+
     LeakyReluNode(const ngraph::Output<ngraph::Node> &data, const float &negative_slope, const ngraph::element::Type output_type);
 
     void validate_and_infer_types() override;
@@ -27,8 +29,8 @@ public:
     ngraph::element::Type get_output_type() const { return m_output_type; }
 
 private:
-    float m_negative_slope;
-    ngraph::element::Type m_output_type;
+    float m_negative_slope = 0.f;
+    ngraph::element::Type m_output_type = ngraph::element::undefined;
 };
 
 }  // namespace MKLDNNPlugin
@@ -31,5 +31,6 @@ bool MKLDNNPlugin::PowerStaticNode::visit_attributes(ngraph::AttributeVisitor &v
     visitor.on_attribute("scale", scale);
     visitor.on_attribute("power", power);
     visitor.on_attribute("shift", shift);
+    visitor.on_attribute("out-type", m_output_type);
     return true;
 }
@@ -5,7 +5,10 @@
 #include "cpu_convert.h"
 #include "cpu_memcpy.h"
 #include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
 #include <mkldnn_selective_build.h>
+#include <algorithm>
+#include <precision_utils.h>
 #include <type_traits>
 #include <tuple>
 #include <ie_parallel.hpp>
@@ -71,6 +74,19 @@ void cpu_convert(const void *srcPtr, void *dstPtr, Precision srcPrc, Precision d
         return;
     }
 
+    // the vectored conversion of the precision utils gives the same results as static_cast for the values which fit
+    // into the destination precision, the rest ones are saturated
+    if (PrecisionUtils::canConvertArrays(srcPrc, dstPrc)) {
+        const size_t blockSize = 4096;
+        parallel_for(div_up(size, blockSize), [&](size_t block) {
+            const size_t start = block * blockSize;
+            PrecisionUtils::convertArrays(reinterpret_cast<uint8_t *>(dstPtr) + start * dstPrc.size(), dstPrc,
+                                          reinterpret_cast<const uint8_t *>(srcPtr) + start * srcPrc.size(), srcPrc,
+                                          std::min(blockSize, size - start));
+        });
+        return;
+    }
+
     ConvertContext ctx = { srcPtr, dstPtr, size, false };
 
     OV_SWITCH(MKLDNNPlugin, ConvertPrecision, ctx, std::tie(srcPrc, dstPrc),
@@ -7,6 +7,8 @@
 /**
  * @brief Copy size elements from buffer specified srcPtr pointer to buffer specified dstPtr.
  * If the precisions srcPrc and dstPrc are different, a conversion from srcPrc to dstPrc is performed.
+ * Conversions from FP32, FP16 and BF16 to U8, I8 and I32 truncate towards zero and saturate the values out of
+ * the destination range, NaN is converted to the lowest value.
  * @param srcPtr
  * pointer to the buffer to convert from
  * @param dstPtr
@@ -0,0 +1,363 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gather_kernel.h"
+
+#include <cstring>
+#include <limits>
+#include <mkldnn_types.h>
+#include "cpu_memcpy.h"
+#include "emitters/jit_load_store_emitters.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+using namespace mkldnn;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_args_gather, field)
+
+template <cpu_isa_t isa>
+struct jit_uni_gather_kernel_f32 : public jit_uni_gather_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_gather_kernel_f32)
+
+    explicit jit_uni_gather_kernel_f32(jit_gather_config_params jcp_) : jit_uni_gather_kernel(jcp_), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        load_emitter.reset(new jit_load_emitter(this, isa, nullptr));
+        store_emitter.reset(new jit_store_emitter(this, isa, nullptr));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_index_range, ptr[reg_params + GET_OFF(index_range)]);
+
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+        store_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx())};
+        store_pool_vec_idxs = {static_cast<size_t>(vmm_zero.getIdx())};
+
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+        xor_(reg_pos, reg_pos);
+
+        if (jcp.vector_gather)
+            gather_loop();
+        slice_loop();
+
+        this->postamble();
+
+        load_emitter->emit_data();
+        store_emitter->emit_data();
+
+        if (jcp.vector_gather)
+            prepare_table();
+    }
+
+private:
+    using Vmm = typename conditional<isa == cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int step = vlen / sizeof(int32_t);
+
+    // a vector of dword elements of short slices is filled by one vpgatherdd
+    void gather_loop() {
+        const int idx_per_vec = step / static_cast<int>(jcp.slice_len);
+
+        mov(reg_src_aux, l_table);
+        vmovq(xmm_tmp, reg_index_range);
+        vpbroadcastd(vmm_range, xmm_tmp);
+        mov(reg_tmp, jcp.idx_stride);
+        vmovq(xmm_tmp, reg_tmp);
+        vpbroadcastd(vmm_stride, xmm_tmp);
+        if (isa == cpu::x64::avx2)
+            uni_vpcmpeqd(vmm_minus_one, vmm_minus_one, vmm_minus_one);
+        if (jcp.slice_len > 1) {
+            uni_vmovdqu(vmm_perm, ptr[reg_src_aux]);
+            uni_vmovdqu(vmm_slice_off, ptr[reg_src_aux + vlen]);
+        }
+        if (jcp.elementwise) {
+            uni_vmovdqu(vmm_iota, ptr[reg_src_aux + 2 * vlen]);
+            mov(reg_tmp, step);
+            vmovq(xmm_tmp, reg_tmp);
+            vpbroadcastd(vmm_step, xmm_tmp);
+        }
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label main_loop_end_label;
+
+        L(main_loop_label);
+        {
+            cmp(reg_work_amount, idx_per_vec);
+            jl(main_loop_end_label, T_NEAR);
+
+            if (jcp.slice_len == 1) {
+                uni_vmovdqu(vmm_idx, ptr[reg_indices]);
+            } else {
+                // the index of each slice is repeated for all its elements: (0 1 2 3) -> (0 0 1 1 2 2 3 3)
+                load_emitter->emit_code({static_cast<size_t>(reg_indices.getIdx())}, {static_cast<size_t>(vmm_idx.getIdx())},
+                                        std::make_shared<load_emitter_context>(Precision::I32, Precision::I32, idx_per_vec),
+                                        {}, load_pool_gpr_idxs);
+                vpermd(vmm_idx, vmm_perm, vmm_idx);
+            }
+
+            uni_vpxor(vmm_dst, vmm_dst, vmm_dst);
+            if (isa == cpu::x64::avx2) {
+                // idx += idx < 0 ? range : 0, the mask is set for 0 <= idx < range
+                vpcmpgtd(vmm_tmp, vmm_zero, vmm_idx);
+                vpand(vmm_tmp, vmm_tmp, vmm_range);
+                vpaddd(vmm_idx, vmm_idx, vmm_tmp);
+                vpcmpgtd(vmm_mask, vmm_idx, vmm_minus_one);
+                vpcmpgtd(vmm_tmp, vmm_range, vmm_idx);
+                vpand(vmm_mask, vmm_mask, vmm_tmp);
+            } else {
+                vpcmpgtd(k_negative, vmm_zero, vmm_idx);
+                vpaddd(vmm_idx | k_negative, vmm_idx, vmm_range);
+                vpcmpud(k_gather, vmm_idx, vmm_range, _cmp_lt_os);
+            }
+
+            vpmulld(vmm_idx, vmm_idx, vmm_stride);
+            if (jcp.slice_len > 1)
+                vpaddd(vmm_idx, vmm_idx, vmm_slice_off);
+            if (jcp.elementwise) {
+                vpaddd(vmm_idx, vmm_idx, vmm_iota);
+                vpaddd(vmm_iota, vmm_iota, vmm_step);
+            }
+
+            // lanes of the indices out of the range are not loaded and stay zero
+            if (isa == cpu::x64::avx2)
+                vpgatherdd(vmm_dst, ptr[reg_src + vmm_idx * 4], vmm_mask);
+            else
+                vpgatherdd(vmm_dst | k_gather, ptr[reg_src + vmm_idx * 4]);
+            uni_vmovdqu(ptr[reg_dst], vmm_dst);
+
+            add(reg_indices, idx_per_vec * sizeof(int32_t));
+            add(reg_dst, vlen);
+            if (jcp.elementwise)
+                add(reg_pos, vlen);
+            sub(reg_work_amount, idx_per_vec);
+
+            jmp(main_loop_label, T_NEAR);
+        }
+        L(main_loop_end_label);
+    }
+
+    // the slices of the rest of the indices are copied one by one
+    void slice_loop() {
+        const size_t slice_bytes = jcp.slice_len * jcp.data_size;
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+        Xbyak::Label zero_slice_label;
+        Xbyak::Label next_label;
+
+        L(loop_label);
+        {
+            test(reg_work_amount, reg_work_amount);
+            jz(loop_end_label, T_NEAR);
+
+            mov(reg_dst_aux, reg_dst);
+
+            Xbyak::Label non_negative_label;
+            movsxd(reg_idx, dword[reg_indices]);
+            test(reg_idx, reg_idx);
+            jge(non_negative_label, T_NEAR);
+            add(reg_idx, reg_index_range);
+            L(non_negative_label);
+            // negative values are above the range as unsigned
+            cmp(reg_idx, reg_index_range);
+            jae(zero_slice_label, T_NEAR);
+
+            mov(reg_tmp, jcp.idx_stride * jcp.data_size);
+            imul(reg_idx, reg_tmp);
+            lea(reg_src_aux, ptr[reg_src + reg_idx]);
+            if (jcp.elementwise)
+                add(reg_src_aux, reg_pos);
+            copy_slice(slice_bytes, false);
+            jmp(next_label, T_NEAR);
+
+            L(zero_slice_label);
+            copy_slice(slice_bytes, true);
+
+            L(next_label);
+            add(reg_indices, sizeof(int32_t));
+            mov(reg_tmp, slice_bytes);
+            add(reg_dst, reg_tmp);
+            if (jcp.elementwise)
+                add(reg_pos, jcp.data_size);
+            dec(reg_work_amount);
+
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+    }
+
+    // copies the bytes from reg_src_aux (or zeros) to reg_dst_aux with full vectors and one partial vector for the tail
+    void copy_slice(size_t bytes, bool zeros) {
+        const size_t vec_num = bytes / vlen;
+        const int tail = static_cast<int>(bytes % vlen);
+        const size_t unroll = 4;
+
+        auto copy = [&](int offset, int size) {
+            if (!zeros) {
+                load_emitter->emit_code({static_cast<size_t>(reg_src_aux.getIdx())}, {static_cast<size_t>(vmm_data.getIdx())},
+                                        std::make_shared<load_emitter_context>(Precision::U8, Precision::U8, size, offset),
+                                        {}, load_pool_gpr_idxs);
+            }
+            const Vmm& vmm = zeros ? vmm_zero : vmm_data;
+            store_emitter->emit_code({static_cast<size_t>(vmm.getIdx())}, {static_cast<size_t>(reg_dst_aux.getIdx())},
+                                     std::make_shared<store_emitter_context>(Precision::U8, Precision::U8, size, offset),
+                                     store_pool_vec_idxs, store_pool_gpr_idxs);
+        };
+
+        int offset = 0;
+        if (vec_num > unroll) {
+            Xbyak::Label vec_loop_label;
+            mov(reg_count, vec_num);
+            L(vec_loop_label);
+            {
+                copy(0, vlen);
+                if (!zeros)
+                    add(reg_src_aux, vlen);
+                add(reg_dst_aux, vlen);
+                dec(reg_count);
+                jnz(vec_loop_label, T_NEAR);
+            }
+        } else {
+            for (size_t i = 0; i < vec_num; i++, offset += vlen)
+                copy(offset, vlen);
+        }
+        if (tail)
+            copy(offset, tail);
+    }
+
+    void prepare_table() {
+        align(64);
+        L(l_table);
+        // permutation repeating the index for the elements of its slice
+        for (int i = 0; i < step; i++)
+            dd(i / static_cast<int>(jcp.slice_len));
+        // offsets of the elements in the slice
+        for (int i = 0; i < step; i++)
+            dd(i % static_cast<int>(jcp.slice_len));
+        // positions of the elements in the vector
+        for (int i = 0; i < step; i++)
+            dd(i);
+    }
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_indices = r9;
+    Xbyak::Reg64 reg_dst = r10;
+    Xbyak::Reg64 reg_work_amount = r11;
+    Xbyak::Reg64 reg_index_range = r12;
+    Xbyak::Reg64 reg_idx = r13;
+    Xbyak::Reg64 reg_src_aux = r14;
+    Xbyak::Reg64 reg_dst_aux = rsi;
+    Xbyak::Reg64 reg_pos = rbx;
+    Xbyak::Reg64 reg_count = rax;
+    Xbyak::Reg64 reg_tmp = rdx;
+
+    Xbyak::Reg64 reg_load_table = r15;
+    Xbyak::Reg64 reg_load_store_mask = abi_param1;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_zero = Vmm(0);
+    Vmm vmm_idx = Vmm(1);
+    Vmm vmm_mask = Vmm(2);
+    Vmm vmm_dst = Vmm(3);
+    Vmm vmm_range = Vmm(4);
+    Vmm vmm_stride = Vmm(5);
+    Vmm vmm_perm = Vmm(6);
+    Vmm vmm_slice_off = Vmm(7);
+    Vmm vmm_iota = Vmm(8);
+    Vmm vmm_step = Vmm(9);
+    Vmm vmm_minus_one = Vmm(10);
+    Vmm vmm_tmp = Vmm(11);
+    Xbyak::Xmm xmm_tmp = Xbyak::Xmm(11);
+    Vmm vmm_data = Vmm(12);
+
+    // k1 is used by the load and store emitters
+    Xbyak::Opmask k_negative = Xbyak::Opmask(2);
+    Xbyak::Opmask k_gather = Xbyak::Opmask(3);
+
+    const unsigned char _cmp_lt_os = 1;
+
+    Xbyak::Label l_table;
+
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+    std::vector<size_t> load_pool_gpr_idxs;
+
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
+    std::vector<size_t> store_pool_gpr_idxs;
+    std::vector<size_t> store_pool_vec_idxs;
+};
+
+GatherKernel::GatherKernel(size_t data_size, size_t slice_len, size_t idx_stride, size_t src_len, bool elementwise) {
+    jcp.data_size = data_size;
+    jcp.slice_len = slice_len;
+    jcp.idx_stride = idx_stride;
+    jcp.elementwise = elementwise;
+
+    if (slice_len == 0)
+        return;
+
+    const size_t vlen = mayiuse(cpu::x64::avx512_core) ? cpu_isa_traits<cpu::x64::avx512_common>::vlen
+                                                       : cpu_isa_traits<cpu::x64::avx2>::vlen;
+    const size_t step = vlen / sizeof(int32_t);
+    // vpgatherdd addresses dword elements with signed dword offsets, slices of a vector length are copied faster
+    jcp.vector_gather = data_size == sizeof(int32_t) && step % slice_len == 0 && slice_len < step &&
+                        (!elementwise || slice_len == 1) &&
+                        src_len <= static_cast<size_t>(std::numeric_limits<int32_t>::max());
+
+    if (mayiuse(cpu::x64::avx512_core)) {
+        gather_kernel.reset(new jit_uni_gather_kernel_f32<cpu::x64::avx512_common>(jcp));
+    } else if (mayiuse(cpu::x64::avx2)) {
+        gather_kernel.reset(new jit_uni_gather_kernel_f32<cpu::x64::avx2>(jcp));
+    }
+
+    if (gather_kernel)
+        gather_kernel->create_ker();
+}
+
+void GatherKernel::execute(const uint8_t* src_data, const int32_t* indices, uint8_t* dst_data,
+                           size_t work_amount, size_t index_range) const {
+    if (!gather_kernel) {
+        referenceExecute(src_data, indices, dst_data, work_amount, index_range);
+        return;
+    }
+
+    auto arg = jit_args_gather();
+    arg.src = src_data;
+    arg.indices = indices;
+    arg.dst = dst_data;
+    arg.work_amount = work_amount;
+    arg.index_range = index_range;
+    (*gather_kernel)(&arg);
+}
+
+void GatherKernel::referenceExecute(const uint8_t* src_data, const int32_t* indices, uint8_t* dst_data,
+                                    size_t work_amount, size_t index_range) const {
+    const size_t slice_bytes = jcp.slice_len * jcp.data_size;
+    for (size_t j = 0; j < work_amount; j++) {
+        int64_t idx = indices[j];
+        if (idx < 0)
+            idx += static_cast<int64_t>(index_range);
+        uint8_t* dst = dst_data + j * slice_bytes;
+        if (idx < 0 || static_cast<size_t>(idx) >= index_range) {
+            memset(dst, 0, slice_bytes);
+            continue;
+        }
+        const size_t src_offset = static_cast<size_t>(idx) * jcp.idx_stride + (jcp.elementwise ? j : 0);
+        cpu_memcpy(dst, src_data + src_offset * jcp.data_size, slice_bytes);
+    }
+}
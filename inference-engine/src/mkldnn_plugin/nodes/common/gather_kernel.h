@@ -0,0 +1,75 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+struct jit_gather_config_params {
+    size_t data_size;
+    size_t slice_len;
+    size_t idx_stride;
+    bool elementwise;
+    bool vector_gather;
+};
+
+struct jit_args_gather {
+    const void* src;
+    const int32_t* indices;
+    void* dst;
+    size_t work_amount;
+    size_t index_range;
+};
+
+struct jit_uni_gather_kernel {
+    void (*ker_)(const jit_args_gather *);
+
+    void operator()(const jit_args_gather *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_gather_kernel(jit_gather_config_params jcp_) : ker_(nullptr), jcp(jcp_) {}
+    virtual ~jit_uni_gather_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_gather_config_params jcp;
+};
+
+/**
+ * Copies the slices of the source selected by the indices one after another to the destination. The slice of the index
+ * value i is slice_len elements starting at the element i * idx_stride of the source. In the elementwise mode the slice
+ * of the index at the position j starts at the element i * idx_stride + j instead.
+ * Negative index values count from the end of the index range, the slices of the values out of the range are zeros.
+ *
+ * The slices of one dword element are gathered with vpgatherdd, long slices are copied with full vector loads and stores.
+ */
+class GatherKernel {
+public:
+    /**
+     * @param data_size size of the element in bytes
+     * @param slice_len number of the elements in the slice
+     * @param idx_stride number of the elements between the slices of the consecutive index values
+     * @param src_len number of the elements in the source which may be addressed
+     * @param elementwise the position of the index is added to the start of its slice
+     */
+    GatherKernel(size_t data_size, size_t slice_len, size_t idx_stride, size_t src_len, bool elementwise = false);
+
+    void execute(const uint8_t* src_data, const int32_t* indices, uint8_t* dst_data,
+                 size_t work_amount, size_t index_range) const;
+
+private:
+    void referenceExecute(const uint8_t* src_data, const int32_t* indices, uint8_t* dst_data,
+                          size_t work_amount, size_t index_range) const;
+
+    jit_gather_config_params jcp = {};
+    std::shared_ptr<jit_uni_gather_kernel> gather_kernel;
+};
+
+}  // namespace MKLDNNPlugin
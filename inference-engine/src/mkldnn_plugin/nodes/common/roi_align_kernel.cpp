@@ -0,0 +1,258 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "roi_align_kernel.h"
+
+#include <algorithm>
+#include <vector>
+#include <mkldnn_types.h>
+#include <utils/bfloat16.hpp>
+#include <utils/general_utils.h>
+#include "emitters/jit_load_store_emitters.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+using namespace mkldnn;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_args_roi_align, field)
+
+template <cpu_isa_t isa>
+struct jit_uni_roi_align_kernel_f32 : public jit_uni_roi_align_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_roi_align_kernel_f32)
+
+    explicit jit_uni_roi_align_kernel_f32(jit_roi_align_config_params jcp_) : jit_uni_roi_align_kernel(jcp_), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        load_emitter.reset(new jit_load_emitter(this, isa, nullptr));
+        store_emitter.reset(new jit_store_emitter(this, isa, nullptr));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_offsets, ptr[reg_params + GET_OFF(offsets)]);
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_num_samples, ptr[reg_params + GET_OFF(num_samples)]);
+        if (jcp.alg == Algorithm::ROIAlignAvg)
+            uni_vbroadcastss(vmm_scale, ptr[reg_params + GET_OFF(scale)]);
+
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+        store_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx())};
+        store_pool_vec_idxs = {static_cast<size_t>(vmm_zero.getIdx())};
+
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+
+        // the channels are pooled by groups of vectors, the interpolation points of a sample are loaded once per group
+        const size_t group_len = max_accs * step;
+        const size_t full_groups = jcp.channels / group_len;
+        const std::vector<int> full_group(max_accs, step);
+        if (full_groups > 1) {
+            Xbyak::Label group_loop_label;
+            mov(reg_groups, full_groups);
+            L(group_loop_label);
+            {
+                pool_group(full_group);
+                add(reg_src, group_len * jcp.src_prc.size());
+                add(reg_dst, group_len * jcp.dst_prc.size());
+                dec(reg_groups);
+                jnz(group_loop_label, T_NEAR);
+            }
+        } else if (full_groups == 1) {
+            pool_group(full_group);
+            add(reg_src, group_len * jcp.src_prc.size());
+            add(reg_dst, group_len * jcp.dst_prc.size());
+        }
+
+        std::vector<int> tail_group;
+        for (size_t rest = jcp.channels - full_groups * group_len; rest > 0; rest -= std::min(rest, static_cast<size_t>(step)))
+            tail_group.push_back(static_cast<int>(std::min(rest, static_cast<size_t>(step))));
+        if (!tail_group.empty())
+            pool_group(tail_group);
+
+        this->postamble();
+
+        load_emitter->emit_data();
+        store_emitter->emit_data();
+    }
+
+private:
+    using Vmm = typename conditional<isa == cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int step = vlen / sizeof(float);
+    const int max_accs = 4;
+
+    // pools the vectors of the given lengths starting at reg_src into the vectors starting at reg_dst
+    void pool_group(const std::vector<int>& lens) {
+        const bool is_max = jcp.alg == Algorithm::ROIAlignMax;
+        const int num = static_cast<int>(lens.size());
+
+        for (int i = 0; i < num; i++)
+            uni_vpxor(get_acc(i), get_acc(i), get_acc(i));
+
+        mov(reg_offsets_aux, reg_offsets);
+        mov(reg_weights_aux, reg_weights);
+        mov(reg_samples, reg_num_samples);
+
+        Xbyak::Label sample_loop_label;
+        Xbyak::Label sample_loop_end_label;
+
+        test(reg_samples, reg_samples);
+        jz(sample_loop_end_label, T_NEAR);
+        L(sample_loop_label);
+        {
+            for (int p = 0; p < 4; p++) {
+                movsxd(reg_point, dword[reg_offsets_aux + p * sizeof(int32_t)]);
+                lea(reg_src_aux, ptr[reg_src + reg_point]);
+                uni_vbroadcastss(vmm_weight, ptr[reg_weights_aux + p * sizeof(float)]);
+                for (int i = 0; i < num; i++) {
+                    load_emitter->emit_code({static_cast<size_t>(reg_src_aux.getIdx())}, {static_cast<size_t>(vmm_src.getIdx())},
+                                            std::make_shared<load_emitter_context>(jcp.src_prc, Precision::FP32, lens[i],
+                                                                                   i * step * jcp.src_prc.size()),
+                                            {}, load_pool_gpr_idxs);
+                    if (!is_max) {
+                        uni_vfmadd231ps(get_acc(i), vmm_src, vmm_weight);
+                    } else if (p == 0) {
+                        uni_vmulps(get_sample(i), vmm_src, vmm_weight);
+                    } else {
+                        uni_vmulps(vmm_src, vmm_src, vmm_weight);
+                        uni_vmaxps(get_sample(i), get_sample(i), vmm_src);
+                    }
+                }
+            }
+            if (is_max) {
+                for (int i = 0; i < num; i++)
+                    uni_vmaxps(get_acc(i), get_acc(i), get_sample(i));
+            }
+
+            add(reg_offsets_aux, 4 * sizeof(int32_t));
+            add(reg_weights_aux, 4 * sizeof(float));
+            dec(reg_samples);
+            jnz(sample_loop_label, T_NEAR);
+        }
+        L(sample_loop_end_label);
+
+        for (int i = 0; i < num; i++) {
+            if (!is_max)
+                uni_vmulps(get_acc(i), get_acc(i), vmm_scale);
+            store_emitter->emit_code({static_cast<size_t>(get_acc(i).getIdx())}, {static_cast<size_t>(reg_dst.getIdx())},
+                                     std::make_shared<store_emitter_context>(Precision::FP32, jcp.dst_prc, lens[i],
+                                                                             i * step * jcp.dst_prc.size()),
+                                     store_pool_vec_idxs, store_pool_gpr_idxs);
+        }
+    }
+
+    Vmm get_acc(int i) const {
+        return Vmm(1 + i);
+    }
+
+    Vmm get_sample(int i) const {
+        return Vmm(1 + max_accs + i);
+    }
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_offsets = r9;
+    Xbyak::Reg64 reg_weights = r10;
+    Xbyak::Reg64 reg_dst = r11;
+    Xbyak::Reg64 reg_num_samples = r12;
+    Xbyak::Reg64 reg_offsets_aux = r13;
+    Xbyak::Reg64 reg_weights_aux = r14;
+    Xbyak::Reg64 reg_src_aux = rsi;
+    Xbyak::Reg64 reg_samples = rbx;
+    Xbyak::Reg64 reg_point = rax;
+    Xbyak::Reg64 reg_groups = rdx;
+
+    Xbyak::Reg64 reg_load_table = r15;
+    Xbyak::Reg64 reg_load_store_mask = abi_param1;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    // Vmm(1) - Vmm(8) are the accumulators and the samples of the max mode
+    Vmm vmm_zero = Vmm(0);
+    Vmm vmm_src = Vmm(9);
+    Vmm vmm_weight = Vmm(10);
+    Vmm vmm_scale = Vmm(11);
+
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+    std::vector<size_t> load_pool_gpr_idxs;
+
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
+    std::vector<size_t> store_pool_gpr_idxs;
+    std::vector<size_t> store_pool_vec_idxs;
+};
+
+ROIAlignKernel::ROIAlignKernel(Algorithm alg, Precision src_prc, Precision dst_prc, size_t channels) {
+    if (!MKLDNNPlugin::one_of(src_prc, Precision::FP32, Precision::BF16) || !MKLDNNPlugin::one_of(dst_prc, Precision::FP32, Precision::BF16))
+        IE_THROW() << "ROIAlign kernel doesn't support precisions " << src_prc << " and " << dst_prc;
+
+    jcp.alg = alg;
+    jcp.src_prc = src_prc;
+    jcp.dst_prc = dst_prc;
+    jcp.channels = channels;
+
+    if (channels == 0)
+        return;
+
+    if (mayiuse(cpu::x64::avx512_core)) {
+        roi_align_kernel.reset(new jit_uni_roi_align_kernel_f32<cpu::x64::avx512_common>(jcp));
+    } else if (mayiuse(cpu::x64::avx2)) {
+        roi_align_kernel.reset(new jit_uni_roi_align_kernel_f32<cpu::x64::avx2>(jcp));
+    }
+
+    if (roi_align_kernel)
+        roi_align_kernel->create_ker();
+}
+
+void ROIAlignKernel::execute(const uint8_t* src_data, const int32_t* offsets, const float* weights, size_t num_samples,
+                             float scale, uint8_t* dst_data) const {
+    if (!roi_align_kernel) {
+        if (jcp.src_prc == Precision::BF16 && jcp.dst_prc == Precision::BF16) {
+            referenceExecute<bfloat16_t, bfloat16_t>(src_data, offsets, weights, num_samples, scale, dst_data);
+        } else if (jcp.src_prc == Precision::BF16) {
+            referenceExecute<bfloat16_t, float>(src_data, offsets, weights, num_samples, scale, dst_data);
+        } else if (jcp.dst_prc == Precision::BF16) {
+            referenceExecute<float, bfloat16_t>(src_data, offsets, weights, num_samples, scale, dst_data);
+        } else {
+            referenceExecute<float, float>(src_data, offsets, weights, num_samples, scale, dst_data);
+        }
+        return;
+    }
+
+    auto arg = jit_args_roi_align();
+    arg.src = src_data;
+    arg.offsets = offsets;
+    arg.weights = weights;
+    arg.dst = dst_data;
+    arg.num_samples = num_samples;
+    arg.scale = scale;
+    (*roi_align_kernel)(&arg);
+}
+
+template <typename srcT, typename dstT>
+void ROIAlignKernel::referenceExecute(const uint8_t* src_data, const int32_t* offsets, const float* weights, size_t num_samples,
+                                      float scale, uint8_t* dst_data) const {
+    auto* dst = reinterpret_cast<dstT*>(dst_data);
+    for (size_t c = 0; c < jcp.channels; c++) {
+        float pooled = 0.0f;
+        for (size_t s = 0; s < num_samples; s++) {
+            float points[4];
+            for (size_t p = 0; p < 4; p++)
+                points[p] = weights[4 * s + p] * static_cast<float>(reinterpret_cast<const srcT*>(src_data + offsets[4 * s + p])[c]);
+            if (jcp.alg == Algorithm::ROIAlignMax)
+                pooled = std::max({pooled, points[0], points[1], points[2], points[3]});
+            else
+                pooled += points[0] + points[1] + points[2] + points[3];
+        }
+        dst[c] = static_cast<dstT>(jcp.alg == Algorithm::ROIAlignMax ? pooled : pooled * scale);
+    }
+}
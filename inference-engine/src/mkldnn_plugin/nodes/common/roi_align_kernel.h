@@ -0,0 +1,85 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <ie_precision.hpp>
+#include <mkldnn_node.h>
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+struct jit_roi_align_config_params {
+    Algorithm alg;
+    InferenceEngine::Precision src_prc;
+    InferenceEngine::Precision dst_prc;
+    size_t channels;
+};
+
+struct jit_args_roi_align {
+    const void* src;
+    const int32_t* offsets;
+    const float* weights;
+    void* dst;
+    size_t num_samples;
+    float scale;
+};
+
+struct jit_uni_roi_align_kernel {
+    void (*ker_)(const jit_args_roi_align *);
+
+    void operator()(const jit_args_roi_align *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_roi_align_kernel(jit_roi_align_config_params jcp_) : ker_(nullptr), jcp(jcp_) {}
+    virtual ~jit_uni_roi_align_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_roi_align_config_params jcp;
+};
+
+/**
+ * Pools one bin of ROIAlign for the channels stored one after another in the source and in the destination, i.e. the
+ * channel block of nChw8c/nChw16c or all the channels of nhwc. Every sample of the bin is given by the byte offsets of
+ * its four interpolation points from the source and by their bilinear weights. The offsets and the weights depend only
+ * on the ROI, so they are computed once per ROI and the kernel applies them to all the channels with vector loads.
+ *
+ * The average mode sums the weighted points of all the samples and multiplies the sum by the scale. The max mode takes
+ * the maximum of the weighted points of each sample and the maximum over the samples, starting from zero.
+ */
+class ROIAlignKernel {
+public:
+    /**
+     * @param alg ROIAlignAvg or ROIAlignMax
+     * @param src_prc precision of the source, FP32 or BF16
+     * @param dst_prc precision of the destination, FP32 or BF16
+     * @param channels number of the channels pooled by one call
+     */
+    ROIAlignKernel(Algorithm alg, InferenceEngine::Precision src_prc, InferenceEngine::Precision dst_prc, size_t channels);
+
+    /**
+     * @param offsets 4 * num_samples byte offsets of the interpolation points from src_data
+     * @param weights 4 * num_samples weights of the interpolation points
+     */
+    void execute(const uint8_t* src_data, const int32_t* offsets, const float* weights, size_t num_samples,
+                 float scale, uint8_t* dst_data) const;
+
+    size_t getChannels() const {
+        return jcp.channels;
+    }
+
+private:
+    template <typename srcT, typename dstT>
+    void referenceExecute(const uint8_t* src_data, const int32_t* offsets, const float* weights, size_t num_samples,
+                          float scale, uint8_t* dst_data) const;
+
+    jit_roi_align_config_params jcp = {};
+    std::shared_ptr<jit_uni_roi_align_kernel> roi_align_kernel;
+};
+
+}  // namespace MKLDNNPlugin
@@ -9,10 +9,12 @@
 #include <ngraph/opsets/opset6.hpp>
 #include "ie_parallel.hpp"
 #include "common/cpu_memcpy.h"
+#include <cpu/x64/cpu_isa_traits.hpp>
 #include "mkldnn_experimental_detectron_roifeatureextractor_node.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
 
 // implementation taken from Caffe2
 template <typename T>
@@ -123,6 +125,59 @@ void pre_calc_for_bilinear_interpolate(
     }
 }
 
+// computes the interpolation points of all the bins of the ROI, returns the number of the samples in a bin
+template <typename T>
+int pre_calc_for_roi(
+        const T* offset_bottom_rois,
+        const T& spatial_scale,
+        const int height,
+        const int width,
+        const int pooled_height,
+        const int pooled_width,
+        const int sampling_ratio,
+        const bool aligned,
+        std::vector<PreCalc<T>>& pre_calc) {
+    T offset = aligned ? (T)0.5 : (T)0.0;
+    // Do not using rounding; this implementation detail is critical
+    T roi_start_w = offset_bottom_rois[0] * spatial_scale - offset;
+    T roi_start_h = offset_bottom_rois[1] * spatial_scale - offset;
+    T roi_end_w = offset_bottom_rois[2] * spatial_scale - offset;
+    T roi_end_h = offset_bottom_rois[3] * spatial_scale - offset;
+
+    // Force malformed ROIs to be 1x1
+    T roi_width = (std::max)(roi_end_w - roi_start_w, (T)1.);
+    T roi_height = (std::max)(roi_end_h - roi_start_h, (T)1.);
+    T bin_size_h = static_cast<T>(roi_height) / static_cast<T>(pooled_height);
+    T bin_size_w = static_cast<T>(roi_width) / static_cast<T>(pooled_width);
+
+    // We use roi_bin_grid to sample the grid and mimic integral
+    int roi_bin_grid_h = (sampling_ratio > 0)
+                         ? sampling_ratio
+                         : static_cast<int>(ceil(roi_height / pooled_height));  // e.g., = 2
+    int roi_bin_grid_w =
+            (sampling_ratio > 0) ? sampling_ratio : static_cast<int>(ceil(roi_width / pooled_width));
+
+    // we want to precalculate indeces and weights shared by all chanels,
+    // this is the key point of optimiation
+    pre_calc.resize(roi_bin_grid_h * roi_bin_grid_w * pooled_width * pooled_height);
+    pre_calc_for_bilinear_interpolate(
+            height,
+            width,
+            pooled_height,
+            pooled_width,
+            roi_bin_grid_h,
+            roi_bin_grid_w,
+            roi_start_h,
+            roi_start_w,
+            bin_size_h,
+            bin_size_w,
+            roi_bin_grid_h,
+            roi_bin_grid_w,
+            pre_calc);
+
+    return roi_bin_grid_h * roi_bin_grid_w;
+}
+
 template <typename T>
 void ROIAlignForward_cpu_kernel(
         const int nthreads,
@@ -152,47 +207,11 @@ void ROIAlignForward_cpu_kernel(
             offset_bottom_rois++;
         }
 
-        T offset = aligned ? (T)0.5 : (T)0.0;
-        // Do not using rounding; this implementation detail is critical
-        T roi_start_w = offset_bottom_rois[0] * spatial_scale - offset;
-        T roi_start_h = offset_bottom_rois[1] * spatial_scale - offset;
-        T roi_end_w = offset_bottom_rois[2] * spatial_scale - offset;
-        T roi_end_h = offset_bottom_rois[3] * spatial_scale - offset;
-
-        // Force malformed ROIs to be 1x1
-        T roi_width = (std::max)(roi_end_w - roi_start_w, (T)1.);
-        T roi_height = (std::max)(roi_end_h - roi_start_h, (T)1.);
-        T bin_size_h = static_cast<T>(roi_height) / static_cast<T>(pooled_height);
-        T bin_size_w = static_cast<T>(roi_width) / static_cast<T>(pooled_width);
-
-        // We use roi_bin_grid to sample the grid and mimic integral
-        int roi_bin_grid_h = (sampling_ratio > 0)
-                             ? sampling_ratio
-                             : static_cast<int>(ceil(roi_height / pooled_height));  // e.g., = 2
-        int roi_bin_grid_w =
-                (sampling_ratio > 0) ? sampling_ratio : static_cast<int>(ceil(roi_width / pooled_width));
-
+        std::vector<PreCalc<T>> pre_calc;
+        const int samples_num = pre_calc_for_roi(offset_bottom_rois, spatial_scale, height, width, pooled_height, pooled_width,
+                                                 sampling_ratio, aligned, pre_calc);
         // We do average (integral) pooling inside a bin
-        const T count = static_cast<T>(roi_bin_grid_h * roi_bin_grid_w);  // e.g. = 4
-
-        // we want to precalculate indeces and weights shared by all chanels,
-        // this is the key point of optimiation
-        std::vector<PreCalc<T>> pre_calc(
-                roi_bin_grid_h * roi_bin_grid_w * pooled_width * pooled_height);
-        pre_calc_for_bilinear_interpolate(
-                height,
-                width,
-                pooled_height,
-                pooled_width,
-                roi_bin_grid_h,
-                roi_bin_grid_w,
-                roi_start_h,
-                roi_start_w,
-                bin_size_h,
-                bin_size_w,
-                roi_bin_grid_h,
-                roi_bin_grid_w,
-                pre_calc);
+        const T count = static_cast<T>(samples_num);  // e.g. = 4
 
         for (int c = 0; c < channels; c++) {
             int index_n_c = index_n + c * pooled_width * pooled_height;
@@ -205,16 +224,14 @@ void ROIAlignForward_cpu_kernel(
                     int index = index_n_c + ph * pooled_width + pw;
 
                     T output_val = 0.;
-                    for (int iy = 0; iy < roi_bin_grid_h; iy++) {
-                        for (int ix = 0; ix < roi_bin_grid_w; ix++) {
-                            PreCalc<T> pc = pre_calc[pre_calc_index];
-                            output_val += pc.w1 * offset_bottom_data[pc.pos1] +
-                                          pc.w2 * offset_bottom_data[pc.pos2] +
-                                          pc.w3 * offset_bottom_data[pc.pos3] +
-                                          pc.w4 * offset_bottom_data[pc.pos4];
-
-                            pre_calc_index += 1;
-                        }
+                    for (int i = 0; i < samples_num; i++) {
+                        PreCalc<T> pc = pre_calc[pre_calc_index];
+                        output_val += pc.w1 * offset_bottom_data[pc.pos1] +
+                                      pc.w2 * offset_bottom_data[pc.pos2] +
+                                      pc.w3 * offset_bottom_data[pc.pos3] +
+                                      pc.w4 * offset_bottom_data[pc.pos4];
+
+                        pre_calc_index += 1;
                     }
                     output_val /= count;
 
@@ -225,6 +242,59 @@ void ROIAlignForward_cpu_kernel(
     });
 }
 
+// the feature map and the output store the channels by blocks of block_size contiguous channels: nhwc is one block of
+// all the channels, nChw8c and nChw16c are the blocks of 8 and 16 channels, the channels are padded to the whole blocks
+void ROIAlignForward_jit_kernel(
+        const ROIAlignKernel& kernel,
+        const int n_rois,
+        const float* bottom_data,
+        const float spatial_scale,
+        const int channels_padded,
+        const int block_size,
+        const int height,
+        const int width,
+        const int pooled_height,
+        const int pooled_width,
+        const int sampling_ratio,
+        const float* bottom_rois,
+        const bool aligned,
+        float* top_data) {
+    const int blocks_num = channels_padded / block_size;
+    const int bins_num = pooled_height * pooled_width;
+
+    parallel_for(n_rois, [&](size_t n) {
+        std::vector<PreCalc<float>> pre_calc;
+        const int samples_num = pre_calc_for_roi(bottom_rois + n * 4, spatial_scale, height, width, pooled_height, pooled_width,
+                                                 sampling_ratio, aligned, pre_calc);
+
+        // byte offsets of the interpolation points from the first channel of the block
+        std::vector<int32_t> offsets(4 * pre_calc.size());
+        std::vector<float> weights(4 * pre_calc.size());
+        for (size_t i = 0; i < pre_calc.size(); i++) {
+            const auto& pc = pre_calc[i];
+            offsets[4 * i + 0] = static_cast<int32_t>(pc.pos1 * block_size * sizeof(float));
+            offsets[4 * i + 1] = static_cast<int32_t>(pc.pos2 * block_size * sizeof(float));
+            offsets[4 * i + 2] = static_cast<int32_t>(pc.pos3 * block_size * sizeof(float));
+            offsets[4 * i + 3] = static_cast<int32_t>(pc.pos4 * block_size * sizeof(float));
+            weights[4 * i + 0] = pc.w1;
+            weights[4 * i + 1] = pc.w2;
+            weights[4 * i + 2] = pc.w3;
+            weights[4 * i + 3] = pc.w4;
+        }
+        const float scale = 1.0f / samples_num;
+
+        for (int b = 0; b < blocks_num; b++) {
+            const float* offset_bottom_data = bottom_data + b * block_size * height * width;
+            float* offset_top_data = top_data + (n * channels_padded + b * block_size) * bins_num;
+            for (int bin = 0; bin < bins_num; bin++) {
+                const size_t pre_calc_index = 4 * bin * samples_num;
+                kernel.execute(reinterpret_cast<const uint8_t*>(offset_bottom_data), &offsets[pre_calc_index],
+                               &weights[pre_calc_index], samples_num, scale,
+                               reinterpret_cast<uint8_t*>(offset_top_data + bin * block_size));
+            }
+        }
+    });
+}
 
 void redistribute_rois(const float* rois, int* level_ids,
                        const int num_rois, const int levels_num) {
@@ -339,22 +409,67 @@ void MKLDNNExperimentalDetectronROIFeatureExtractorNode::initSupportedPrimitiveD
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
-    std::vector<PortConfigurator> inDataConf;
-    inDataConf.reserve(getOriginalInputsNumber());
-    for (int i = 0; i < getOriginalInputsNumber(); ++i)
+    // the kernel pools the channels stored one after another, so ncsp stays with the scalar implementation
+    impl_desc_type jitImplType;
+    if (mayiuse(avx512_core)) {
+        jitImplType = impl_desc_type::jit_avx512;
+    } else if (mayiuse(avx2)) {
+        jitImplType = impl_desc_type::jit_avx2;
+    } else {
+        jitImplType = impl_desc_type::ref_any;
+    }
+
+    // the feature maps are pooled in the layout of their producers, so no reorders are inserted for them
+    std::vector<LayoutType> dataFormats{ LayoutType::ncsp };
+    if (jitImplType != impl_desc_type::ref_any && getParentEdgeAt(INPUT_FEATURES_START)->getShape().getStaticDims()[1] != 1) {
+        dataFormats.push_back(LayoutType::nspc);
+        dataFormats.push_back(LayoutType::nCsp16c);
+        dataFormats.push_back(LayoutType::nCsp8c);
+    }
+
+    for (const auto &df : dataFormats) {
+        std::vector<PortConfigurator> inDataConf;
+        inDataConf.reserve(getOriginalInputsNumber());
         inDataConf.emplace_back(LayoutType::ncsp, Precision::FP32);
+        for (int i = INPUT_FEATURES_START; i < getOriginalInputsNumber(); ++i)
+            inDataConf.emplace_back(df, Precision::FP32);
+
+        addSupportedPrimDesc(inDataConf,
+                             {{df, Precision::FP32},
+                              {LayoutType::ncsp, Precision::FP32}},
+                             df == LayoutType::ncsp ? impl_desc_type::ref_any : jitImplType);
+    }
+}
+
+void MKLDNNExperimentalDetectronROIFeatureExtractorNode::selectOptimalPrimitiveDescriptor() {
+    if (!selectPrimitiveDescriptorByParentLayout(INPUT_FEATURES_START))
+        MKLDNNNode::selectOptimalPrimitiveDescriptor();
+}
+
+void MKLDNNExperimentalDetectronROIFeatureExtractorNode::createPrimitive() {
+    auto selectedPD = getSelectedPrimitiveDescriptor();
+    if (!selectedPD)
+        IE_THROW() << "ExperimentalDetectronROIFeatureExtractor node with name '" << getName() << "' has no preferable primitive descriptor";
 
-    addSupportedPrimDesc(inDataConf,
-                         {{LayoutType::ncsp, Precision::FP32},
-                          {LayoutType::ncsp, Precision::FP32}},
-                         impl_desc_type::ref_any);
+    const auto &featuresDesc = selectedPD->getConfig().inConfs[INPUT_FEATURES_START].desc;
+    if (featuresDesc->hasLayoutType(LayoutType::ncsp))
+        return;
+
+    size_t channels = getParentEdgeAt(INPUT_FEATURES_START)->getShape().getStaticDims()[1];
+    if (featuresDesc->hasLayoutType(LayoutType::nCsp16c))
+        channels = 16;
+    else if (featuresDesc->hasLayoutType(LayoutType::nCsp8c))
+        channels = 8;
+    roiAlignKernel_ = std::make_shared<ROIAlignKernel>(Algorithm::ROIAlignAvg, Precision::FP32, Precision::FP32, channels);
 }
 
 void MKLDNNExperimentalDetectronROIFeatureExtractorNode::execute(mkldnn::stream strm) {
     const int levels_num = inputShapes.size() - INPUT_FEATURES_START;
     const int num_rois = getParentEdgeAt(INPUT_ROIS)->getShape().getStaticDims()[0];
     const int channels_num = getParentEdgeAt(INPUT_FEATURES_START)->getShape().getStaticDims()[1];
-    const int feaxels_per_roi = pooled_height_ * pooled_width_ * channels_num;
+    // blocked layouts pad the channels of the feature maps and of the output to the whole blocks
+    const int channels_padded = getChildEdgesAtPort(OUTPUT_ROI_FEATURES)[0]->getMemory().GetDescriptor().data.padded_dims[1];
+    const int feaxels_per_roi = pooled_height_ * pooled_width_ * channels_padded;
 
     auto *input_rois = reinterpret_cast<const float *>(getParentEdgeAt(INPUT_ROIS)->getMemoryPtr()->GetPtr());
     auto *output_rois_features = reinterpret_cast<float *>(getChildEdgesAtPort(OUTPUT_ROI_FEATURES)[0]->getMemoryPtr()->GetPtr());
@@ -381,6 +496,23 @@ void MKLDNNExperimentalDetectronROIFeatureExtractorNode::execute(mkldnn::stream
             auto *featuremap = reinterpret_cast<const float *>(getParentEdgeAt(INPUT_FEATURES_START + i)->getMemoryPtr()->GetPtr());
             const int featuremap_height = getParentEdgeAt(INPUT_FEATURES_START + i)->getShape().getStaticDims()[2];
             const int featuremap_width = getParentEdgeAt(INPUT_FEATURES_START + i)->getShape().getStaticDims()[3];
+            if (roiAlignKernel_) {
+                ROIAlignForward_jit_kernel(*roiAlignKernel_,
+                                           level_rois_num,
+                                           featuremap,
+                                           1.0f / pyramid_scales_[i],
+                                           channels_padded,
+                                           static_cast<int>(roiAlignKernel_->getChannels()),
+                                           featuremap_height,
+                                           featuremap_width,
+                                           pooled_height_,
+                                           pooled_width_,
+                                           sampling_ratio_,
+                                           &reordered_rois[4 * level_rois_offset],
+                                           aligned_,
+                                           &output_rois_features_temp[feaxels_per_roi * level_rois_offset]);
+                continue;
+            }
             ROIAlignForward_cpu_kernel<float>(feaxels_per_roi * level_rois_num,
                                               featuremap,
                                               1.0f / pyramid_scales_[i],
@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "common/roi_align_kernel.h"
 
 namespace MKLDNNPlugin {
 
@@ -15,7 +16,8 @@ public:
 
     void getSupportedDescriptors() override {};
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override {};
+    void selectOptimalPrimitiveDescriptor() override;
+    void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
@@ -35,6 +37,9 @@ private:
     int sampling_ratio_ = 0;
     bool aligned_ = false;
 
+    // pools the channels of the feature maps in nhwc and blocked layouts
+    std::shared_ptr<ROIAlignKernel> roiAlignKernel_;
+
     std::string errorPrefix;
 };
 
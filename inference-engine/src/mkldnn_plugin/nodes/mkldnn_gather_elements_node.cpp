@@ -59,12 +59,9 @@ MKLDNNGatherElementsNode::MKLDNNGatherElementsNode(const std::shared_ptr<ngraph:
     for (int i = outputShape.size() - 1; i > axis_; i--)
         strideAxDst_ *= outputShape[i];
     dstAxDim_ = op->get_output_shape(0)[axis_];
-    if (axis_ > 0) {
-        strideAx1Diff_ = 1;
-        for (int i = dataDims.size() - 1; i >= axis_; i--)
-            strideAx1Diff_ *= dataDims[i];
-        strideAx1Diff_ -= strideAxDst_ * outputShape[axis_];
-    }
+    srcAxDim_ = dataDims[axis_];
+    for (size_t i = 0; i < axis_; i++)
+        outerSize_ *= outputShape[i];
 }
 
 void MKLDNNGatherElementsNode::initSupportedPrimitiveDescriptors() {
@@ -92,49 +89,32 @@ void MKLDNNGatherElementsNode::initSupportedPrimitiveDescriptors() {
                          impl_desc_type::ref_any);
 }
 
-template <typename dataType>
-void MKLDNNGatherElementsNode::directExecution() {
-    const auto *srcData = reinterpret_cast<const dataType *>(getParentEdgeAt(dataIndex_)->getMemoryPtr()->GetPtr());
-    const auto *indices = reinterpret_cast<const int *>(getParentEdgeAt(indicesIndex_)->getMemoryPtr()->GetPtr());
-    auto *dstData = reinterpret_cast<dataType *>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
-
-    const int outSize = getChildEdgeAt(0)->getShape().getElementsCount();
-    auto threadBody = [&](const int ithr, const int nthr) {
-        int start(0lu), end(0lu);
-        splitter(outSize, nthr, ithr, start, end);
-        if (start >= end)
-            return;
-
-        int axStrideIt = start % strideAxDst_;
-        int dstAxIdx = (start / strideAxDst_) % dstAxDim_;
-        int dstShift0 = (start / strideAxDst_ / dstAxDim_) * strideAx1Diff_;
-
-        for (size_t o = start; o < end; o++, axStrideIt++) {
-            if (axStrideIt == strideAxDst_) {
-                axStrideIt = 0;
-                dstAxIdx++;
-                if (dstAxIdx == dstAxDim_) {
-                    dstAxIdx = 0;
-                    dstShift0 += strideAx1Diff_;
-                }
-            }
-            dstData[o] = srcData[o + dstShift0 + (indices[o] - dstAxIdx) * strideAxDst_];
-        }
-    };
-
-    parallel_nt(0, threadBody);
+void MKLDNNGatherElementsNode::createPrimitive() {
+    // the rows along the last axis are gathered at once, otherwise the elements of the inner dimensions
+    // for each position on the axis are read at the positions of the indices along the axis
+    if (strideAxDst_ == 1)
+        gatherKernel_ = std::make_shared<GatherKernel>(dataTypeSize_, 1, 1, srcAxDim_);
+    else
+        gatherKernel_ = std::make_shared<GatherKernel>(dataTypeSize_, 1, strideAxDst_, srcAxDim_ * strideAxDst_, true);
 }
 
 void MKLDNNGatherElementsNode::execute(mkldnn::stream strm) {
-    switch (dataTypeSize_) {
-        case sizeof(PrecisionTrait<Precision::I32>::value_type):
-            return directExecution<PrecisionTrait<Precision::I32>::value_type>();
-        case sizeof(PrecisionTrait<Precision::I16>::value_type):
-            return directExecution<PrecisionTrait<Precision::I16>::value_type>();
-        case sizeof(PrecisionTrait<Precision::I8>::value_type):
-            return directExecution<PrecisionTrait<Precision::I8>::value_type>();
-        default:
-            return IE_THROW() << "Unsupported data type size";
+    const auto *srcData = reinterpret_cast<const uint8_t *>(getParentEdgeAt(dataIndex_)->getMemoryPtr()->GetPtr());
+    const auto *indices = reinterpret_cast<const int32_t *>(getParentEdgeAt(indicesIndex_)->getMemoryPtr()->GetPtr());
+    auto *dstData = reinterpret_cast<uint8_t *>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const size_t srcRowSize = srcAxDim_ * strideAxDst_ * dataTypeSize_;
+    if (strideAxDst_ == 1) {
+        parallel_for(outerSize_, [&](const size_t o) {
+            gatherKernel_->execute(srcData + o * srcRowSize, indices + o * dstAxDim_,
+                                   dstData + o * dstAxDim_ * dataTypeSize_, dstAxDim_, srcAxDim_);
+        });
+    } else {
+        parallel_for2d(outerSize_, dstAxDim_, [&](const size_t o, const size_t a) {
+            const size_t dstOffset = (o * dstAxDim_ + a) * strideAxDst_;
+            gatherKernel_->execute(srcData + o * srcRowSize, indices + dstOffset,
+                                   dstData + dstOffset * dataTypeSize_, strideAxDst_, srcAxDim_);
+        });
     }
 }
 
@@ -9,6 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include "common/gather_kernel.h"
 
 namespace MKLDNNPlugin {
 
@@ -18,7 +19,7 @@ public:
 
     void getSupportedDescriptors() override {};
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override {};
+    void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
@@ -30,13 +31,13 @@ private:
 
     size_t axis_;
     size_t dataTypeSize_;
-    int strideAxDst_;
-    int dstAxDim_;
-    int strideAx1Diff_ = 0;
+    size_t strideAxDst_;
+    size_t dstAxDim_;
+    size_t srcAxDim_;
+    size_t outerSize_ = 1;
     std::string errorPrefix_;
 
-    template <typename dataType>
-    void directExecution();
+    std::shared_ptr<GatherKernel> gatherKernel_;
 };
 
 }  // namespace MKLDNNPlugin
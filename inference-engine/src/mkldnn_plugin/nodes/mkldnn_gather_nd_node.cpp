@@ -3,6 +3,7 @@
 //
 
 #include <cmath>
+#include <limits>
 #include <vector>
 #include <string>
 #include <mkldnn_types.h>
@@ -11,11 +12,15 @@
 #include <ngraph/opsets/opset1.hpp>
 #include <precision_utils.h>
 #include <utils/general_utils.h>
-#include "common/cpu_memcpy.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+// number of the index tuples flattened at once
+constexpr size_t FLAT_INDICES_CHUNK = 256;
+}  // namespace
+
 bool MKLDNNGatherNDNode::isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         const auto gatherElementsOp = ngraph::as_type_ptr<const ngraph::op::v5::GatherND>(op);
@@ -59,6 +64,14 @@ MKLDNNGatherNDNode::MKLDNNGatherNDNode(const std::shared_ptr<ngraph::Node>& op,
     if (_sliceRank > _dataRank)
         IE_THROW() << _errorPrefix << " has invalid inputs shapes.";
 
+    _sliceDims.assign(dataDims.begin() + _batchDims, dataDims.begin() + _batchDims + _sliceRank);
+    _sliceRange = 1;
+    for (size_t dim : _sliceDims) {
+        _sliceRange *= dim;
+    }
+    if (_sliceRange > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+        IE_THROW() << _errorPrefix << " has too many slices in 'data' input.";
+
     _blockSize = 1;
     for (size_t i = _sliceRank + _batchDims; i < dataDims.size(); i++) {
         _blockSize *= dataDims[i];
@@ -95,68 +108,38 @@ void MKLDNNGatherNDNode::initSupportedPrimitiveDescriptors() {
                          impl_desc_type::ref_any);
 }
 
-template <typename dataType>
-void MKLDNNGatherNDNode::gatherElementwise() {
-    const auto *srcData = reinterpret_cast<const dataType *>(getParentEdgeAt(_dataIndex)->getMemoryPtr()->GetPtr());
-    const auto *indices = reinterpret_cast<const int *>(getParentEdgeAt(_indicesIndex)->getMemoryPtr()->GetPtr());
-    auto *dstData = reinterpret_cast<dataType *>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
-
-    auto strides = getParentEdgeAt(_dataIndex)->getMemory().GetDescWithType<BlockedMemoryDesc>().getStrides();
-    const size_t* srcMultipliers = strides.data() + _batchDims;
-
-    const size_t cycles = getChildEdgeAt(0)->getShape().getElementsCount() *
-                          getChildEdgeAt(0)->getMemory().GetDesc().getPrecision().size() / (sizeof(dataType) * _batchNum);
-    const size_t CS = cycles * _sliceRank;
-    const size_t CB = cycles * _blockSize;
-    const size_t workAmount = _batchNum * cycles;
+void MKLDNNGatherNDNode::createPrimitive() {
+    _gatherKernel = std::make_shared<GatherKernel>(_dataTypeSize, _blockSize, _blockSize, _batchStep);
+}
 
-    auto threadBody = [&](const int ithr, const int nthr) {
-        size_t start(0lu), end(0lu);
-        splitter(workAmount, nthr, ithr, start, end);
-        if (start >= end)
-            return;
-        size_t bStart = start / cycles;
-        size_t cStart = start % cycles;
-        size_t workCounter = start;
-
-        const dataType* shiftedSrcData = srcData + bStart * _batchStep;
-        const int* shiftedIndices = indices + bStart * CS + cStart * _sliceRank;
-        dataType* shiftedDstData = dstData + bStart * CB + cStart * _blockSize;
-
-        for (size_t b = bStart; b < _batchNum; b++) {
-            for (size_t j = cStart; j < cycles; j++) {
-                size_t dataIdx = 0lu;
-                for (size_t i = 0lu; i < _sliceRank; i++)
-                    dataIdx += srcMultipliers[i] * shiftedIndices[i];
-                shiftedDstData[0] = shiftedSrcData[dataIdx];
-                shiftedDstData++;
-                shiftedIndices += _sliceRank;
-                if (++workCounter == end) {
-                    return;
-                }
+// the tuple of the indices is replaced by the number of the slice, the tuples with the indices out of the range
+// are replaced by the number out of the range
+void MKLDNNGatherNDNode::flattenIndices(const int32_t* indices, int32_t* flatIndices, size_t count) const {
+    for (size_t j = 0; j < count; j++, indices += _sliceRank) {
+        int64_t flatIdx = 0;
+        for (size_t i = 0; i < _sliceRank; i++) {
+            const int64_t dim = static_cast<int64_t>(_sliceDims[i]);
+            int64_t idx = indices[i];
+            if (idx < 0)
+                idx += dim;
+            if (idx < 0 || idx >= dim) {
+                flatIdx = static_cast<int64_t>(_sliceRange);
+                break;
             }
-            cStart = 0lu;
-            shiftedSrcData += _batchStep;
+            flatIdx = flatIdx * dim + idx;
         }
-    };
-
-    parallel_nt(0, threadBody);
+        flatIndices[j] = static_cast<int32_t>(flatIdx);
+    }
 }
 
-void MKLDNNGatherNDNode::gatherBlocks() {
+void MKLDNNGatherNDNode::execute(mkldnn::stream strm) {
     const uint8_t* srcData = reinterpret_cast<const uint8_t *>(getParentEdgeAt(_dataIndex)->getMemoryPtr()->GetPtr());
-    const int* indices = reinterpret_cast<const int *>(getParentEdgeAt(_indicesIndex)->getMemoryPtr()->GetPtr());
+    const int32_t* indices = reinterpret_cast<const int32_t *>(getParentEdgeAt(_indicesIndex)->getMemoryPtr()->GetPtr());
     uint8_t* dstData = reinterpret_cast<uint8_t *>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
 
-    std::vector<size_t> srcMultipliers(_sliceRank);
-    for (size_t i = 0; i < _sliceRank ; i++)
-        srcMultipliers[i] = _dataTypeSize * getParentEdgeAt(_dataIndex)->getMemory().GetDescWithType<BlockedMemoryDesc>().getStrides()[i + _batchDims];
-
     const size_t batchStep = _batchStep * _dataTypeSize;
     const size_t dataStep = _blockSize * _dataTypeSize;
     const size_t cycles = getChildEdgeAt(0)->getMemory().GetSize() / (dataStep * _batchNum);
-    const size_t CS = cycles * _sliceRank;
-    const size_t CB = cycles * dataStep;
     const size_t workAmount = _batchNum * cycles;
 
     auto threadBody = [&](const int ithr, const int nthr) {
@@ -164,54 +147,29 @@ void MKLDNNGatherNDNode::gatherBlocks() {
         splitter(workAmount, nthr, ithr, start, end);
         if (start >= end)
             return;
-        size_t bStart = start / cycles;
-        size_t cStart = start % cycles;
-        size_t workCounter = start;
-
-        const uint8_t* shiftedSrcData = srcData + bStart * batchStep;
-        const int* shiftedIndices = indices + bStart * CS + cStart * _sliceRank;
-        uint8_t* shiftedDstData = dstData + bStart * CB + cStart * dataStep;
-
-        for (size_t b = bStart; b < _batchNum; b++) {
-            for (size_t j = cStart; j < cycles; j++) {
-                size_t dataIdx = 0lu;
-                for (size_t i = 0; i < _sliceRank ; i++)
-                    dataIdx += srcMultipliers[i] * shiftedIndices[i];
-                cpu_memcpy(shiftedDstData, &(shiftedSrcData[dataIdx]), dataStep);
-                shiftedDstData += dataStep;
-                shiftedIndices += _sliceRank;
-                if (++workCounter == end) {
-                    return;
-                }
+
+        std::vector<int32_t> flatIndices;
+        if (_sliceRank > 1)
+            flatIndices.resize(std::min(end - start, FLAT_INDICES_CHUNK));
+
+        while (start < end) {
+            const size_t b = start / cycles;
+            size_t count = std::min(end - start, cycles - start % cycles);
+            const int32_t* shiftedIndices = indices + start * _sliceRank;
+            if (_sliceRank > 1) {
+                count = std::min(count, flatIndices.size());
+                flattenIndices(shiftedIndices, flatIndices.data(), count);
+                shiftedIndices = flatIndices.data();
             }
-            cStart = 0;
-            shiftedSrcData += batchStep;
+
+            _gatherKernel->execute(srcData + b * batchStep, shiftedIndices, dstData + start * dataStep, count, _sliceRange);
+            start += count;
         }
     };
 
     parallel_nt(0, threadBody);
 }
 
-void MKLDNNGatherNDNode::execute(mkldnn::stream strm) {
-    if (_blockSize > 1) {
-        gatherBlocks();
-    } else {
-        switch (_dataTypeSize) {
-            case sizeof(PrecisionTrait<Precision::I32>::value_type):
-                gatherElementwise<PrecisionTrait<Precision::I32>::value_type>();
-                break;
-            case sizeof(PrecisionTrait<Precision::I16>::value_type):
-                gatherElementwise<PrecisionTrait<Precision::I16>::value_type>();
-                break;
-            case sizeof(PrecisionTrait<Precision::I8>::value_type):
-                gatherElementwise<PrecisionTrait<Precision::I8>::value_type>();
-                break;
-            default:
-                IE_THROW() << _errorPrefix + " has data input with unsupported precision: " + getOriginalInputPrecisionAtPort(_dataIndex).name();
-        }
-    }
-}
-
 bool MKLDNNGatherNDNode::created() const {
     return getType() == GatherND;
 }
@@ -9,6 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include "common/gather_kernel.h"
 
 namespace MKLDNNPlugin {
 
@@ -18,7 +19,7 @@ public:
 
     void getSupportedDescriptors() override {};
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override {};
+    void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
@@ -32,13 +33,15 @@ private:
     size_t _batchNum;
     size_t _batchStep;
     size_t _dataTypeSize;
+    size_t _sliceRange;
+    std::vector<size_t> _sliceDims;
     const size_t _dataIndex = 0;
     const size_t _indicesIndex = 1;
     std::string _errorPrefix;
 
-    template <typename dataType>
-    void gatherElementwise();
-    void gatherBlocks();
+    std::shared_ptr<GatherKernel> _gatherKernel;
+
+    void flattenIndices(const int32_t* indices, int32_t* flatIndices, size_t count) const;
 };
 
 }  // namespace MKLDNNPlugin
@@ -8,11 +8,15 @@
 #include "ie_parallel.hpp"
 #include "mkldnn_gather_node.h"
 #include <ngraph/opsets/opset1.hpp>
-#include "common/cpu_memcpy.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+// the indices are split into the chunks of about this size of the copied data to parallelize small batches
+constexpr size_t GATHER_CHUNK_BYTES = 16 * 1024;
+}  // namespace
+
 bool MKLDNNGatherNode::isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         const auto gatherOp = ngraph::as_type_ptr<const ngraph::op::v7::Gather>(op);
@@ -108,6 +112,10 @@ void MKLDNNGatherNode::createPrimitive() {
 
     if (dataLength == 0)
         IE_THROW() << errorPrefix_ << "had incorrect input parameters dimension!";
+
+    idxChunkSize = std::min(idxBatchStride, std::max<size_t>(1, GATHER_CHUNK_BYTES / len));
+    idxChunkNum = idxBatchStride ? (idxBatchStride + idxChunkSize - 1) / idxChunkSize : 0;
+    gatherKernel = std::make_shared<GatherKernel>(dataSize, dataLength, dataLength, indexRange * dataLength);
 }
 
 void MKLDNNGatherNode::execute(mkldnn::stream strm) {
@@ -115,22 +123,15 @@ void MKLDNNGatherNode::execute(mkldnn::stream strm) {
     const uint8_t* srcData = reinterpret_cast<const uint8_t*>(getParentEdgeAt(GATHER_DATA)->getMemoryPtr()->GetPtr());
     uint8_t* dstData = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
 
-    parallel_for2d(batchSize, idxBatchStride, [&](const size_t i, const size_t j) {
-        const unsigned int idx = static_cast<uint32_t>(srcIndexes[i * idxBatchStride + j]);
-
-        // while negative indices are not supported, should set zero
-        if (idx < indexRange) {
-            for (size_t k = 0; k < outerSize; ++k) {
-                const size_t srcStride = (i * srcBatchStride + k * dataLength * indexRange) * dataSize;
-                const size_t dstStride = (i * dstBatchStride + k * dataLength * idxBatchStride) * dataSize;
-
-                cpu_memcpy(&dstData[dstStride + j * len], &srcData[srcStride + idx * len], len);
-            }
-        } else {
-            for (size_t k = 0; k < outerSize; ++k) {
-                memset(&dstData[(i * dstBatchStride + k * dataLength * idxBatchStride) * dataSize + j * len], 0, len);
-            }
-        }
+    parallel_for3d(batchSize, outerSize, idxChunkNum, [&](const size_t i, const size_t k, const size_t c) {
+        const size_t idxStart = c * idxChunkSize;
+        const size_t idxNum = std::min(idxChunkSize, idxBatchStride - idxStart);
+        const size_t srcStride = (i * srcBatchStride + k * dataLength * indexRange) * dataSize;
+        const size_t dstStride = (i * dstBatchStride + k * dataLength * idxBatchStride) * dataSize;
+
+        // negative indices count from the end of the axis, the slices of the indices out of the range are zeros
+        gatherKernel->execute(&srcData[srcStride], &srcIndexes[i * idxBatchStride + idxStart],
+                              &dstData[dstStride + idxStart * len], idxNum, indexRange);
     });
 }
 
@@ -9,6 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include "common/gather_kernel.h"
 
 namespace MKLDNNPlugin {
 
@@ -37,6 +38,10 @@ private:
     size_t dstBatchStride = 1;
     size_t dataSize = 1;
     size_t len = 1;
+    size_t idxChunkSize = 1;
+    size_t idxChunkNum = 1;
+
+    std::shared_ptr<GatherKernel> gatherKernel;
 
     static const size_t GATHER_DATA = 0;
     static const size_t GATHER_INDEXES = 1;
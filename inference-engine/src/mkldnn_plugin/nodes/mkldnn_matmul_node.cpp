@@ -10,8 +10,9 @@
 #include <cmath>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
-#include "ie_parallel.hpp"
-#include "common/cpu_memcpy.h"
+#include "mkldnn_eltwise_node.h"
+#include "mkldnn_fake_quantize_node.h"
+#include "utils/general_utils.h"
 #include <ngraph/opsets/opset1.hpp>
 
 using namespace mkldnn;
@@ -55,8 +56,6 @@ MKLDNNMatMulNode::MKLDNNMatMulNode(const std::shared_ptr<ngraph::Node>& op, cons
         errorPrefix = "Gemm node with name '" + getName() + "'";
 
         const auto matMul = std::dynamic_pointer_cast<const ngraph::opset1::MatMul>(op);
-        alpha = 1.f;
-        beta = 0.f;
         transposeA = matMul->get_transpose_a();
         transposeB = matMul->get_transpose_b();
     } else {
@@ -64,12 +63,64 @@ MKLDNNMatMulNode::MKLDNNMatMulNode(const std::shared_ptr<ngraph::Node>& op, cons
     }
 }
 
+bool MKLDNNMatMulNode::canFuse(const MKLDNNNodePtr& node) const {
+    // Per-channel post operations are applied along the dimension 1 of the output, which is a batch dimension
+    // for MatMul, so only activations and per-tensor FakeQuantize are fused
+    if (node->getType() == Eltwise) {
+        auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(node.get());
+        if (eltwiseNode == nullptr || eltwiseNode->getMKLDNNAlgorithm() == mkldnn::algorithm::undef)
+            return false;
+    } else if (node->getType() == FakeQuantize) {
+        for (size_t i = 1; i < node->getParentEdges().size(); i++) {
+            if (node->getParentEdgesAtPort(i)[0]->getShape().getElementsCount() != 1)
+                return false;
+        }
+    }
+    return canFuseSimpleOperation(node);
+}
+
+static mkldnn::memory::desc getStridedDesc(InferenceEngine::SizeVector dims, mkldnn::memory::data_type dataType, bool transpose) {
+    const size_t rank = dims.size();
+    InferenceEngine::SizeVector strides(rank, 1);
+    for (int i = static_cast<int>(rank) - 2; i >= 0; i--)
+        strides[i] = strides[i + 1] * dims[i + 1];
+    if (transpose) {
+        std::swap(dims[rank - 1], dims[rank - 2]);
+        std::swap(strides[rank - 1], strides[rank - 2]);
+    }
+    return mkldnn::memory::desc(MKLDNNExtensionUtils::convertToDnnlDims(dims), dataType,
+                                MKLDNNExtensionUtils::convertToDnnlDims(strides));
+}
+
 void MKLDNNMatMulNode::getSupportedDescriptors() {
     if (getParentEdges().size() != 2)
         IE_THROW()  << errorPrefix << " has incorrect number of input edges for layer " << getName();
     if (getChildEdges().empty())
         IE_THROW()  << errorPrefix << " has incorrect number of output edges for layer " << getName();
 
+    auto inPrec0 = getOriginalInputPrecisionAtPort(0);
+    auto inPrec1 = getOriginalInputPrecisionAtPort(1);
+    auto outPrec = getOriginalOutputPrecisionAtPort(0);
+    if (!fusedWith.empty())
+        outPrec = fusedWith[fusedWith.size() - 1]->getOriginalOutputPrecisionAtPort(0);
+
+    if ((inPrec0 != Precision::U8 && inPrec0 != Precision::I8) || inPrec1 != Precision::I8) {
+        if (inPrec0 == Precision::BF16 || inPrec1 == Precision::BF16) {
+            inPrec0 = Precision::BF16;
+            inPrec1 = Precision::BF16;
+            if (outPrec != Precision::FP32)
+                outPrec = Precision::BF16;
+        } else {
+            inPrec0 = Precision::FP32;
+            inPrec1 = Precision::FP32;
+            outPrec = Precision::FP32;
+        }
+    } else if (!one_of(outPrec, Precision::U8, Precision::I8)) {
+        // int8 MatMul writes either the quantized output of the fused FakeQuantize or fp32 directly,
+        // int32 accumulators are never exposed
+        outPrec = Precision::FP32;
+    }
+
     auto inDims0 = getParentEdgeAt(0)->getShape().getStaticDims();
     auto inDims1 = getParentEdgeAt(1)->getShape().getStaticDims();
     auto outDims = getChildEdgeAt(0)->getShape().getStaticDims();
@@ -77,13 +128,13 @@ void MKLDNNMatMulNode::getSupportedDescriptors() {
     if (inDims0.size() != inDims1.size() || inDims0.size() != outDims.size())
         IE_THROW()  << errorPrefix << " has invalid dims count";
 
-    int nDims = inDims0.size();
-    xAxis = nDims - 1;
-    yAxis = nDims - 2;
-    auto xAxis0 = transposeA ? yAxis : xAxis;
-    auto yAxis0 = transposeA ? xAxis : yAxis;
-    auto xAxis1 = transposeB ? yAxis : xAxis;
-    auto yAxis1 = transposeB ? xAxis : yAxis;
+    const int nDims = inDims0.size();
+    const auto xAxis = nDims - 1;
+    const auto yAxis = nDims - 2;
+    const auto xAxis0 = transposeA ? yAxis : xAxis;
+    const auto yAxis0 = transposeA ? xAxis : yAxis;
+    const auto xAxis1 = transposeB ? yAxis : xAxis;
+    const auto yAxis1 = transposeB ? xAxis : yAxis;
 
     // The check inDims0[xAxis] != inDims1[yAxis] is correct due to layer semantic
     // coverity[copy_paste_error]
@@ -95,62 +146,73 @@ void MKLDNNMatMulNode::getSupportedDescriptors() {
             (inDims1[dim_idx] != outDims[dim_idx] && inDims1[dim_idx] != 1)) {
             IE_THROW()  << errorPrefix << " has incorrect input batch dimensions";
         }
+    }
 
-        int aOffset = 1;
-        for (int i = dim_idx + 1; i < nDims; i++)
-            aOffset *= inDims0[i];
-        aOffsets.push_back(inDims0[dim_idx] == outDims[dim_idx] ? aOffset : 0);
+    inDataDesc[0] = getStridedDesc(inDims0, MKLDNNExtensionUtils::IEPrecisionToDataType(inPrec0), transposeA);
+    inDataDesc[1] = getStridedDesc(inDims1, MKLDNNExtensionUtils::IEPrecisionToDataType(inPrec1), transposeB);
+    outDataDesc = getStridedDesc(outDims, MKLDNNExtensionUtils::IEPrecisionToDataType(outPrec), false);
 
-        int bOffset = 1;
-        for (int i = dim_idx + 1; i < nDims; i++)
-            bOffset *= inDims1[i];
-        bOffsets.push_back(inDims1[dim_idx] == outDims[dim_idx] ? bOffset : 0);
-    }
+    createDescriptor({}, {});
+}
 
-    for (unsigned long dim_idx = aOffsets.size(); dim_idx < 2; dim_idx++)
-        aOffsets.push_back(0);
-    for (unsigned long dim_idx = bOffsets.size(); dim_idx < 2; dim_idx++)
-        bOffsets.push_back(0);
-    for (unsigned long dim_idx = cOffsets.size(); dim_idx < 2; dim_idx++)
-        cOffsets.push_back(0);
+void MKLDNNMatMulNode::createDescriptor(const std::vector<const MemoryDesc*>& inputDesc,
+                                        const std::vector<const MemoryDesc*>& outputDesc) {
+    // The port descriptors are always plain, so the primitive is created from the strided views of the inputs
+    MKLDNNDescriptor desc{std::shared_ptr<matmul::desc>(new matmul::desc(inDataDesc[0], inDataDesc[1], outDataDesc))};
+    descs.push_back(desc);
 }
 
 void MKLDNNMatMulNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
-    auto inPrec0 = getOriginalInputPrecisionAtPort(0);
-    auto inPrec1 = getOriginalInputPrecisionAtPort(1);
-    if ((inPrec0 != Precision::U8 && inPrec0 != Precision::I8) || inPrec1 != Precision::I8) {
-        if (inPrec0 == Precision::BF16 || inPrec1 == Precision::BF16) {
-            inPrec0 = Precision::BF16;
-            inPrec1 = Precision::BF16;
-        } else {
-            inPrec0 = Precision::FP32;
-            inPrec1 = Precision::FP32;
-        }
-    }
-
-    auto inputDataType0 = MKLDNNExtensionUtils::IEPrecisionToDataType(inPrec0);
-    auto inputDataType1 = MKLDNNExtensionUtils::IEPrecisionToDataType(inPrec1);
-    auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(InferenceEngine::Precision::FP32);
+    // post operations are taken into account, so only implementations that support them are listed
+    auto attr = initPrimitiveAttr();
+
+    // The dynamic batch limits the dimension 0 of the first input and the output, it is the batch one only for 3D and 4D
+    // MatMul and only when the first input isn't broadcasted along it
+    const auto& inDims0 = getParentEdgeAt(0)->getShape().getStaticDims();
+    const auto& outDims = getChildEdgeAt(0)->getShape().getStaticDims();
+    const bool dynBatchSupport = outDims.size() >= 3 && inDims0[0] == outDims[0];
+
+    for (auto& desc : descs) {
+        auto itpd = desc.createPrimitiveDescriptorIterator(getEngine(), *attr);
+        while (static_cast<bool>(itpd)) {
+            NodeConfig config;
+            config.dynBatchSupport = dynBatchSupport;
+            for (size_t i = 0; i < descInputNumbers(desc); i++) {
+                PortConfig portConfig;
+                portConfig.inPlace = -1;
+                portConfig.constant = false;
+                portConfig.desc = getSrcMemDesc(itpd, i);
+                config.inConfs.push_back(portConfig);
+            }
 
-    NodeConfig config;
-    config.dynBatchSupport = true;
+            for (size_t i = 0; i < descOutputNumbers(desc); i++) {
+                PortConfig portConfig;
+                portConfig.inPlace = -1;
+                portConfig.constant = false;
+                portConfig.desc = getDstMemDesc(itpd, i);
+                config.outConfs.push_back(portConfig);
+            }
 
-    auto createDataConfig = [](const std::vector<size_t>& dims, memory::data_type dataType) -> PortConfig {
-        PortConfig dataConfig;
-        dataConfig.inPlace = -1;
-        dataConfig.constant = false;
-        dataConfig.desc = MKLDNNPlugin::make_unique<MKLDNNMemoryDesc>(dims, dataType, MKLDNNMemory::GetPlainFormatByRank(dims.size()));
-        return dataConfig;
-    };
+            supportedPrimitiveDescriptors.emplace_back(config, parse_impl_name(itpd.impl_info_str()));
+            if (!itpd.next_impl())
+                break;
+        }
+    }
+}
 
-    config.inConfs.push_back(createDataConfig(getParentEdgeAt(0)->getShape().getStaticDims(), inputDataType0));
-    config.inConfs.push_back(createDataConfig(getParentEdgeAt(1)->getShape().getStaticDims(), inputDataType1));
-    config.outConfs.push_back(createDataConfig(getChildEdgeAt(0)->getShape().getStaticDims(), outputDataType));
+std::unique_ptr<MKLDNNMemoryDesc> MKLDNNMatMulNode::getSrcMemDesc(mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx) {
+    auto desc = idx > 0 ? primitive_desc_it.weights_desc(idx - 1) : primitive_desc_it.src_desc(idx);
+    const auto& dims = getParentEdgeAt(idx)->getShape().getStaticDims();
+    return MKLDNNPlugin::make_unique<MKLDNNMemoryDesc>(dims, desc.data_type(), MKLDNNMemory::GetPlainFormatByRank(dims.size()));
+}
 
-    supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::gemm_any);
+std::unique_ptr<MKLDNNMemoryDesc> MKLDNNMatMulNode::getDstMemDesc(mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx) {
+    auto desc = primitive_desc_it.dst_desc(idx);
+    const auto& dims = getChildEdgeAt(idx)->getShape().getStaticDims();
+    return MKLDNNPlugin::make_unique<MKLDNNMemoryDesc>(dims, desc.data_type(), MKLDNNMemory::GetPlainFormatByRank(dims.size()));
 }
 
 void MKLDNNMatMulNode::initOptimalPrimitiveDescriptor() {
@@ -159,18 +221,46 @@ void MKLDNNMatMulNode::initOptimalPrimitiveDescriptor() {
         IE_THROW()  << errorPrefix << " did not set preferable primitive descriptor";
     auto config = selected_pd->getConfig();
 
-     if (isConfigDefined(config))
-         return;
+    if (isConfigDefined(config))
+        return;
 
     MKLDNNNode::initOptimalPrimitiveDescriptor();
+}
 
-    auto* selectedPD = getSelectedPrimitiveDescriptor();
-    if (!selectedPD) {
-        return;
+void MKLDNNMatMulNode::setPostOps(mkldnn::primitive_attr &attr) {
+    mkldnn::post_ops ops;
+
+    for (auto &node : fusedWith) {
+        auto* fakeQuantizeNode = dynamic_cast<MKLDNNFakeQuantizeNode *>(node.get());
+        if (fakeQuantizeNode) {
+            fakeQuantizeNode->appendPostOps(ops);
+            continue;
+        }
+
+        auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(node.get());
+        if (eltwiseNode) {
+            eltwiseNode->appendPostOps(ops);
+            continue;
+        }
+
+        IE_THROW() << "Fusing of " << NameFromType(node->getType()) << " operation to " << NameFromType(this->getType()) << " node is not implemented";
     }
+
+    attr.set_post_ops(ops);
+}
+
+std::shared_ptr<mkldnn::primitive_attr> MKLDNNMatMulNode::initPrimitiveAttr() {
+    auto attr = std::make_shared<mkldnn::primitive_attr>(mkldnn::primitive_attr());
+
+    setPostOps(*attr);
+
+    return attr;
 }
 
 void MKLDNNMatMulNode::createPrimitive() {
+    if (prim)
+        return;
+
     auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
     auto& src0MemPtr = getParentEdgeAt(0)->getMemoryPtr();
     auto& src1MemPtr = getParentEdgeAt(1)->getMemoryPtr();
@@ -181,119 +271,65 @@ void MKLDNNMatMulNode::createPrimitive() {
     if (getSelectedPrimitiveDescriptor() == nullptr)
         IE_THROW()  << errorPrefix << " did not set preferable primitive descriptor";
 
-    auto inDims0 = src0MemPtr->GetDims();
-    auto outDims = dstMemPtr->GetDims();
-
-    params.src0_mem_ptr = src0MemPtr;
-    params.src1_mem_ptr = src1MemPtr;
-    params.dst_mem_ptr = dstMemPtr;
-
-    params.ndims = outDims.size();
-
-    params.MB1 = 1;
-    params.MB2 = outDims.size() > 3 ? outDims[params.ndims - 3] : 1;
-
-    params.M = outDims[yAxis];
-    params.N = outDims[xAxis];
-    params.K = transposeA ? inDims0[yAxis] : inDims0[xAxis];
-
-    params.transa = transposeA ? 'T' : 'N';
-    params.transb = transposeB ? 'T' : 'N';
-
-    params.lda = transposeA ? params.M : params.K;
-    params.ldb = transposeB ? params.K : params.N;
-    params.ldc = params.N;
-
-    params.shift1 = params.M * params.N * params.MB2;
-    params.shift2 = params.M * params.N;
+    std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
+    std::shared_ptr<matmul::primitive_desc> prim_desc;
+    prim_desc = std::make_shared<matmul::primitive_desc>(
+            createPrimitiveDescriptor<matmul::primitive_desc, matmul::desc>(*attr));
 
-    runtimePrecision = getParentEdgeAt(0)->getMemory().GetDesc().getPrecision();
-}
-
-inline void process_gemm(char transa, char transb, int M, int N, int K, float alpha, const float *A, int lda,
-                         const float *B, int ldb, float beta, float *C, int ldc) {
-    mkldnn_sgemm(transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
-}
+    auto& fullBatchPrim = batchPrimitives[getMaxBatch()];
+    fullBatchPrim = std::make_shared<matmul>(*prim_desc);
+    prim = fullBatchPrim;
 
-inline void process_gemm(char transa, char transb, int M, int N, int K, float alpha, const uint16_t *A, int lda,
-                         const uint16_t *B, int ldb, float beta, float *C, int ldc) {
-    dnnl_gemm_bf16bf16f32(transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
-}
-
-inline void process_gemm(char transa, char transb, int M, int N, int K, float alpha, const uint8_t *A, int lda,
-                         const int8_t *B, int ldb, float beta, float *C, int ldc) {
-    const int32_t co = 0;
-    int32_t *Ci = reinterpret_cast<int32_t *>(C);
-    mkldnn_gemm_u8s8s32(transa, transb, 'F', M, N, K, alpha, A, lda, 0, B, ldb, 0, beta, Ci, ldc, &co);
-    parallel_for(M * N, [&](size_t i) {
-        C[i] = Ci[i];
-    });
-}
+    primArgs = {{DNNL_ARG_SRC, mkldnn::memory(inDataDesc[0], getEngine(), src0MemPtr->GetData())},
+                {DNNL_ARG_WEIGHTS, mkldnn::memory(inDataDesc[1], getEngine(), src1MemPtr->GetData())},
+                {DNNL_ARG_DST, mkldnn::memory(outDataDesc, getEngine(), dstMemPtr->GetData())}};
 
-inline void process_gemm(char transa, char transb, int M, int N, int K, float alpha, const int8_t *A, int lda,
-                         const int8_t *B, int ldb, float beta, float *C, int ldc) {
-    const int32_t co = 0;
-    int32_t *Ci = reinterpret_cast<int32_t *>(C);
-    mkldnn_gemm_s8s8s32(transa, transb, 'F', M, N, K, alpha, A, lda, 0, B, ldb, 0, beta, Ci, ldc, &co);
-    parallel_for(M * N, [&](size_t i) {
-        C[i] = Ci[i];
-    });
+    if (dynBatchLim != 0)
+        setDynamicBatchLim(dynBatchLim);
 }
 
-template<typename T0, typename T1>
-inline void MKLDNNMatMulNode::process_data() {
-    const T0* src0_ptr = reinterpret_cast<const T0*>(params.src0_mem_ptr->GetPtr());
-    const T1* src1_ptr = reinterpret_cast<const T1*>(params.src1_mem_ptr->GetPtr());
-    float* dst_ptr = reinterpret_cast<float*>(params.dst_mem_ptr->GetPtr());
-
-    const int MB = batchToProcess();
-    if (params.ndims == 4) {
-        params.MB1 = MB;
-    } else if (params.ndims == 3) {
-        params.shift1 = params.shift1 * MB / params.MB2;
-        params.MB2 = MB;
-    }
-
-    for (int b1 = 0; b1 < params.MB1; ++b1) {
-        const T0 *a_ptr = src0_ptr;
-        const T1 *b_ptr = src1_ptr;
-        float *d_ptr = dst_ptr;
-
-        for (int b2 = 0; b2 < params.MB2; ++b2) {
-            process_gemm(params.transa, params.transb, params.M, params.N, params.K,
-                         alpha, a_ptr, params.lda, b_ptr, params.ldb, beta, d_ptr, params.ldc);
+void MKLDNNMatMulNode::setDynamicBatchLim(int lim) {
+    dynBatchLim = lim;
+    // without a batch dimension the whole output is computed for any limit
+    if (!prim || !getSelectedPrimitiveDescriptor()->getConfig().dynBatchSupport)
+        return;
 
-            a_ptr += aOffsets[0];
-            b_ptr += bOffsets[0];
-            d_ptr += params.shift2;
+    const int batch = batchToProcess();
+    // The strided views keep their strides, only the outermost dimension is limited. The second input is limited
+    // too unless it is broadcasted along the batch
+    auto limitBatch = [&](const mkldnn::memory::desc& desc) {
+        mkldnn::memory::desc batchDesc(desc);
+        if (batchDesc.data.dims[0] == getMaxBatch()) {
+            batchDesc.data.dims[0] = batch;
+            batchDesc.data.padded_dims[0] = batch;
         }
-
-        src0_ptr += aOffsets[1];
-        src1_ptr += bOffsets[1];
-        dst_ptr += params.shift1;
+        return batchDesc;
+    };
+    const auto src0Desc = limitBatch(inDataDesc[0]);
+    const auto src1Desc = limitBatch(inDataDesc[1]);
+    const auto dstDesc = limitBatch(outDataDesc);
+
+    auto& batchPrim = batchPrimitives[batch];
+    if (!batchPrim) {
+        auto attr = initPrimitiveAttr();
+        batchPrim = std::make_shared<matmul>(matmul::primitive_desc(matmul::desc(src0Desc, src1Desc, dstDesc), *attr,
+                                                                    getEngine()));
     }
+    prim = batchPrim;
+
+    primArgs = {{DNNL_ARG_SRC, mkldnn::memory(src0Desc, getEngine(), getParentEdgeAt(0)->getMemory().GetData())},
+                {DNNL_ARG_WEIGHTS, mkldnn::memory(src1Desc, getEngine(), getParentEdgeAt(1)->getMemory().GetData())},
+                {DNNL_ARG_DST, mkldnn::memory(dstDesc, getEngine(), getChildEdgeAt(0)->getMemory().GetData())}};
 }
 
 void MKLDNNMatMulNode::execute(mkldnn::stream strm) {
-    switch (runtimePrecision) {
-        case Precision::FP32: {
-            process_data<float, float>();
-            break;
-        }
-        case Precision::BF16: {
-            process_data<uint16_t, uint16_t>();
-            break;
-        }
-        case Precision::I8: {
-            process_data<int8_t, int8_t>();
-            break;
-        }
-        case Precision::U8: {
-            process_data<uint8_t, int8_t>();
-            break;
-        }
-        default:
-            IE_THROW()  << errorPrefix << " has incorrect precision on first input";
+    if (prim) {
+        // the arguments are views of the edges memory, which pointers can be changed by zero-copy inputs and outputs
+        primArgs.at(DNNL_ARG_SRC).set_data_handle(getParentEdgeAt(0)->getMemory().GetData());
+        primArgs.at(DNNL_ARG_WEIGHTS).set_data_handle(getParentEdgeAt(1)->getMemory().GetData());
+        primArgs.at(DNNL_ARG_DST).set_data_handle(getChildEdgeAt(0)->getMemory().GetData());
+
+        (*prim).execute(strm, primArgs);
     }
 }
 
@@ -301,6 +337,30 @@ bool MKLDNNMatMulNode::created() const {
     return getType() == MatMul;
 }
 
+const std::vector<impl_desc_type>& MKLDNNMatMulNode::getPrimitivesPriority() {
+    std::vector<impl_desc_type> priorities = {
+            impl_desc_type::unknown,
+            impl_desc_type::gemm_blas,
+            impl_desc_type::gemm_avx512,
+            impl_desc_type::gemm_avx2,
+            impl_desc_type::gemm_avx,
+            impl_desc_type::gemm_sse42,
+            impl_desc_type::gemm_any,
+            impl_desc_type::gemm,
+            impl_desc_type::jit_gemm,
+            impl_desc_type::jit_avx512,
+            impl_desc_type::jit_avx2,
+            impl_desc_type::jit_avx,
+            impl_desc_type::jit_sse42,
+            impl_desc_type::ref,
+    };
+    for (const auto& impl : priorities) {
+        if (std::find(implPriorities.begin(), implPriorities.end(), impl) == implPriorities.end())
+            implPriorities.push_back(impl);
+    }
+    return implPriorities;
+}
+
 int MKLDNNMatMulNode::getMaxBatch() {
     if (!outputShapes.empty())
         return outputShapes[0].getStaticDims()[0];
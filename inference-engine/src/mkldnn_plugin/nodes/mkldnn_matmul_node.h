@@ -6,7 +6,10 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <array>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace MKLDNNPlugin {
@@ -16,61 +19,50 @@ public:
     MKLDNNMatMulNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
 
     void getSupportedDescriptors() override;
+    void createDescriptor(const std::vector<const MemoryDesc*>& inputDesc,
+                          const std::vector<const MemoryDesc*>& outputDesc) override;
     void initSupportedPrimitiveDescriptors() override;
     void initOptimalPrimitiveDescriptor() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
     int getMaxBatch() override;
+    void setDynamicBatchLim(int lim) override;
 
-    InferenceEngine::Precision getRuntimePrecision() const override;
-
-    static bool isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept;
-
-private:
-    float alpha = 1.f;
-    float beta = 0.f;
-    bool transposeA = false;
-    bool transposeB = false;
-
-    int xAxis = 0;
-    int yAxis = 0;
+    bool canFuse(const MKLDNNNodePtr& node) const override;
 
-    std::vector<int> aOffsets;
-    std::vector<int> bOffsets;
-    std::vector<int> cOffsets;
+    const std::vector<impl_desc_type>& getPrimitivesPriority() override;
 
-    InferenceEngine::Precision runtimePrecision;
+    size_t descInputNumbers(MKLDNNDescriptor desc) override {
+        return getOriginalInputsNumber();
+    }
 
-    template<typename T0, typename T1> inline void process_data();
+    std::unique_ptr<MKLDNNMemoryDesc> getSrcMemDesc(mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx) override;
+    std::unique_ptr<MKLDNNMemoryDesc> getDstMemDesc(mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx) override;
 
-    std::string errorPrefix;
+    InferenceEngine::Precision getRuntimePrecision() const override;
 
-    struct {
-        MKLDNNMemoryPtr src0_mem_ptr = nullptr;
-        MKLDNNMemoryPtr src1_mem_ptr = nullptr;
-        MKLDNNMemoryPtr dst_mem_ptr = nullptr;
+    static bool isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept;
 
-        char transa = 'N';
-        char transb = 'N';
+protected:
+    std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
-        int MB1 = 1;
-        int MB2 = 1;
+private:
+    void setPostOps(mkldnn::primitive_attr &attr);
 
-        int M = 0;
-        int N = 0;
-        int K = 0;
+    bool transposeA = false;
+    bool transposeB = false;
 
-        int lda = 0;
-        int ldb = 0;
-        int ldc = 0;
+    /* The primitive views the plain inputs as [batch..., M, K] x [batch..., K, N], transposition is
+     * expressed by swapping the strides of the two innermost dimensions, broadcasting by batch dimensions equal to 1 */
+    std::array<mkldnn::memory::desc, 2> inDataDesc;
+    mkldnn::memory::desc outDataDesc;
 
-        int shift1 = 0;
-        int shift2 = 0;
+    // oneDNN matmul is created for the exact batch, so a primitive is created for each dynamic batch limit on its
+    // first use, including the full batch one created by createPrimitive
+    std::unordered_map<int, std::shared_ptr<mkldnn::primitive>> batchPrimitives;
 
-        size_t ndims = 0;
-    } params;
+    std::string errorPrefix;
 };
 
 }  // namespace MKLDNNPlugin
-
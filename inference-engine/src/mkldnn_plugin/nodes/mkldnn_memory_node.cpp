@@ -110,6 +110,7 @@ void MKLDNNMemoryInputNode::createPrimitive() {
 
     // default memory state is zero filled
     dataStore->FillZero();
+    readStore = writeStore = dataStore;
 }
 
 /**
@@ -138,18 +139,25 @@ MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
     return dataStore;
 }
 
+void MKLDNNMemoryInputNode::assignStores(MKLDNNMemoryPtr read, MKLDNNMemoryPtr write) {
+    readStore = std::move(read);
+    writeStore = std::move(write);
+    stateStored = false;
+}
+
 void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
     // TODO: Should be next one call:
-    //           dataStore.SetData(new_state, false);
+    //           writeStore.SetData(new_state, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    simple_copy(*writeStore, new_state);
+    stateStored = true;
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
     // TODO: Should be simple call of:
-    //           dst_mem.SetData(dataStore, false);
+    //           dst_mem.SetData(readStore, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    simple_copy(getChildEdgeAt(0)->getMemory(), *readStore);
 }
 
 MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
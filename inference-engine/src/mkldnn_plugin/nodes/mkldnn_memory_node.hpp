@@ -96,8 +96,22 @@ public:
     void setInputNode(MKLDNNNode* node) override {}
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
+
+    /**
+     * @brief Redirects the node to the external state buffers for the next inference
+     * @param readStore the buffer with the current state value which is read by the node
+     * @param writeStore the buffer the new state value is stored into by the sibling MemoryOutput
+     */
+    void assignStores(MKLDNNMemoryPtr readStore, MKLDNNMemoryPtr writeStore);
+    bool isStateStored() const {
+        return stateStored;
+    }
+
  private:
     MKLDNNMemoryPtr dataStore;
+    MKLDNNMemoryPtr readStore;
+    MKLDNNMemoryPtr writeStore;
+    bool stateStored = false;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
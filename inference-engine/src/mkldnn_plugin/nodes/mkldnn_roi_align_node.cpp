@@ -121,6 +121,16 @@ void MKLDNNROIAlignNode::initSupportedPrimitiveDescriptors() {
     config.inConfs.resize(3);
     config.outConfs.resize(1);
 
+    // the kernel pools the channels stored one after another, so nchw stays with the scalar implementation
+    impl_desc_type jitImplType;
+    if (mayiuse(avx512_core)) {
+        jitImplType = impl_desc_type::jit_avx512;
+    } else if (mayiuse(avx2)) {
+        jitImplType = impl_desc_type::jit_avx2;
+    } else {
+        jitImplType = impl_desc_type::ref;
+    }
+
     std::vector<std::pair<memory::format_tag, memory::format_tag>> supportedFormats {
             {memory::format_tag::nchw, memory::format_tag::nchw},
             {memory::format_tag::nhwc, memory::format_tag::nhwc},
@@ -135,10 +145,17 @@ void MKLDNNROIAlignNode::initSupportedPrimitiveDescriptors() {
         config.inConfs[2].desc = MKLDNNPlugin::make_unique<MKLDNNMemoryDesc>(getParentEdgeAt(2)->getShape().getStaticDims(), memory::data_type::s32,
                                                                memory::format_tag::x);
         config.outConfs[0].desc = MKLDNNPlugin::make_unique<MKLDNNMemoryDesc>(getChildEdgeAt(0)->getShape().getStaticDims(), outputDataType, fmts.second);
-        supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown});
+        supportedPrimitiveDescriptors.push_back({config, fmts.first == memory::format_tag::nchw ? impl_desc_type::ref : jitImplType});
     }
 }
 
+void MKLDNNROIAlignNode::selectOptimalPrimitiveDescriptor() {
+    // nchw is reported as ref and the other layouts as jit, but the layout is still picked by the producer,
+    // so the feature map is not reordered for the kernel
+    if (!selectPrimitiveDescriptorByParentLayout(0))
+        MKLDNNNode::selectOptimalPrimitiveDescriptor();
+}
+
 namespace {
 struct ROIAlignContext {
     MKLDNNROIAlignNode &node;
@@ -296,6 +313,33 @@ void MKLDNNROIAlignNode::executeSpecified() {
                 }
             }
         }
+        if (roiAlignKernel) {
+            // byte offsets of the interpolation points from the first channel of the bin in the source
+            std::vector<int32_t> offsetVector(pointVector.size());
+            for (size_t i = 0; i < pointVector.size(); i++)
+                offsetVector[i] = static_cast<int32_t>((pointVector[i].first * hInputStride + pointVector[i].second * wInputStride) *
+                                                       sizeof(inputType));
+            const float scale = 1.0f / numSamplesInBin;
+
+            auto poolChannels = [&](int yBinInd, int xBinInd, size_t binOffsetInput, size_t binOffsetOutput) {
+                const size_t sampleIndex = 4 * (yBinInd * pooledW + xBinInd) * numSamplesInBin;
+                const size_t dstIndex = binOffsetOutput + yBinInd * hOutputStride + xBinInd * wOutputStride;
+                roiAlignKernel->execute(reinterpret_cast<const uint8_t*>(srcData + binOffsetInput), &offsetVector[sampleIndex],
+                                        &weightVector[sampleIndex], numSamplesInBin, scale, reinterpret_cast<uint8_t*>(dst + dstIndex));
+            };
+            if (isNhwcFmt) {
+                parallel_for2d(pooledH, pooledW, [&](int yBinInd, int xBinInd) {
+                    poolChannels(yBinInd, xBinInd, roiBatchInd * C * H * W, n * C * binCount);
+                });
+            } else {  // nChw16c, nChw8c
+                parallel_for3d(blockCount, pooledH, pooledW, [&](int blkIdx, int yBinInd, int xBinInd) {
+                    poolChannels(yBinInd, xBinInd, (roiBatchInd * chPadding + blkIdx * blockSize) * H * W,
+                                 (n * chPadding + blkIdx * blockSize) * binCount);
+                });
+            }
+            continue;
+        }
+
         auto pool = [&] (int xBinInd_, int yBinInd_, int binOffsetInput_, int binOffsetOutput_, int blockResidual_) {
             float pooledValue = 0;
             unsigned int sampleIndex = 4 * (yBinInd_ * pooledW + xBinInd_) * numSamplesInBin;
@@ -369,6 +413,23 @@ bool MKLDNNROIAlignNode::created() const {
     return getType() == ROIAlign;
 }
 
-void MKLDNNROIAlignNode::createPrimitive() {}
+void MKLDNNROIAlignNode::createPrimitive() {
+    auto selectedPD = getSelectedPrimitiveDescriptor();
+    if (!selectedPD)
+        IE_THROW() << errorPrefix << "has no preferable primitive descriptor";
+
+    const auto &inDesc = selectedPD->getConfig().inConfs[0].desc;
+    const auto &outDesc = selectedPD->getConfig().outConfs[0].desc;
+    // the channels of nchw are not contiguous, so it stays with the scalar implementation
+    if (inDesc->hasLayoutType(LayoutType::ncsp))
+        return;
+
+    size_t channels = getParentEdgeAt(0)->getShape().getStaticDims()[1];
+    if (inDesc->hasLayoutType(LayoutType::nCsp16c))
+        channels = 16;
+    else if (inDesc->hasLayoutType(LayoutType::nCsp8c))
+        channels = 8;
+    roiAlignKernel = std::make_shared<ROIAlignKernel>(getAlgorithm(), inDesc->getPrecision(), outDesc->getPrecision(), channels);
+}
 
 REG_MKLDNN_PRIM_FOR(MKLDNNROIAlignNode, ROIAlign)
@@ -10,6 +10,7 @@
 #include <memory>
 #include <vector>
 #include <mkldnn_extension_utils.h>
+#include "common/roi_align_kernel.h"
 
 namespace MKLDNNPlugin {
 
@@ -19,6 +20,7 @@ public:
 
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
+    void selectOptimalPrimitiveDescriptor() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
@@ -35,6 +37,9 @@ private:
     template<typename T>
     struct ROIAlignExecute;
 
+    // pools the channels stored one after another in blocked and nhwc layouts
+    std::shared_ptr<ROIAlignKernel> roiAlignKernel;
+
     std::string errorPrefix;
 };
 
@@ -0,0 +1,294 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_snippets_node.h"
+
+#include <ie_parallel.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/runtime/host_tensor.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "emitters/cpu_generator.hpp"
+#include "utils/general_utils.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+
+bool MKLDNNSnippetNode::isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (!std::dynamic_pointer_cast<const ngraph::snippets::op::Subgraph>(op)) {
+            errorMessage = "Only snippets Subgraph operation is supported";
+            return false;
+        }
+        if (op->is_dynamic()) {
+            errorMessage = "Doesn't support op with dynamic shapes";
+            return false;
+        }
+        for (const auto& input : op->inputs()) {
+            if (input.get_element_type() != ngraph::element::f32) {
+                errorMessage = "Only FP32 inputs are supported";
+                return false;
+            }
+        }
+        for (const auto& output : op->outputs()) {
+            if (output.get_element_type() != ngraph::element::f32) {
+                errorMessage = "Only FP32 outputs are supported";
+                return false;
+            }
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNSnippetNode::MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (isSupportedOperation(op, errorMessage)) {
+        errorPrefix = "Subgraph node with name '" + getName() + "'";
+
+        // the copy is detached from the network, so the node doesn't keep the rest of the ngraph function alive
+        ngraph::OutputVector subgraphInputs;
+        for (const auto& input : op->input_values())
+            subgraphInputs.push_back(std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape()));
+        original = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(op->clone_with_new_inputs(subgraphInputs));
+    } else {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+}
+
+void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    impl_desc_type implType;
+    if (mayiuse(avx512_common)) {
+        implType = impl_desc_type::jit_avx512;
+    } else if (mayiuse(avx2)) {
+        implType = impl_desc_type::jit_avx2;
+    } else if (mayiuse(sse41)) {
+        implType = impl_desc_type::jit_sse42;
+    } else {
+        implType = impl_desc_type::ref;
+    }
+
+    auto initDesc = [&](LayoutType layout) {
+        std::vector<PortConfigurator> inConfs(inputShapes.size(), PortConfigurator(layout, Precision::FP32));
+        std::vector<PortConfigurator> outConfs(outputShapes.size(), PortConfigurator(layout, Precision::FP32));
+        addSupportedPrimDesc(inConfs, outConfs, implType);
+    };
+
+    // The channels last layout keeps the semantic of the elementwise operations only if nothing is broadcasted,
+    // in this case the layout doesn't matter for the reference execution as well
+    const auto& outDims = outputShapes[0].getStaticDims();
+    bool isChannelsLastApplicable = one_of(outDims.size(), 3, 4, 5);
+    for (const auto& shape : inputShapes)
+        isChannelsLastApplicable = isChannelsLastApplicable && shape.getStaticDims() == outDims;
+    for (const auto& shape : outputShapes)
+        isChannelsLastApplicable = isChannelsLastApplicable && shape.getStaticDims() == outDims;
+
+    if (isChannelsLastApplicable)
+        initDesc(LayoutType::nspc);
+    initDesc(LayoutType::ncsp);
+}
+
+void MKLDNNSnippetNode::selectOptimalPrimitiveDescriptor() {
+    selectPreferPrimitiveDescriptor(getPrimitivesPriority(), true);
+}
+
+void MKLDNNSnippetNode::createPrimitive() {
+    if (!mayiuse(sse41)) {
+        useReference = true;
+        return;
+    }
+
+    const size_t inputNum = inputShapes.size();
+    const size_t outputNum = outputShapes.size();
+    const size_t tensorRank = std::max<size_t>(1, getChildEdgesAtPort(0)[0]->getMemory().GetDescWithType<BlockedMemoryDesc>().getBlockDims().size());
+
+    // dimensions and strides in the memory order aligned to the output rank
+    auto alignToRank = [tensorRank](const BlockedMemoryDesc& desc, std::vector<size_t>& dims, std::vector<size_t>& strides) {
+        const auto& blockDims = desc.getBlockDims();
+        const auto& blockStrides = desc.getStrides();
+        dims.assign(tensorRank, 1);
+        strides.assign(tensorRank, 0);
+        const size_t offset = tensorRank - blockDims.size();
+        for (size_t j = 0; j < blockDims.size(); j++) {
+            dims[offset + j] = blockDims[j];
+            strides[offset + j] = blockStrides[j];
+        }
+    };
+
+    // inputs followed by outputs
+    std::vector<std::vector<size_t>> dims(inputNum + outputNum);
+    std::vector<std::vector<size_t>> strides(inputNum + outputNum);
+    for (size_t i = 0; i < inputNum; i++)
+        alignToRank(getParentEdgesAtPort(i)[0]->getMemory().GetDescWithType<BlockedMemoryDesc>(), dims[i], strides[i]);
+    for (size_t i = 0; i < outputNum; i++)
+        alignToRank(getChildEdgesAtPort(i)[0]->getMemory().GetDescWithType<BlockedMemoryDesc>(), dims[inputNum + i], strides[inputNum + i]);
+
+    dimsOut = dims[inputNum];
+    for (size_t i = inputNum + 1; i < dims.size(); i++) {
+        // the outputs are stored by the same loop, so they must have the same shape
+        if (dims[i] != dimsOut) {
+            useReference = true;
+            return;
+        }
+    }
+    for (size_t i = 0; i < inputNum; i++) {
+        for (size_t j = 0; j < tensorRank; j++) {
+            if (dims[i][j] != dimsOut[j] && dims[i][j] != 1)
+                IE_THROW() << errorPrefix << " has invalid input/output dims configuration.";
+        }
+    }
+
+    // The innermost dimensions are collapsed while every tensor is either dense or broadcasted along both of them,
+    // so the kernel processes longer rows, keeping enough rows for the threads
+    auto canCollapse = [&](const std::vector<size_t>& d, const std::vector<size_t>& s) {
+        const size_t r = d.size();
+        if (dimsOut[r - 2] == 1 || (d[r - 2] == 1 && d[r - 1] == 1))
+            return true;
+        return d[r - 2] == dimsOut[r - 2] && d[r - 1] == dimsOut[r - 1] && s[r - 2] == s[r - 1] * d[r - 1];
+    };
+    auto collapse = [](std::vector<size_t>& d, std::vector<size_t>& s) {
+        const size_t r = d.size();
+        d[r - 1] *= d[r - 2];
+        d.erase(d.end() - 2);
+        s.erase(s.end() - 2);
+    };
+
+    const size_t minimalConcurrency = parallel_get_max_threads();
+    const size_t minimalJitWorkAmount = 256;
+    const size_t fullWorkAmount = std::accumulate(dimsOut.begin(), dimsOut.end(), size_t(1), std::multiplies<size_t>());
+    while (dimsOut.size() > 1 && dimsOut.back() < minimalJitWorkAmount) {
+        bool collapsible = true;
+        for (size_t i = 0; i < dims.size(); i++)
+            collapsible = collapsible && canCollapse(dims[i], strides[i]);
+        if (!collapsible)
+            break;
+
+        const size_t nextJitWorkAmount = dimsOut.back() * dimsOut[dimsOut.size() - 2];
+        if (fullWorkAmount / nextJitWorkAmount < minimalConcurrency)
+            break;
+
+        for (size_t i = 0; i < dims.size(); i++)
+            collapse(dims[i], strides[i]);
+        dimsOut = dims[inputNum];
+    }
+
+    // the kernel walks the innermost dimension with the unit stride
+    for (size_t i = 0; i < dims.size(); i++) {
+        if (dims[i].back() != 1 && strides[i].back() != 1) {
+            useReference = true;
+            return;
+        }
+    }
+
+    offsets.resize(dims.size());
+    for (size_t i = 0; i < dims.size(); i++) {
+        offsets[i].resize(dimsOut.size());
+        for (size_t j = 0; j < dimsOut.size(); j++)
+            offsets[i][j] = dims[i][j] == dimsOut[j] ? strides[i][j] * sizeof(float) : 0;
+    }
+    outerWorkAmount = fullWorkAmount / dimsOut.back();
+
+    dims.resize(inputNum);
+    generate(dims);
+}
+
+void MKLDNNSnippetNode::generate(const std::vector<std::vector<size_t>>& dimsIn) {
+    auto toBlockedShape = [](const std::vector<size_t>& dims) -> ngraph::snippets::op::Subgraph::BlockedShape {
+        ngraph::AxisVector order(dims.size());
+        std::iota(order.begin(), order.end(), 0);
+        return std::make_tuple(ngraph::Shape(dims), order, ngraph::element::f32);
+    };
+
+    ngraph::snippets::op::Subgraph::BlockedShapeVector inShapes;
+    for (const auto& dims : dimsIn)
+        inShapes.push_back(toBlockedShape(dims));
+    ngraph::snippets::op::Subgraph::BlockedShapeVector outShapes(outputShapes.size(), toBlockedShape(dimsOut));
+
+    cpu_isa_t isa;
+    if (mayiuse(avx512_common)) {
+        isa = avx512_common;
+    } else if (mayiuse(avx2)) {
+        isa = avx2;
+    } else {
+        isa = sse41;
+    }
+
+    snippet = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(original->clone_with_new_inputs(original->input_values()));
+    snippet->set_generator(std::make_shared<CPUGenerator>(isa));
+    try {
+        schedule = snippet->generate(outShapes, inShapes);
+    } catch (const std::exception&) {
+        // e.g. the body needs more registers or kernel arguments than available, the subgraph is still executed correctly
+        snippet.reset();
+        useReference = true;
+    }
+}
+
+void MKLDNNSnippetNode::execute(mkldnn::stream strm) {
+    if (useReference) {
+        executeReference();
+        return;
+    }
+
+    const size_t inputNum = inputShapes.size();
+    std::vector<const uint8_t*> ptrs(offsets.size());
+    for (size_t i = 0; i < inputNum; i++)
+        ptrs[i] = reinterpret_cast<const uint8_t*>(getParentEdgesAtPort(i)[0]->getMemoryPtr()->GetPtr());
+    for (size_t i = inputNum; i < ptrs.size(); i++)
+        ptrs[i] = reinterpret_cast<const uint8_t*>(getChildEdgesAtPort(i - inputNum)[0]->getMemoryPtr()->GetPtr());
+
+    const auto ker = schedule.get_callable<kernel>();
+    const int outerRank = static_cast<int>(dimsOut.size()) - 1;
+
+    parallel_for(outerWorkAmount, [&](size_t iwork) {
+        jit_snippets_call_args args;
+        size_t argOffsets[max_snippet_args] = {};
+        for (int j = outerRank - 1; j >= 0; j--) {
+            const size_t coord = iwork % dimsOut[j];
+            iwork /= dimsOut[j];
+            for (size_t i = 0; i < ptrs.size(); i++)
+                argOffsets[i] += coord * offsets[i][j];
+        }
+        for (size_t i = 0; i < ptrs.size(); i++)
+            args.ptrs[i] = ptrs[i] + argOffsets[i];
+        args.work_amount = dimsOut.back();
+
+        ker(&args);
+    });
+}
+
+void MKLDNNSnippetNode::executeReference() {
+    ngraph::HostTensorVector inputs;
+    for (size_t i = 0; i < original->get_input_size(); i++) {
+        void *srcDataPtr = getParentEdgesAtPort(i)[0]->getMemoryPtr()->GetPtr();
+        inputs.push_back(std::make_shared<ngraph::HostTensor>(ngraph::element::f32, original->get_input_shape(i), srcDataPtr));
+    }
+
+    ngraph::HostTensorVector outputs;
+    for (size_t i = 0; i < original->get_output_size(); i++) {
+        void *dstDataPtr = getChildEdgesAtPort(i)[0]->getMemoryPtr()->GetPtr();
+        outputs.push_back(std::make_shared<ngraph::HostTensor>(ngraph::element::f32, original->get_output_shape(i), dstDataPtr));
+    }
+
+    if (!original->evaluate(outputs, inputs))
+        IE_THROW() << errorPrefix << " evaluation failed.";
+}
+
+bool MKLDNNSnippetNode::created() const {
+    return getType() == Subgraph;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNSnippetNode, Subgraph)
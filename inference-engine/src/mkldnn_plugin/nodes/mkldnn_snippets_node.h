@@ -0,0 +1,59 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "emitters/jit_snippets_emitters.hpp"
+#include "snippets/op/subgraph.hpp"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Executes the elementwise subgraph collapsed by the snippets tokenization as a single pass over the data.
+ * The body is compiled by the snippets code generator with the CPU emitters for the innermost dimension, while the
+ * node iterates over the outer dimensions and handles broadcasting by the zero input offsets.
+ */
+class MKLDNNSnippetNode : public MKLDNNNode {
+public:
+    MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void selectOptimalPrimitiveDescriptor() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    using kernel = void (*)(const jit_snippets_call_args*);
+
+    void generate(const std::vector<std::vector<size_t>>& dimsIn);
+    void executeReference();
+
+    // the original body is kept for the reference execution, the code is generated for a copy since the generation
+    // changes the body, the copy also owns the generated code
+    std::shared_ptr<ngraph::snippets::op::Subgraph> original;
+    std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+    ngraph::snippets::Schedule schedule;
+    bool useReference = false;
+
+    // output dimensions in the memory order, the innermost one is processed by the kernel
+    std::vector<size_t> dimsOut;
+    // byte offsets to the next element along every dimension for the inputs followed by the outputs,
+    // zero for the broadcasted dimensions
+    std::vector<std::vector<size_t>> offsets;
+    size_t outerWorkAmount = 0;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
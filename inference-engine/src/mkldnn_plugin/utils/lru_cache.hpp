@@ -0,0 +1,90 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <utility>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Map of the limited capacity which evicts the least recently used entry when a new one doesn't fit.
+ * The class is not thread safe.
+ */
+template <typename Key, typename Value>
+class LruCache {
+public:
+    explicit LruCache(size_t capacity) : _capacity(capacity) {}
+
+    /**
+     * @brief Finds the value of the key and makes it the most recently used one
+     * @return true if the key was found
+     */
+    bool get(const Key& key, Value& value) {
+        auto it = _map.find(key);
+        if (it == _map.end())
+            return false;
+        _list.splice(_list.begin(), _list, it->second);
+        value = it->second->second;
+        return true;
+    }
+
+    /**
+     * @brief Inserts or replaces the value of the key as the most recently used one
+     * @return number of the evicted entries
+     */
+    size_t put(const Key& key, const Value& value) {
+        auto it = _map.find(key);
+        if (it != _map.end()) {
+            it->second->second = value;
+            _list.splice(_list.begin(), _list, it->second);
+            return 0;
+        }
+        if (_capacity == 0)
+            return 0;
+
+        size_t evicted = 0;
+        for (; _map.size() >= _capacity; evicted++) {
+            _map.erase(_list.back().first);
+            _list.pop_back();
+        }
+        _list.emplace_front(key, value);
+        _map.emplace(key, _list.begin());
+        return evicted;
+    }
+
+    void erase(const Key& key) {
+        auto it = _map.find(key);
+        if (it == _map.end())
+            return;
+        _list.erase(it->second);
+        _map.erase(it);
+    }
+
+    void clear() {
+        _map.clear();
+        _list.clear();
+    }
+
+    size_t size() const {
+        return _map.size();
+    }
+
+    size_t capacity() const {
+        return _capacity;
+    }
+
+private:
+    using Entries = std::list<std::pair<Key, Value>>;
+
+    size_t _capacity;
+    // the most recently used entry is the first one
+    Entries _list;
+    std::map<Key, typename Entries::iterator> _map;
+};
+
+}  // namespace MKLDNNPlugin
@@ -3,6 +3,8 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <limits>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -57,6 +59,9 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     _config{config},
     _needPerfCounters{needPerfCounters} {
     _taskExecutor.reset();
+    auto policy = _config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    _throughputScheduling = policy != _config.end() &&
+                            policy->second.as<std::string>() == MultiDeviceConfigParams::MULTI_THROUGHPUT;
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
@@ -79,15 +84,19 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
         workerRequests.resize(numRequests);
         _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<ThreadSafeQueue<Task>>(new ThreadSafeQueue<Task>);
         auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
+        auto* statisticsPtr = &(_deviceStatistics[device]);
         idleWorkerRequests.set_capacity(numRequests);
         for (auto&& workerRequest : workerRequests) {
             workerRequest._inferRequest = { network, network->CreateInferRequest() };
             auto* workerRequestPtr = &workerRequest;
             IE_ASSERT(idleWorkerRequests.try_push(workerRequestPtr) == true);
             workerRequest._inferRequest->SetCallback(
-                [workerRequestPtr, this, device, idleWorkerRequestsPtr] (std::exception_ptr exceptionPtr) mutable {
+                [workerRequestPtr, this, device, idleWorkerRequestsPtr, statisticsPtr] (std::exception_ptr exceptionPtr) mutable {
                     IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                     workerRequestPtr->_exceptionPtr = exceptionPtr;
+                    statisticsPtr->UpdateInferenceTime(std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - workerRequestPtr->_dispatchTime).count());
+                    statisticsPtr->_inFlight--;
                     {
                         auto capturedTask = std::move(workerRequestPtr->_task);
                         capturedTask();
@@ -97,21 +106,79 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                         // let's try to pop a task, as we know there is at least one idle request, schedule if succeeded
                         // if no device-agnostic tasks, let's try pop the device specific task, schedule if succeeded
                         Task t;
-                        if (_inferPipelineTasks.try_pop(t))
+                        if (_inferPipelineTasks.try_pop(t)) {
                             ScheduleToWorkerInferRequest(std::move(t));
-                        else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t))
+                        } else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t)) {
+                            statisticsPtr->_queued--;
                             ScheduleToWorkerInferRequest(std::move(t), device);
+                        }
                     }
                 });
         }
     }
 }
 
+void MultiDeviceExecutableNetwork::DeviceStatistics::UpdateInferenceTime(double milliseconds) {
+    // weight of the latest sample, so the estimation follows changes of the device load within ~10 inferences
+    constexpr double alpha = 0.2;
+    auto current = _inferenceTime.load();
+    while (!_inferenceTime.compare_exchange_weak(current,
+                                                 current == 0.0 ? milliseconds : current + alpha * (milliseconds - current))) {
+    }
+}
+
+DeviceName MultiDeviceExecutableNetwork::SelectDeviceByCompletionTime(const std::vector<DeviceInformation>& devices) const {
+    // devices without completed inferences yet are assumed to be as fast as the fastest measured one
+    double fastest = 0.0;
+    for (auto&& device : devices) {
+        const auto time = _deviceStatistics.at(device.deviceName)._inferenceTime.load();
+        if (time > 0.0 && (fastest == 0.0 || time < fastest))
+            fastest = time;
+    }
+    if (fastest == 0.0)
+        fastest = 1.0;
+
+    DeviceName selected;
+    double minCompletionTime = std::numeric_limits<double>::max();
+    for (auto&& device : devices) {
+        const auto& statistics = _deviceStatistics.at(device.deviceName);
+        const auto slots = _workerRequests.at(device.deviceName).size();
+        if (slots == 0)
+            continue;
+        auto time = statistics._inferenceTime.load();
+        if (time == 0.0)
+            time = fastest;
+        // the device runs `slots` requests in parallel, so the new one completes with the wave it gets into
+        const auto assigned = static_cast<size_t>(std::max(0, statistics._inFlight.load() + statistics._queued.load()));
+        const auto completionTime = time * static_cast<double>(assigned / slots + 1);
+        // on a tie the device with the higher priority wins
+        if (completionTime < minCompletionTime) {
+            minCompletionTime = completionTime;
+            selected = device.deviceName;
+        }
+    }
+    return selected;
+}
+
 void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipelineTask, DeviceName preferred_device) {
     auto devices = [&] {
         std::lock_guard<std::mutex> lock(_mutex);
         return _devicePriorities;
     }();
+    if (preferred_device.empty() && _throughputScheduling)
+        preferred_device = SelectDeviceByCompletionTime(devices);
+
+    auto runOnWorker = [&] (WorkerInferRequest* workerRequestPtr, const DeviceName& deviceName) {
+        auto& statistics = _deviceStatistics.at(deviceName);
+        statistics._dispatched++;
+        statistics._inFlight++;
+        workerRequestPtr->_dispatchTime = std::chrono::steady_clock::now();
+        _thisWorkerInferRequest = workerRequestPtr;
+        {
+            auto capturedTask = std::move(inferPipelineTask);
+            capturedTask();
+        }
+    };
     for (auto&& device : devices) {
         if (!preferred_device.empty() && (device.deviceName != preferred_device))
             continue;
@@ -119,20 +186,33 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
         NotBusyWorkerRequests& idleWorkerRequests = _idleWorkerRequests[device.deviceName];
         if (idleWorkerRequests.try_pop(workerRequestPtr)) {
             IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
-            _thisWorkerInferRequest = workerRequestPtr;
-            {
-                auto capturedTask = std::move(inferPipelineTask);
-                capturedTask();
-            }
+            runOnWorker(workerRequestPtr, device.deviceName);
             idleGuard.Release();
             return;
         }
     }
     // no vacant requests this time, storing the task to the respective queue
-    if (!preferred_device.empty())
-        _inferPipelineTasksDeviceSpecific[preferred_device]->push(std::move(inferPipelineTask));
-    else
+    if (!preferred_device.empty()) {
+        auto& deviceTasks = _inferPipelineTasksDeviceSpecific[preferred_device];
+        _deviceStatistics.at(preferred_device)._queued++;
+        deviceTasks->push(std::move(inferPipelineTask));
+        if (!_throughputScheduling)
+            return;
+        // the last busy request of the device might have become idle before the task was queued,
+        // so let's pick up a queued task now, otherwise it would wait for the next completion on the device
+        WorkerInferRequest* workerRequestPtr = nullptr;
+        NotBusyWorkerRequests& idleWorkerRequests = _idleWorkerRequests[preferred_device];
+        if (idleWorkerRequests.try_pop(workerRequestPtr)) {
+            IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
+            if (deviceTasks->try_pop(inferPipelineTask)) {
+                _deviceStatistics.at(preferred_device)._queued--;
+                runOnWorker(workerRequestPtr, preferred_device);
+                idleGuard.Release();
+            }
+        }
+    } else {
         _inferPipelineTasks.push(std::move(inferPipelineTask));
+    }
 }
 
 void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
@@ -261,15 +341,22 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
         IE_ASSERT(it != _networksPerDevice.end());
         IE_SET_METRIC_RETURN(NETWORK_NAME, it->second->GetMetric(
             METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(MULTI_DISPATCH_COUNTS)) {
+        std::map<std::string, uint64_t> counts;
+        for (auto&& statistics : _deviceStatistics)
+            counts[statistics.first] = statistics.second._dispatched.load();
+        IE_SET_METRIC_RETURN(MULTI_DISPATCH_COUNTS, counts);
     } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, {
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(NETWORK_NAME),
-            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            METRIC_KEY(MULTI_DISPATCH_COUNTS)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         IE_THROW() << "Unsupported Network metric: " << name;
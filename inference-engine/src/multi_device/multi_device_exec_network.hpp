@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
@@ -102,6 +103,18 @@ public:
         InferenceEngine::SoIInferRequestInternal  _inferRequest;
         InferenceEngine::Task                     _task;
         std::exception_ptr                        _exceptionPtr = nullptr;
+        std::chrono::steady_clock::time_point     _dispatchTime;
+    };
+    /**
+     * @brief Online estimation of the device performance used by the throughput scheduling policy
+     */
+    struct DeviceStatistics {
+        void UpdateInferenceTime(double milliseconds);
+        std::atomic<std::uint64_t>  _dispatched = {0};
+        std::atomic<int>            _inFlight = {0};
+        std::atomic<int>            _queued = {0};
+        // moving average of the time from the dispatch to the completion, zero until the first completion
+        std::atomic<double>         _inferenceTime = {0.0};
     };
     using NotBusyWorkerRequests = ThreadSafeBoundedQueue<WorkerInferRequest*>;
 
@@ -121,6 +134,7 @@ public:
     ~MultiDeviceExecutableNetwork() override;
 
     void ScheduleToWorkerInferRequest(InferenceEngine::Task, DeviceName preferred_device = "");
+    DeviceName SelectDeviceByCompletionTime(const std::vector<DeviceInformation>& devices) const;
 
     static thread_local WorkerInferRequest*                     _thisWorkerInferRequest;
     // have to use the const char* ptr rather than std::string due to a bug in old gcc versions,
@@ -135,6 +149,8 @@ public:
     DeviceMap<std::unique_ptr<ThreadSafeQueue<InferenceEngine::Task>>> _inferPipelineTasksDeviceSpecific;
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
+    DeviceMap<DeviceStatistics>                                 _deviceStatistics;
+    bool                                                        _throughputScheduling = false;
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
     std::atomic_size_t                                          _numRequestsCreated = {0};
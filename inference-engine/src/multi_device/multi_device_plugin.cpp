@@ -58,6 +58,7 @@ namespace {
     }
     std::vector<std::string> supported_configKeys = {
         MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+        MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
         CONFIG_KEY_INTERNAL(WORK_MODE)
     };
 }  // namespace
@@ -232,6 +233,18 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadNetworkImpl(cons
         metaDevices = ParseMetaDevices(priorities->second, fullConfig);
         multiNetworkConfig.insert(*priorities);
     }
+    auto policy = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (policy == fullConfig.end()) {
+        multiNetworkConfig.insert({MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+                                   std::string(MultiDeviceConfigParams::MULTI_PRIORITY)});
+    } else if (policy->second == MultiDeviceConfigParams::MULTI_PRIORITY ||
+               policy->second == MultiDeviceConfigParams::MULTI_THROUGHPUT) {
+        multiNetworkConfig.insert(*policy);
+    } else {
+        IE_THROW() << "Wrong value " << policy->second << " for property key "
+                   << MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY << ". Expected only "
+                   << MultiDeviceConfigParams::MULTI_PRIORITY << "/" << MultiDeviceConfigParams::MULTI_THROUGHPUT;
+    }
     // check if it is -d AUTO or -d AUTO:xPU use case
     if (workMode != fullConfig.end()) {
         auto targetDevice = SelectDevice(metaDevices, networkPrecision);
@@ -38,6 +38,26 @@ DECLARE_CONFIG_KEY(LP_TRANSFORMS_MODE);
  */
 DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
 
+/**
+ * @brief Selects lock-free task queue for CPU Executor Streams (YES) instead of the mutex-guarded one (NO, default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_LOCK_FREE_TASK_QUEUE);
+
+/**
+ * @brief Index of the first core the threads of CPU Executor Streams are pinned to, if the threads are bound to cores.
+ * Lets several executors share the machine each on its own group of cores
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_BIND_THREAD_OFFSET);
+
+/**
+ * @brief Enables tokenization of elementwise subgraphs into snippets which are JIT compiled by CPU plugin as
+ *        a single fused node (YES) instead of the separate nodes (NO, default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(SNIPPETS_MODE);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
@@ -0,0 +1,90 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Defines a fast content hash for large binary data like weights
+ * @file ie_data_hash.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief      Streaming 64-bit content hash
+ * @ingroup    ie_dev_api_memory
+ *
+ * The data is split into blocks of DataHash::blockSize bytes counted from the beginning of the stream.
+ * The blocks are hashed independently (in parallel if several complete blocks are passed to a single update() call)
+ * and the block digests are combined in order. So the digest depends only on the data and does not depend on the
+ * number of threads or on how the data is split between update() calls.
+ */
+class INFERENCE_ENGINE_API_CLASS(DataHash) {
+public:
+    /**
+     * @brief Size of the independently hashed block in bytes
+     */
+    static constexpr std::size_t blockSize = 256 * 1024;
+
+    /**
+     * @brief Constructs the hasher of an empty stream
+     */
+    DataHash();
+
+    /**
+     * @brief Move constructor
+     */
+    DataHash(DataHash&&) noexcept;
+
+    /**
+     * @brief Move assignment
+     * @return A reference to this hasher
+     */
+    DataHash& operator=(DataHash&&) noexcept;
+
+    ~DataHash();
+
+    /**
+     * @brief      Appends the data to the hashed stream
+     * @param data A pointer to the data
+     * @param size A size of the data in bytes
+     */
+    void update(const void* data, std::size_t size);
+
+    /**
+     * @brief  Computes the digest of the data passed so far, the hasher stays valid for further updates
+     * @return The 64-bit digest
+     */
+    std::uint64_t digest() const;
+
+    /**
+     * @brief      Computes the digest of a single buffer, the same as update() followed by digest()
+     * @param data A pointer to the data
+     * @param size A size of the data in bytes
+     * @return     The 64-bit digest
+     */
+    static std::uint64_t hash(const void* data, std::size_t size);
+
+    /**
+     * @brief      Computes xxHash64 of a buffer, the function the blocks and the tail of the stream are hashed with
+     * @param data A pointer to the data
+     * @param size A size of the data in bytes
+     * @param seed A seed
+     * @return     The 64-bit xxHash64 digest
+     */
+    static std::uint64_t xxHash64(const void* data, std::size_t size, std::uint64_t seed = 0);
+
+private:
+    // the state lives in the library, so the exported class has no standard containers as members
+    class Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+}  // namespace InferenceEngine
@@ -12,8 +12,10 @@
 #include <array>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "cpp/ie_cnn_network.h"
+#include "ie_iextension.h"
 #include "cpp_interfaces/interface/ie_iexecutable_network_internal.hpp"
 #include "ie_parameter.hpp"
 #include "threading/ie_itask_executor.hpp"
@@ -41,6 +43,18 @@ public:
      */
     virtual CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights) const = 0;
 
+    /**
+     * @brief Reads IR xml and bin from memory using additional extensions
+     * @param model string with IR
+     * @param weights shared pointer to constant blob with weights
+     * @param exts extensions which provide operation sets in addition to the ones registered in Core
+     * @note Used by plugins to read back networks which contain plugin specific operations
+     * @return CNNNetwork
+     */
+    virtual CNNNetwork ReadNetwork(const std::string& model,
+                                   const Blob::CPtr& weights,
+                                   const std::vector<IExtensionPtr>& exts) const = 0;
+
     /**
      * @brief Reads IR xml and bin files
      * @param modelPath path to IR file
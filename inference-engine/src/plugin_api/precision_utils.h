@@ -15,6 +15,7 @@
 #include <type_traits>
 
 #include "ie_api.h"
+#include "ie_precision.hpp"
 
 /**
  * @brief Inference Engine Plugin API namespace
@@ -132,6 +133,39 @@ f16tof32Arrays(float* dst, const ie_fp16* src, size_t nelem, float scale = 1.f,
 INFERENCE_ENGINE_API_CPP(void)
 f32tof16Arrays(ie_fp16* dst, const float* src, size_t nelem, float scale = 1.f, float bias = 0.f);
 
+/**
+ * @brief      Checks whether convertArrays supports the pair of precisions
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param[in]  srcPrc  A precision of the source array
+ * @param[in]  dstPrc  A precision of the destination array
+ * @return     `True` if the source precision is one of U8, I8, U16, I16, I32, FP16, BF16, FP32, the destination
+ *             precision is one of U8, I8, I32, FP16, BF16, FP32 and at least one of them is a floating point one
+ */
+INFERENCE_ENGINE_API_CPP(bool) canConvertArrays(Precision srcPrc, Precision dstPrc);
+
+/**
+ * @brief      Converts an array of one precision to an array of another precision and applies `scale` and `bias`
+ *             if needed. The arrays are processed by SIMD instructions if the CPU supports them.
+ * @ingroup    ie_dev_api_precision
+ *
+ * Every source value is converted to FP32, multiplied by `scale`, added to `bias` and converted to the
+ * destination precision. FP16 values are produced as by f32tof16, BF16 ones as by the BF16 type of the CPU plugin.
+ * Integral values are truncated towards zero and saturated, NaN is converted to the lowest value.
+ *
+ * @param      dst    A destination array
+ * @param[in]  dstPrc A precision of the destination array
+ * @param[in]  src    A source array
+ * @param[in]  srcPrc A precision of the source array
+ * @param[in]  nelem  A number of elements in arrays
+ * @param[in]  scale  An optional scale parameter
+ * @param[in]  bias   An optional bias parameter
+ * @throws     Exception if the pair of precisions is not supported, see canConvertArrays
+ */
+INFERENCE_ENGINE_API_CPP(void)
+convertArrays(void* dst, Precision dstPrc, const void* src, Precision srcPrc, size_t nelem, float scale = 1.f,
+              float bias = 0.f);
+
 #if defined(_MSC_VER)
 #    pragma warning(push)
 #    pragma warning(disable : 4018)
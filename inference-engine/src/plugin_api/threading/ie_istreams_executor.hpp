@@ -102,6 +102,13 @@ public:
                          // (for large #streams)
         } _threadPreferredCoreType =
             PreferredCoreType::ANY;  //!< In case of @ref HYBRID_AWARE hints the TBB to affinitize
+        /**
+         * @brief Implementation of the queue that passes tasks from `run()` calls to the stream threads
+         */
+        enum TaskQueueType {
+            MUTEX,      //!< `std::queue` guarded by a mutex, stream threads park on a condition variable
+            LOCK_FREE,  //!< Bounded MPMC lock-free ring, stream threads spin for a while before parking
+        } _taskQueueType = TaskQueueType::MUTEX;  //!< Task queue implementation. Mutex based by default
 
         /**
          * @brief      A constructor with arguments
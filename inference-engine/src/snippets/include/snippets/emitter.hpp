@@ -50,6 +50,8 @@ public:
      */
     virtual void emit_data() const {
     }
+
+    virtual ~Emitter() = default;
 };
 
 } // namespace snippets
@@ -165,20 +165,18 @@ void snippets::op::Subgraph::canonicalize(const BlockedShapeVector& output_shape
     }
 
 
-    // it should be in subgraph node to be aligned with internal and external parameter list, but adding this for testing
+    // parameters are reshaped to the shapes passed by the plugin, which may differ from the original ones
+    // (e.g. collapsed or normalized to the output rank), so the body is always aligned with the external memory
     // TODO: store blocking into to Parameter's rt_info for future propagation
     for (size_t i = 0; i < m_body->get_parameters().size(); i++) {
         auto param = m_body->get_parameters()[i];
-        if (param->get_shape().size() < 4) {
-            std::vector<size_t> shape(4, 1);
-            std::copy(param->get_shape().begin(), param->get_shape().end(), &shape.at(4 - (param->get_shape().size() == 0 ? 1 : param->get_shape().size())) );
-            m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(param->get_element_type(), ngraph::Shape(shape)));
-        } else if (param->get_shape().size() >= 4) {
-            if (param->get_element_type() != std::get<2>(input_shapes[i])) {
-                throw ngraph::ngraph_error("changes in presision. Is it legal??");
-            }
-            m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(std::get<2>(input_shapes[i]), std::get<0>(input_shapes[i])));
+        if (param->get_element_type() != std::get<2>(input_shapes[i])) {
+            throw ngraph::ngraph_error("changes in presision. Is it legal??");
         }
+        const auto& passed = std::get<0>(input_shapes[i]);
+        std::vector<size_t> shape(std::max<size_t>(4, passed.size()), 1);
+        std::copy(passed.begin(), passed.end(), shape.end() - passed.size());
+        m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(std::get<2>(input_shapes[i]), ngraph::Shape(shape)));
     }
 
     m_body->validate_nodes_and_infer_types();
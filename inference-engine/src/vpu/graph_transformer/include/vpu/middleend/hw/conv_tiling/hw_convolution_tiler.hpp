@@ -38,15 +38,20 @@ struct ConvolutionOptions final {
 
     const bool _withPool;
 
+    // CMX resources of the compilation, captured so the tiling can be searched outside of the compilation thread
+    const Resources _resources;
+
 public:
     ConvolutionOptions(std::string stageName, const DimValues& inputDims, const DimValues& outputDims,
                        const DimValues& origOutputDims, int kernelSizeX, int kernelSizeY,
                        int kernelStride, int paddingLeft, int paddingRight,
-                       int paddingTop, int paddingBottom, bool withPool)
+                       int paddingTop, int paddingBottom, bool withPool,
+                       const Resources& resources = CompileEnv::get().resources)
             : _stageName(std::move(stageName)), _inputDims(inputDims), _outputDims(outputDims),
               _origOutputDims(origOutputDims), _kernelSizeX(kernelSizeX), _kernelSizeY(kernelSizeY),
               _kernelStride(kernelStride), _paddingLeft(paddingLeft), _paddingRight(paddingRight),
-              _paddingTop(paddingTop), _paddingBottom(paddingBottom), _withPool(withPool) {}
+              _paddingTop(paddingTop), _paddingBottom(paddingBottom), _withPool(withPool),
+              _resources(resources) {}
 };
 
 struct TilingOption final {
@@ -148,7 +153,7 @@ public:
         _maxTilingOptions(maxTilingOptions) {
             IE_ASSERT(maxTilingOptions > 0);
             _dirTiling->initTileSizes();
-            _tilingOptions = selectBetterTiling();
+            _tilingOptions = findBetterTiling();
         }
 
     const std::vector<TilingOption>& tilingOptions() const {
@@ -159,7 +164,12 @@ public:
 
     HWConvolutionTileLayoutCut tileLayoutCut(const TilingOption& option) const;
 
+    // the number of searches served by the options found before, since the start of the process
+    static std::size_t cacheHits();
+
 private:
+    // takes the options found for the same convolution parameters before or searches them
+    std::vector<TilingOption> findBetterTiling() const;
     std::vector<TilingOption> selectBetterTiling() const;
 
     const ConvolutionOptions _convolutionOptions;
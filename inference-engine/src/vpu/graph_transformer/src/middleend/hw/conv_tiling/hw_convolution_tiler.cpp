@@ -4,6 +4,8 @@
 
 #include <algorithm>
 #include <limits>
+#include <map>
+#include <mutex>
 #include <vector>
 #include <memory>
 #include <utility>
@@ -325,7 +327,7 @@ bool GraphDataTiling::ceilNeeded() const {
 bool GraphDataTiling::patternMatching() {
     // All optimizations below are for MiryadX code with 2 threads, so at least 9 slices is required.
     // TODO: check 1-thread perfomance and replace with exact equality check.
-    if (CompileEnv::get().resources.numCMXSlices < 9) {
+    if (_convolutionOptions._resources.numCMXSlices < 9) {
         return false;
     }
 
@@ -614,12 +616,93 @@ std::unique_ptr<GraphDataTiling> ConvGraphDataTilingFactory::makeDirTiling(const
     }
 }
 
+namespace {
+
+//
+// The search depends only on the shapes and the parameters of the convolution and on the CMX resources,
+// so the options found are shared by the stages and the compilations of the process.
+//
+class TilingOptionsCache final {
+public:
+    using Key = std::vector<int>;
+
+    static TilingOptionsCache& instance() {
+        static TilingOptionsCache cache;
+        return cache;
+    }
+
+    bool find(const Key& key, std::vector<TilingOption>& options) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const auto it = _options.find(key);
+        if (it == _options.end()) {
+            return false;
+        }
+        options = it->second;
+        ++_hits;
+        return true;
+    }
+
+    std::size_t hits() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _hits;
+    }
+
+    void insert(const Key& key, const std::vector<TilingOption>& options) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        // the networks compiled by the process are not expected to have more distinct convolutions
+        if (_options.size() >= maxSize) {
+            _options.clear();
+        }
+        _options.emplace(key, options);
+    }
+
+private:
+    static constexpr std::size_t maxSize = 16384;
+
+    std::mutex _mutex;
+    std::map<Key, std::vector<TilingOption>> _options;
+    std::size_t _hits = 0;
+};
+
+TilingOptionsCache::Key tilingOptionsKey(const ConvolutionOptions& options, Direction direction,
+                                         std::size_t maxTilingOptions) {
+    TilingOptionsCache::Key key;
+    for (const auto& dims : {options._inputDims, options._outputDims, options._origOutputDims}) {
+        for (const auto dim : {Dim::W, Dim::H, Dim::C}) {
+            key.push_back(dims[dim]);
+        }
+    }
+    key.insert(key.end(), {
+        options._kernelSizeX, options._kernelSizeY, options._kernelStride,
+        options._paddingLeft, options._paddingRight, options._paddingTop, options._paddingBottom,
+        options._withPool, static_cast<int>(direction), static_cast<int>(maxTilingOptions),
+        options._resources.numCMXSlices, options._resources.tilingCMXLimit
+    });
+    return key;
+}
+
+}  // namespace
+
+std::vector<TilingOption> HWConvolutionTilingSearcher::findBetterTiling() const {
+    auto& cache = TilingOptionsCache::instance();
+    const auto key = tilingOptionsKey(_convolutionOptions, _dirTiling->getDirection(), _maxTilingOptions);
+
+    std::vector<TilingOption> options;
+    if (!cache.find(key, options)) {
+        options = selectBetterTiling();
+        cache.insert(key, options);
+    }
+    return options;
+}
+
+std::size_t HWConvolutionTilingSearcher::cacheHits() {
+    return TilingOptionsCache::instance().hits();
+}
+
 //
 // Looks for the optimal tiling accordingly to the cost function. Modifies dimensions in dirTiling during search.
 //
 std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() const {
-    const auto& env = CompileEnv::get();
-
     auto& dirTiling = *_dirTiling;
     FixedMaxHeap<TilingOption> tilingOptions(_maxTilingOptions);
 
@@ -644,7 +727,7 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
 
     const auto& splitOver = dirTiling.splitOverTensorDims();
     const auto direction = dirTiling.getDirection();
-    const auto cmxLimit = env.resources.tilingCMXLimit;
+    const auto cmxLimit = _convolutionOptions._resources.tilingCMXLimit;
 
     // split over Input tensor for the Channel dimension always
     for (int numChannelTiles = 1; numChannelTiles <= maxNumChannelTiles; numChannelTiles++) {
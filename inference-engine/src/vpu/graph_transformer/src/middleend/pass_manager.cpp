@@ -8,6 +8,10 @@
 #include <iomanip>
 #include <memory>
 #include <string>
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/configuration/options/copy_optimization.hpp>
@@ -51,6 +55,10 @@ void PassSet::run(const Model& model) const {
     env.log->debug("MiddleEnd : Run passes");
     VPU_LOGGER_SECTION(env.log);
 
+    // total duration and number of runs of the passes of the same name
+    std::map<std::string, std::pair<double, int>> passDurations;
+    double totalDuration = 0.0;
+
     int passInd = 0;
     for (const auto& p : _passes) {
         env.log->debug("Start pass %m%d / %d [%s]", std::setw(2), passInd + 1, _passes.size(), p.second);
@@ -64,15 +72,36 @@ void PassSet::run(const Model& model) const {
 
         auto endTime = std::chrono::high_resolution_clock::now();
 
+        const auto duration = std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count();
         env.log->debug(
             "Pass %m%d / %d [%s] duration : %f ms",
-            std::setw(2), passInd + 1, _passes.size(), p.second,
-            std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count());
+            std::setw(2), passInd + 1, _passes.size(), p.second, duration);
+
+        auto& passDuration = passDurations[p.second];
+        passDuration.first += duration;
+        passDuration.second++;
+        totalDuration += duration;
 
         ++passInd;
     }
 
     model->cleanUp();
+
+    if (env.log->isActive(LogLevel::Info)) {
+        std::vector<std::pair<std::string, std::pair<double, int>>> breakdown(passDurations.begin(), passDurations.end());
+        std::stable_sort(breakdown.begin(), breakdown.end(), [](const decltype(breakdown)::value_type& lhs,
+                                                                const decltype(breakdown)::value_type& rhs) {
+            return lhs.second.first > rhs.second.first;
+        });
+
+        env.log->info("MiddleEnd : passes compile time breakdown, total %f ms", totalDuration);
+        VPU_LOGGER_SECTION(env.log);
+
+        for (const auto& pass : breakdown) {
+            env.log->info("%s : %f ms (%f %%) in %d run(s)", pass.first, pass.second.first,
+                          totalDuration > 0.0 ? 100.0 * pass.second.first / totalDuration : 0.0, pass.second.second);
+        }
+    }
 }
 
 //
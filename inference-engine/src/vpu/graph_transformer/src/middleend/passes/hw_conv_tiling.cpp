@@ -5,9 +5,11 @@
 #include <vpu/middleend/pass_manager.hpp>
 
 #include <precision_utils.h>
+#include <ie_parallel.hpp>
 #include <utility>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/stages/stub_stage.hpp>
@@ -31,9 +33,36 @@ private:
     StageBuilder::Ptr _stageBuilder;
 };
 
+HWTilingNS::ConvolutionOptions makeConvolutionOptions(const Stage& origStage) {
+    const HWConvStageOptions stageOptions(origStage);
+    const HWConvStageIO stageIO(origStage, origStage->output(0));
+
+    return HWTilingNS::ConvolutionOptions{
+        origStage->name(),
+        stageIO.origInput->desc().dims(),
+        stageIO.origOutput->desc().dims(),
+        stageIO.origOutputDesc.dims(),
+        stageOptions.kernelSizeX,
+        stageOptions.kernelSizeY,
+        stageOptions.kernelStride,
+        stageOptions.padLeft,
+        stageOptions.padRight,
+        stageOptions.padTop,
+        stageOptions.padBottom,
+        stageOptions.withPool
+    };
+}
+
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwConvTiling);
 
+    //
+    // Collect the parameters of the stages on the compilation thread
+    //
+
+    std::vector<Stage> origStages;
+    std::vector<HWTilingNS::ConvolutionOptions> convolutionOptions;
+
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubConv) {
             continue;
@@ -44,61 +73,55 @@ void PassImpl::run(const Model& model) {
             continue;
         }
 
-        const HWConvStageOptions stageOptions(origStage);
-        const HWConvStageIO stageIO(origStage, origStage->output(0));
+        origStages.push_back(origStage);
+        convolutionOptions.push_back(makeConvolutionOptions(origStage));
+    }
 
-        //
-        // Unsupported paddings
-        //
+    //
+    // Try to find "best" tiling, the stages are independent so they are searched in parallel
+    //
+
+    const size_t tilingsCount = 1;
+    const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
+                                         // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+    std::vector<std::unique_ptr<HWTilingNS::HWConvolutionTiler>> tilers(origStages.size());
+
+    ie::parallel_for(origStages.size(), [&](size_t ind) {
+        tilers[ind].reset(new HWTilingNS::HWConvolutionTiler(convolutionOptions[ind], direction, tilingsCount));
+
+        if (!tilers[ind]->isTilingPossible() && tilers[ind]->withPool()) {
+            const auto& options = convolutionOptions[ind];
+            const auto optionsWithoutPool = HWTilingNS::ConvolutionOptions{
+                options._stageName,
+                options._inputDims,
+                options._origOutputDims,
+                options._origOutputDims,
+                options._kernelSizeX,
+                options._kernelSizeY,
+                options._kernelStride,
+                options._paddingLeft,
+                options._paddingRight,
+                options._paddingTop,
+                options._paddingBottom,
+                false,
+                options._resources
+            };
+
+            tilers[ind].reset(new HWTilingNS::HWConvolutionTiler(optionsWithoutPool, direction, tilingsCount));
+        }
+    });
 
-        //
-        // Try to find "best" tiling
-        //
+    //
+    // Replace the stages by the tiles on the compilation thread
+    //
 
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
-                                             // HWTilingNS::Direction::OUTPUT_TO_INPUT;
-
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
-            origStage->name(),
-            stageIO.origInput->desc().dims(),
-            stageIO.origOutput->desc().dims(),
-            stageIO.origOutputDesc.dims(),
-            stageOptions.kernelSizeX,
-            stageOptions.kernelSizeY,
-            stageOptions.kernelStride,
-            stageOptions.padLeft,
-            stageOptions.padRight,
-            stageOptions.padTop,
-            stageOptions.padBottom,
-            stageOptions.withPool
-        };
-
-        const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount);
-
-
-        const HWTilingNS::HWConvolutionTiler& tiler = [&] {
-            if (!tiler1stAttempt.isTilingPossible() && tiler1stAttempt.withPool()) {
-                const auto optionsWithoutPool = HWTilingNS::ConvolutionOptions{
-                    origStage->name(),
-                    stageIO.origInput->desc().dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageOptions.kernelSizeX,
-                    stageOptions.kernelSizeY,
-                    stageOptions.kernelStride,
-                    stageOptions.padLeft,
-                    stageOptions.padRight,
-                    stageOptions.padTop,
-                    stageOptions.padBottom,
-                    false
-                };
-
-                return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingsCount};
-            } else {
-                return tiler1stAttempt;
-            }
-        }();
+    for (size_t ind = 0; ind < origStages.size(); ++ind) {
+        const auto& origStage = origStages[ind];
+        const auto& tiler = *tilers[ind];
+
+        const HWConvStageOptions stageOptions(origStage);
+        const HWConvStageIO stageIO(origStage, origStage->output(0));
 
         //
         // Use SW stage if tiling optimization failed
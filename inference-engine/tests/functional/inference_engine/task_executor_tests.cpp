@@ -2,7 +2,14 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <future>
+#include <iostream>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -10,6 +17,8 @@
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <threading/ie_immediate_executor.hpp>
 #include <ie_system_conf.h>
+#include <ie_plugin_config.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 
 using namespace ::testing;
 using namespace std;
@@ -198,6 +207,102 @@ TEST_F(StreamsExecutorConfigTest, streamsExecutorConfigReturnStrings) {
     }
 }
 
+TEST_F(StreamsExecutorConfigTest, lockFreeTaskQueueKeyRoundTrip) {
+    IStreamsExecutor::Config config;
+    ASSERT_EQ(IStreamsExecutor::Config::TaskQueueType::MUTEX, config._taskQueueType);
+    config.SetConfig(CONFIG_KEY_INTERNAL(CPU_LOCK_FREE_TASK_QUEUE), CONFIG_VALUE(YES));
+    ASSERT_EQ(IStreamsExecutor::Config::TaskQueueType::LOCK_FREE, config._taskQueueType);
+    ASSERT_EQ(CONFIG_VALUE(YES), config.GetConfig(CONFIG_KEY_INTERNAL(CPU_LOCK_FREE_TASK_QUEUE)).as<std::string>());
+    ASSERT_THROW(config.SetConfig(CONFIG_KEY_INTERNAL(CPU_LOCK_FREE_TASK_QUEUE), "ON"), Exception);
+}
+
+class StreamsExecutorQueueLatencyTest : public ::testing::TestWithParam<IStreamsExecutor::Config::TaskQueueType> {};
+
+// Measures the time between `run()` call and the moment the task starts on a stream thread and checks that every task
+// starts and that every stream starts the tasks of a producer in the order they were submitted.
+// Several producers submit short tasks in bursts, so both the contended and the parked-consumer paths are covered.
+// The number of not started tasks of a producer is bounded, so the lock-free ring never overflows: the tasks which do
+// not fit into the ring are not ordered with the ones in it.
+TEST_P(StreamsExecutorQueueLatencyTest, enqueueToStartLatency) {
+    using Clock = std::chrono::steady_clock;
+    constexpr int producersNum = 4;
+    constexpr int tasksPerProducer = 5000;
+    constexpr int burstSize = 16;
+    constexpr int maxPendingPerProducer = 128;
+    const auto queueType = GetParam();
+
+    auto streams = getNumberOfCPUCores();
+    std::vector<std::vector<Clock::duration>> latencies(producersNum);
+    // every stream has a single thread, so its log is written by that thread only
+    std::vector<std::vector<std::pair<int, int>>> startedPerStream(streams);
+    std::vector<std::atomic_int> started(producersNum);
+    std::atomic_int executed = {0};
+
+    // the executor is destroyed first, so the tasks left after a failed check do not outlive the data above
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams, 1, IStreamsExecutor::ThreadBindingType::NONE};
+    config._taskQueueType = queueType;
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(config);
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producersNum; p++) {
+        latencies[p].resize(tasksPerProducer);
+        started[p] = 0;
+        producers.emplace_back([&, p] {
+            for (int t = 0; t < tasksPerProducer; t++) {
+                while (t - started[p] >= maxPendingPerProducer) std::this_thread::yield();
+                auto& latency = latencies[p][t];
+                auto start = Clock::now();
+                taskExecutor->run([&, p, t, start] {
+                    latency = Clock::now() - start;
+                    startedPerStream[taskExecutor->GetStreamId()].emplace_back(p, t);
+                    ++started[p];
+                    ++executed;
+                });
+                if (0 == (t + 1) % burstSize) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(50));
+                }
+            }
+        });
+    }
+    for (auto&& producer : producers) producer.join();
+    const auto deadline = Clock::now() + std::chrono::seconds(30);
+    while (executed != producersNum * tasksPerProducer && Clock::now() < deadline) std::this_thread::yield();
+    ASSERT_EQ(producersNum * tasksPerProducer, executed) << "Not all the tasks were started";
+
+    for (auto&& streamLog : startedPerStream) {
+        std::vector<int> lastTask(producersNum, -1);
+        for (auto&& task : streamLog) {
+            ASSERT_LT(lastTask[task.first], task.second) << "Task " << task.second << " of producer " << task.first
+                                                         << " is started after task " << lastTask[task.first];
+            lastTask[task.first] = task.second;
+        }
+    }
+
+    std::vector<Clock::duration> all;
+    for (auto&& l : latencies) all.insert(all.end(), l.begin(), l.end());
+    std::sort(all.begin(), all.end());
+    auto percentile = [&all] (double p) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(all[static_cast<size_t>(p * (all.size() - 1))]).count();
+    };
+    RecordProperty("p50_latency_ns", static_cast<int>(percentile(0.5)));
+    RecordProperty("p99_latency_ns", static_cast<int>(percentile(0.99)));
+    std::cout << (queueType == IStreamsExecutor::Config::TaskQueueType::LOCK_FREE ? "LOCK_FREE" : "MUTEX")
+              << " queue enqueue-to-start latency, ns: p50 " << percentile(0.5) << " p90 " << percentile(0.9)
+              << " p99 " << percentile(0.99) << std::endl;
+}
+
+INSTANTIATE_TEST_SUITE_P(StreamsExecutorQueueLatencyTest, StreamsExecutorQueueLatencyTest,
+                         ::testing::Values(IStreamsExecutor::Config::TaskQueueType::MUTEX,
+                                           IStreamsExecutor::Config::TaskQueueType::LOCK_FREE));
+
+static IStreamsExecutor::Config lockFreeQueueConfig() {
+    auto streams = getNumberOfCPUCores();
+    auto threads = parallel_get_max_threads();
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor",
+                                    streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE};
+    config._taskQueueType = IStreamsExecutor::Config::TaskQueueType::LOCK_FREE;
+    return config;
+}
+
 static auto Executors = ::testing::Values(
     [] {
         auto streams = getNumberOfCPUCores();
@@ -205,6 +310,9 @@ static auto Executors = ::testing::Values(
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
     },
+    [] {
+        return std::make_shared<CPUStreamsExecutor>(lockFreeQueueConfig());
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
     }
@@ -218,6 +326,9 @@ static auto AsyncExecutors = ::testing::Values(
         auto threads = parallel_get_max_threads();
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
+    },
+    [] {
+        return std::make_shared<CPUStreamsExecutor>(lockFreeQueueConfig());
     }
 );
 
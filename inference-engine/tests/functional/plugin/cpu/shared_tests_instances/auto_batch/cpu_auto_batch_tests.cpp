@@ -0,0 +1,15 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+#include "auto_batch/auto_batch_tests.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+const std::vector<size_t> batch_sizes {2, 4};
+
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatchingCPU, AutoBatching_Test,
+        ::testing::Combine(
+                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                ::testing::ValuesIn(batch_sizes)),
+        AutoBatching_Test::getTestCaseName);
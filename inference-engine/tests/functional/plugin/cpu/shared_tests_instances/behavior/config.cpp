@@ -23,7 +23,11 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "8"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::NO}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_LAYOUT_OPTIMIZATION, InferenceEngine::PluginConfigParams::NO}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_COMPILE_PROFILE_NODE_COUNTS, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SHAPE_CACHE_CAPACITY, "4"}}
     };
 
     const std::vector<std::map<std::string, std::string>> MultiConfigs = {
@@ -54,7 +58,11 @@ namespace {
     const std::vector<std::map<std::string, std::string>> inconfigs = {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "OFF"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, "OFF"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_LAYOUT_OPTIMIZATION, "OFF"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_COMPILE_PROFILE_NODE_COUNTS, "OFF"}},
+            {{InferenceEngine::PluginConfigParams::KEY_CPU_SHAPE_CACHE_CAPACITY, "-1"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
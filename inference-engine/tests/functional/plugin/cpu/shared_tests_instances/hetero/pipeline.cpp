@@ -0,0 +1,73 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "ie_core.hpp"
+#include "hetero/hetero_plugin_config.hpp"
+#include "common_test_utils/test_common.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+namespace {
+
+using HeteroPipelineTest = CommonTestUtils::TestsCommon;
+
+// the layers are split between two groups of the CPU cores which run the subgraphs as the stages of the pipeline
+TEST_F(HeteroPipelineTest, smoke_cpuCoreGroupsProduceSameResults) {
+    auto ie = PluginCache::get().ie();
+    InferenceEngine::CNNNetwork network(ngraph::builder::subgraph::makeSplitMultiConvConcat());
+    auto exec_net = ie->LoadNetwork(network, "HETERO:CPU.0,CPU.1",
+                                    {{HETERO_CONFIG_KEY(PIPELINE), CONFIG_VALUE(YES)}});
+    auto ref_net = ie->LoadNetwork(network, "CPU");
+    ASSERT_TRUE(exec_net.GetConfig(HETERO_CONFIG_KEY(PIPELINE)).as<bool>());
+
+    const auto inputName = exec_net.GetInputsInfo().begin()->first;
+    const auto outputName = exec_net.GetOutputsInfo().begin()->first;
+    const auto numRequests = std::max(4u, exec_net.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (unsigned int i = 0; i < numRequests; i++) {
+        requests.push_back(exec_net.CreateInferRequest());
+        auto input = requests.back().GetBlob(inputName);
+        auto data = FuncTestUtils::createAndFillBlob(input->getTensorDesc(), 10, 0, 1, static_cast<int>(i));
+        std::memcpy(input->buffer(), data->cbuffer(), data->byteSize());
+    }
+    for (auto&& request : requests)
+        ASSERT_NO_THROW(request.StartAsync());
+    for (auto&& request : requests)
+        ASSERT_EQ(request.Wait(InferenceEngine::InferRequest::RESULT_READY), InferenceEngine::StatusCode::OK);
+
+    auto ref_request = ref_net.CreateInferRequest();
+    for (auto&& request : requests) {
+        ref_request.SetBlob(inputName, request.GetBlob(inputName));
+        ref_request.Infer();
+        FuncTestUtils::compareBlobs(request.GetBlob(outputName), ref_request.GetBlob(outputName));
+    }
+}
+
+// the parameter without consumers keeps the core group assigned to it, the rest of the layers are split
+TEST_F(HeteroPipelineTest, smoke_cpuCoreGroupsQueryNetworkWithUnusedParameter) {
+    auto ie = PluginCache::get().ie();
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 8}, {1, 8}});
+    params[1]->set_friendly_name("unused");
+    auto relu = std::make_shared<ngraph::opset1::Relu>(params[0]);
+    auto sigmoid = std::make_shared<ngraph::opset1::Sigmoid>(relu);
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{sigmoid}, params, "UnusedParameter");
+    InferenceEngine::CNNNetwork network(function);
+
+    InferenceEngine::QueryNetworkResult result;
+    ASSERT_NO_THROW(result = ie->QueryNetwork(network, "HETERO:CPU.0,CPU.1"));
+    ASSERT_EQ(1u, result.supportedLayersMap.count("unused"));
+    for (auto&& layer : result.supportedLayersMap) {
+        EXPECT_TRUE(layer.second == "CPU.0" || layer.second == "CPU.1") << layer.first << " on " << layer.second;
+    }
+}
+
+}  // namespace
@@ -0,0 +1,20 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include "multi/multi_scheduling_tests.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+const std::vector<DevicesNames> device_names_for_scheduling {
+        {CPU},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SchedulingMultiCPU, MultiDevice_Test,
+        ::testing::ValuesIn(device_names_for_scheduling), MultiDevice_Test::getTestCaseName);
+
+// the reference implementations of the TEMPLATE device are far slower than the CPU ones
+INSTANTIATE_TEST_SUITE_P(smoke_ThroughputSchedulingMultiCPU, MultiDeviceThroughput_Test,
+        ::testing::Values(MultiDeviceThroughputParams{{CPU, CommonTestUtils::DEVICE_TEMPLATE}, CPU}),
+        MultiDeviceThroughput_Test::getTestCaseName);
@@ -3,6 +3,7 @@
 //
 
 #include <shared_test_classes/single_layer/convert.hpp>
+#include "ngraph_functions/builders.hpp"
 
 using namespace LayerTestsDefinitions;
 using namespace InferenceEngine;
@@ -21,6 +22,58 @@ TEST_P(ConvertCPULayerTest, CompareWithRefs) {
     Run();
 }
 
+// The values out of the destination range are saturated and the fractional ones are truncated towards zero,
+// the reference implementation leaves them undefined, so the expected values are listed explicitly
+using ConvertOutOfRangeParams = std::pair<Precision, std::vector<float>>;
+
+class ConvertOutOfRangeCPUTest : public testing::WithParamInterface<ConvertOutOfRangeParams>,
+                                 public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ConvertOutOfRangeParams>& obj) {
+        return "outPRC=" + std::string(obj.param.first.name());
+    }
+
+    static const std::vector<float> inputValues;
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        outPrc = GetParam().first;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, inputValues.size()}});
+        auto convert = std::make_shared<ngraph::opset1::Convert>(
+            params[0], FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(outPrc));
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{convert}, params, "ConvertOutOfRange");
+    }
+};
+
+const std::vector<float> ConvertOutOfRangeCPUTest::inputValues = {-1e10f, -300.f, -128.7f, -3.7f, 3.7f, 127.9f,
+                                                                  300.f, 1e10f};
+
+TEST_P(ConvertOutOfRangeCPUTest, SaturatesAndTruncates) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    inferRequest = executableNetwork.CreateInferRequest();
+    auto input = inferRequest.GetBlob(cnnNetwork.getInputsInfo().begin()->first);
+    std::copy(inputValues.begin(), inputValues.end(), input->buffer().as<float*>());
+    inferRequest.Infer();
+
+    auto output = inferRequest.GetBlob(cnnNetwork.getOutputsInfo().begin()->first);
+    ASSERT_EQ(outPrc, output->getTensorDesc().getPrecision());
+    const auto& expected = GetParam().second;
+    for (size_t i = 0; i < expected.size(); i++) {
+        float actual = 0.f;
+        switch (outPrc) {
+        case Precision::U8: actual = output->cbuffer().as<const uint8_t*>()[i]; break;
+        case Precision::I8: actual = output->cbuffer().as<const int8_t*>()[i]; break;
+        case Precision::I32: actual = static_cast<float>(output->cbuffer().as<const int32_t*>()[i]); break;
+        default: FAIL() << "Unexpected precision " << outPrc;
+        }
+        ASSERT_EQ(expected[i], actual) << "input value " << inputValues[i];
+    }
+}
+
 namespace {
 const std::vector<std::vector<size_t>> inShape = {{1, 2, 3, 4}};
 
@@ -52,5 +105,14 @@ INSTANTIATE_TEST_SUITE_P(smoke_ConvertLayerTest_To_BF16, ConvertCPULayerTest,
                                 ::testing::Values(Layout::ANY),
                                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
                         ConvertLayerTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConvertOutOfRange_From_FP32, ConvertOutOfRangeCPUTest,
+                        ::testing::Values(
+                                ConvertOutOfRangeParams{Precision::U8, {0, 0, 0, 0, 3, 127, 255, 255}},
+                                ConvertOutOfRangeParams{Precision::I8, {-128, -128, -128, -3, 3, 127, 127, 127}},
+                                // 2147483520 is the largest FP32 value below 2^31
+                                ConvertOutOfRangeParams{Precision::I32, {-2147483648.f, -300, -128, -3, 3, 127, 300,
+                                                                         2147483520.f}}),
+                        ConvertOutOfRangeCPUTest::getTestCaseName);
 } // namespace
 } // namespace CPULayerTestsDefinitions
\ No newline at end of file
@@ -0,0 +1,119 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+
+#include "ngraph_functions/builders.hpp"
+#include "ngraph/graph_util.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        size_t,                             // channels of the feature maps
+        CPUSpecificParams
+> ROIFeatureExtractorLayerCPUTestParamsSet;
+
+class ROIFeatureExtractorLayerCPUTest : public testing::WithParamInterface<ROIFeatureExtractorLayerCPUTestParamsSet>,
+                                        virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ROIFeatureExtractorLayerCPUTestParamsSet> obj) {
+        size_t channels;
+        CPUSpecificParams cpuParams;
+        std::tie(channels, cpuParams) = obj.param;
+
+        std::ostringstream result;
+        result << "channels=" << channels;
+        result << CPUTestsBase::getTestCaseName(cpuParams);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        size_t channels;
+        CPUSpecificParams cpuParams;
+        std::tie(channels, cpuParams) = this->GetParam();
+        std::tie(inFmts, outFmts, priority, selectedType) = cpuParams;
+        selectedType = selectedType + "_" + Precision(Precision::FP32).name();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        // the ROIs are distributed between both levels of the pyramid of the 64x64 image
+        const std::vector<float> roisVector = { 0, 0, 10, 10,  3, 5, 20, 17,  0, 0, 63, 63,  10, 20, 60, 50,  5, 5, 40, 61 };
+        auto rois = ngraph::builder::makeConstant<float>(ngraph::element::f32, {roisVector.size() / 4, 4}, roisVector);
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, channels, 16, 16}, {1, channels, 8, 8}});
+
+        ngraph::opset6::ExperimentalDetectronROIFeatureExtractor::Attributes attrs;
+        attrs.output_size = 3;
+        attrs.sampling_ratio = 2;
+        attrs.pyramid_scales = {4, 8};
+        attrs.aligned = false;
+        auto extractor = std::make_shared<ngraph::opset6::ExperimentalDetectronROIFeatureExtractor>(
+                ngraph::OutputVector{rois, params[0], params[1]}, attrs);
+        extractor->get_rt_info() = getCPUInfo();
+
+        threshold = 1e-3f;
+        const ngraph::ResultVector results{std::make_shared<ngraph::opset6::Result>(extractor->output(0)),
+                                           std::make_shared<ngraph::opset6::Result>(extractor->output(1))};
+        function = std::make_shared<ngraph::Function>(results, params, "ROIFeatureExtractor");
+    }
+
+    // nchw feature maps are pooled by the scalar implementation, which is the reference for the other layouts
+    std::vector<std::pair<ngraph::element::Type, std::vector<std::uint8_t>>> CalculateRefs() override {
+        auto refFunction = ngraph::clone_function(*function);
+        for (const auto& node : refFunction->get_ops()) {
+            if (ngraph::is_type<ngraph::opset6::ExperimentalDetectronROIFeatureExtractor>(node))
+                node->get_rt_info() = makeCPUInfo({nc, nchw, nchw}, {nchw, nc}, {});
+        }
+
+        auto refNetwork = getCore()->LoadNetwork(InferenceEngine::CNNNetwork{refFunction}, targetDevice, configuration);
+        auto refRequest = refNetwork.CreateInferRequest();
+        const auto& refParams = refFunction->get_parameters();
+        for (size_t i = 0; i < refParams.size(); ++i)
+            refRequest.SetBlob(refParams[i]->get_friendly_name(), inputs[i]);
+        refRequest.Infer();
+
+        std::vector<std::pair<ngraph::element::Type, std::vector<std::uint8_t>>> expectedOutputs;
+        for (const auto& output : refNetwork.GetOutputsInfo()) {
+            auto memory = as<MemoryBlob>(refRequest.GetBlob(output.first));
+            const auto lockedMemory = memory->rmap();
+            const auto buffer = lockedMemory.as<const std::uint8_t*>();
+            expectedOutputs.emplace_back(ngraph::element::f32, std::vector<std::uint8_t>(buffer, buffer + memory->byteSize()));
+        }
+        return expectedOutputs;
+    }
+};
+
+TEST_P(ROIFeatureExtractorLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    Run();
+    CheckPluginRelatedResults(executableNetwork, "ExperimentalDetectronROIFeatureExtractor");
+}
+
+namespace {
+
+std::vector<CPUSpecificParams> filterCPUInfoForDevice() {
+    std::vector<CPUSpecificParams> resCPUParams;
+    resCPUParams.push_back(CPUSpecificParams{{nc, nchw, nchw}, {nchw, nc}, {}, "ref_any"});
+    // the feature maps in the other layouts are pooled by the JIT kernel
+    if (with_cpu_x86_avx2()) {
+        const std::string jitType = with_cpu_x86_avx512_core() ? "jit_avx512" : "jit_avx2";
+        resCPUParams.push_back(CPUSpecificParams{{nc, nhwc, nhwc}, {nhwc, nc}, {}, jitType});
+        resCPUParams.push_back(CPUSpecificParams{{nc, nChw8c, nChw8c}, {nChw8c, nc}, {}, jitType});
+        resCPUParams.push_back(CPUSpecificParams{{nc, nChw16c, nChw16c}, {nChw16c, nc}, {}, jitType});
+    }
+    return resCPUParams;
+}
+
+// 20 channels are not a multiple of the blocks, so the blocked feature maps and features are padded
+const std::vector<size_t> channels = { 8, 20 };
+
+INSTANTIATE_TEST_SUITE_P(smoke_ROIFeatureExtractorLayoutTest, ROIFeatureExtractorLayerCPUTest,
+        ::testing::Combine(
+                ::testing::ValuesIn(channels),
+                ::testing::ValuesIn(filterCPUInfoForDevice())),
+        ROIFeatureExtractorLayerCPUTest::getTestCaseName);
+} // namespace
+} // namespace CPULayerTestsDefinitions
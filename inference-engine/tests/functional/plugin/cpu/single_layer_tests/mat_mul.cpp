@@ -109,6 +109,61 @@ TEST_P(MatMulLayerCPUTest, CompareWithRefs) {
     CheckFusingResults(executableNetwork, cpuNodeType);
 }
 
+using MatMulPrecisionCPUTestParams = std::tuple<std::pair<SizeVector, SizeVector>,
+                                                Precision>;  // BF16 or I8 execution precision
+
+// MatMul of two activations executed in the low precision. The node must run on the oneDNN gemm based primitive
+// rather than fall back to the reference implementation
+class MatMulPrecisionCPUTest : public testing::WithParamInterface<MatMulPrecisionCPUTestParams>,
+                               virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MatMulPrecisionCPUTestParams> obj) {
+        std::pair<SizeVector, SizeVector> IS;
+        Precision prec;
+        std::tie(IS, prec) = obj.param;
+
+        std::ostringstream result;
+        result << "IS_A=" << CommonTestUtils::vec2str(IS.first) << "_";
+        result << "IS_B=" << CommonTestUtils::vec2str(IS.second) << "_";
+        result << "Prec=" << prec;
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::pair<SizeVector, SizeVector> IS;
+        Precision prec;
+        std::tie(IS, prec) = this->GetParam();
+
+        auto params = builder::makeParams(element::f32, {IS.first, IS.second});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<opset1::Parameter>(params));
+
+        std::shared_ptr<Node> matMul;
+        if (prec == Precision::BF16) {
+            inPrc = outPrc = Precision::BF16;
+            configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES});
+            matMul = builder::makeMatMul(paramOuts[0], paramOuts[1], false, false);
+        } else {
+            // LPT makes the first input U8 and the second one I8
+            auto fqA = builder::makeFakeQuantize(paramOuts[0], element::f32, 256, {}, {0.f}, {2.55f}, {0.f}, {2.55f});
+            auto fqB = builder::makeFakeQuantize(paramOuts[1], element::f32, 256, {}, {-1.28f}, {1.27f}, {-1.28f}, {1.27f});
+            matMul = builder::makeMatMul(fqA, fqB, false, false);
+        }
+
+        selectedType = std::string("jit_gemm_") + prec.name();
+        function = makeNgraphFunction(element::f32, params, matMul, "MatMulPrecision");
+    }
+};
+
+TEST_P(MatMulPrecisionCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckPluginRelatedResults(executableNetwork, "MatMul");
+}
+
 namespace {
 
 /* ============= Common params ============= */
@@ -199,6 +254,42 @@ const auto testParams = ::testing::Combine(gemmParams,
 
 INSTANTIATE_TEST_SUITE_P(smoke_Check, MatMulLayerCPUTest, testParams, MatMulLayerCPUTest::getTestCaseName);
 
+const std::vector<std::pair<SizeVector, SizeVector>> ISFusing = {
+    {{7, 32, 120}, {3, 7, 120, 50}},
+    {{55, 12}, {12, 55}}
+};
+
+// per-channel post-ops are applied along the output dimension 1, which is a batch dimension for MatMul
+std::vector<fusingSpecificParams> fusingParamsSet {
+        fusingRelu,
+        fusingClamp,
+        fusingFakeQuantizePerTensor
+};
+
+const auto gemmFusingParams = ::testing::Combine(::testing::ValuesIn(ISFusing),
+                                                 ::testing::Values(Precision::FP32),
+                                                 ::testing::Values(helpers::InputLayerType::PARAMETER),
+                                                 ::testing::ValuesIn(transpose),
+                                                 ::testing::ValuesIn(transpose));
+
+const auto testFusingParams = ::testing::Combine(gemmFusingParams,
+                                                 ::testing::Values(MatMulNodeType::MatMul),
+                                                 ::testing::ValuesIn(fusingParamsSet));
+
+INSTANTIATE_TEST_SUITE_P(smoke_Check_Fusing, MatMulLayerCPUTest, testFusingParams, MatMulLayerCPUTest::getTestCaseName);
+
+const std::vector<std::pair<SizeVector, SizeVector>> ISPrecision = {
+    {{2, 16, 32}, {2, 32, 24}},
+    {{1, 3, 16, 32}, {3, 32, 16}}
+};
+
+// the tests names contain BF16, so they are skipped on the platforms without bfloat16 support
+const auto testPrecisionParams = ::testing::Combine(::testing::ValuesIn(ISPrecision),
+                                                    ::testing::Values(Precision::BF16, Precision::I8));
+
+INSTANTIATE_TEST_SUITE_P(smoke_Check_Precision, MatMulPrecisionCPUTest, testPrecisionParams,
+                         MatMulPrecisionCPUTest::getTestCaseName);
+
 }; // namespace gemm
 
 } // namespace
@@ -93,7 +93,7 @@ protected:
         auto roialign = std::make_shared<ngraph::opset3::ROIAlign>(params[0], coords, roisIdx, pooledH, pooledW,
                                                                    samplingRatio, spatialScale, mode);
         roialign->get_rt_info() = getCPUInfo();
-        selectedType = std::string("unknown_") + inPrc.name();
+        selectedType = selectedType + "_" + inPrc.name();
 
         threshold = 1e-2;
         const ngraph::ResultVector results{std::make_shared<ngraph::opset3::Result>(roialign)};
@@ -110,14 +110,23 @@ TEST_P(ROIAlignLayerCPUTest, CompareWithRefs) {
 namespace {
 
 /* CPU PARAMS */
+// the channels of nchw are not contiguous, so only the other layouts are pooled by the JIT kernel
+std::string getJitType() {
+    if (with_cpu_x86_avx512_core())
+        return "jit_avx512";
+    if (with_cpu_x86_avx2())
+        return "jit_avx2";
+    return "ref";
+}
+
 std::vector<CPUSpecificParams> filterCPUInfoForDevice() {
     std::vector<CPUSpecificParams> resCPUParams;
-    resCPUParams.push_back(CPUSpecificParams{{nchw, nc, x}, {nchw}, {}, {}});
-    resCPUParams.push_back(CPUSpecificParams{{nhwc, nc, x}, {nhwc}, {}, {}});
+    resCPUParams.push_back(CPUSpecificParams{{nchw, nc, x}, {nchw}, {}, "ref"});
+    resCPUParams.push_back(CPUSpecificParams{{nhwc, nc, x}, {nhwc}, {}, getJitType()});
     if (with_cpu_x86_avx512f()) {
-        resCPUParams.push_back(CPUSpecificParams{{nChw16c, nc, x}, {nChw16c}, {}, {}});
+        resCPUParams.push_back(CPUSpecificParams{{nChw16c, nc, x}, {nChw16c}, {}, getJitType()});
     } else if (with_cpu_x86_avx2() || with_cpu_x86_sse42()) {
-        resCPUParams.push_back(CPUSpecificParams{{nChw8c, nc, x}, {nChw8c}, {}, {}});
+        resCPUParams.push_back(CPUSpecificParams{{nChw8c, nc, x}, {nChw8c}, {}, getJitType()});
     }
     return resCPUParams;
 }
@@ -0,0 +1,58 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+// Convolution with a fused activation, so both the transformations and the graph optimizations change the nodes
+class CompileProfileTest : public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto inputParams = builder::makeParams(element::f32, {{1, 8, 16, 16}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto conv = builder::makeConvolution(paramOuts[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 16);
+        auto relu = builder::makeActivation(conv, element::f32, helpers::ActivationTypes::Relu);
+
+        function = std::make_shared<Function>(NodeVector{relu}, inputParams, "CompileProfile");
+    }
+};
+
+TEST_F(CompileProfileTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration.insert({InferenceEngine::PluginConfigParams::KEY_CPU_COMPILE_PROFILE_NODE_COUNTS,
+                          InferenceEngine::PluginConfigParams::YES});
+    Run();
+
+    std::vector<std::string> metrics = executableNetwork.GetMetric(METRIC_KEY(SUPPORTED_METRICS));
+    ASSERT_NE(metrics.end(), std::find(metrics.begin(), metrics.end(), METRIC_KEY(COMPILE_PROFILE)));
+
+    const auto profile = executableNetwork.GetMetric(METRIC_KEY(COMPILE_PROFILE)).as<std::string>();
+    ASSERT_NE(std::string::npos, profile.find("\"traceEvents\""));
+    ASSERT_NE(std::string::npos, profile.find("{\"name\":\"Transformation\",\"cat\":\"stage\""));
+    ASSERT_NE(std::string::npos, profile.find("\"cat\":\"pass\""));
+    ASSERT_NE(std::string::npos, profile.find("{\"name\":\"MKLDNNGraph::CreateGraph\",\"cat\":\"graph\""));
+    ASSERT_NE(std::string::npos, profile.find("\"nodes_created\":"));
+}
+
+TEST_F(CompileProfileTest, smoke_CompareWithRefs_NoNodeCounts) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    const auto profile = executableNetwork.GetMetric(METRIC_KEY(COMPILE_PROFILE)).as<std::string>();
+    ASSERT_NE(std::string::npos, profile.find("\"cat\":\"pass\""));
+    ASSERT_EQ(std::string::npos, profile.find("\"nodes_before\":"));
+    ASSERT_EQ(std::string::npos, profile.find("\"nodes_created\":"));
+}
+
+} // namespace SubgraphTestsDefinitions
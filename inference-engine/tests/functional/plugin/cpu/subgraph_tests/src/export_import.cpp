@@ -0,0 +1,78 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "base/import_export_base/import_export_base.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+// Convolution with a fused activation. The network is exported after the transformations
+class ExportImportConvolutionTest : public FuncTestUtils::ImportNetworkTestBase {
+protected:
+    void SetUp() override {
+        InferenceEngine::Precision netPrecision;
+        std::tie(netPrecision, targetDevice, exportConfiguration, importConfiguration, applicationHeader) = GetParam();
+        const auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+
+        auto params = builder::makeParams(ngPrc, {{1, 8, 16, 16}});
+        auto conv = builder::makeConvolution(params[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 16);
+        auto relu = builder::makeActivation(conv, ngPrc, helpers::ActivationTypes::Relu);
+
+        function = std::make_shared<Function>(NodeVector{relu}, params, "ExportImportConvolution");
+    }
+};
+
+// Quantized convolution. LPT produces the operations with relaxed precisions, so the original network is exported
+// and the transformations are applied again on import
+class ExportImportQuantizedConvolutionTest : public FuncTestUtils::ImportNetworkTestBase {
+protected:
+    void SetUp() override {
+        InferenceEngine::Precision netPrecision;
+        std::tie(netPrecision, targetDevice, exportConfiguration, importConfiguration, applicationHeader) = GetParam();
+        const auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+
+        auto params = builder::makeParams(ngPrc, {{1, 8, 16, 16}});
+        auto dataFq = builder::makeFakeQuantize(params[0], ngPrc, 256, {}, {0.f}, {2.55f}, {0.f}, {2.55f});
+
+        auto weights = builder::makeConstant<float>(ngPrc, {16, 8, 3, 3}, {}, true, 1.f, -1.f);
+        auto weightsFq = builder::makeFakeQuantize(weights, ngPrc, 255, {16, 1, 1, 1},
+                                                   std::vector<float>(16, -1.27f), std::vector<float>(16, 1.27f),
+                                                   std::vector<float>(16, -1.27f), std::vector<float>(16, 1.27f));
+
+        auto conv = std::make_shared<opset1::Convolution>(dataFq, weightsFq, Strides{1, 1}, CoordinateDiff{1, 1},
+                                                          CoordinateDiff{1, 1}, Strides{1, 1});
+        auto relu = builder::makeActivation(conv, ngPrc, helpers::ActivationTypes::Relu);
+
+        function = std::make_shared<Function>(NodeVector{relu}, params, "ExportImportQuantizedConvolution");
+    }
+};
+
+TEST_P(ExportImportConvolutionTest, CompareWithRefImpl) {
+    Run();
+}
+
+TEST_P(ExportImportQuantizedConvolutionTest, CompareWithRefImpl) {
+    Run();
+}
+
+namespace {
+
+const auto exportImportParams = ::testing::Combine(
+        ::testing::Values(InferenceEngine::Precision::FP32),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU),
+        ::testing::Values(std::map<std::string, std::string>{}),
+        ::testing::Values(std::map<std::string, std::string>{}),
+        ::testing::Values("", "APPLICATION_HEADER"));
+
+INSTANTIATE_TEST_SUITE_P(smoke_ExportImport, ExportImportConvolutionTest, exportImportParams,
+                         ExportImportConvolutionTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_ExportImport, ExportImportQuantizedConvolutionTest, exportImportParams,
+                         ExportImportQuantizedConvolutionTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
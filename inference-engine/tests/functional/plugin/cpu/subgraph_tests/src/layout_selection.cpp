@@ -0,0 +1,95 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+size_t countReorders(InferenceEngine::ExecutableNetwork& execNet) {
+    auto function = execNet.GetExecGraphInfo().getFunction();
+    IE_ASSERT(nullptr != function);
+    size_t reorders = 0;
+    for (const auto& node : function->get_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+        IE_ASSERT(rtInfo.end() != it);
+        auto layerType = std::dynamic_pointer_cast<VariantImpl<std::string>>(it->second);
+        IE_ASSERT(nullptr != layerType);
+        if (layerType->get() == "Reorder")
+            reorders++;
+    }
+    return reorders;
+}
+}  // namespace
+
+// Blocked convolutions interleaved with layout agnostic operations and a branch point,
+// so the layouts are selected for the whole chains rather than for every node
+class LayoutSelectionTest : public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto inputParams = builder::makeParams(element::f32, {{1, 16, 20, 20}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto makeConv = [](const Output<Node>& in, size_t outChannels) {
+            return builder::makeConvolution(in, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                            op::PadType::EXPLICIT, outChannels);
+        };
+        auto makePooling = [](const Output<Node>& in) {
+            return builder::makePooling(in, {1, 1}, {1, 1}, {1, 1}, {3, 3}, op::RoundingType::FLOOR,
+                                        op::PadType::EXPLICIT, false, helpers::PoolingTypes::MAX);
+        };
+
+        auto conv = makeConv(paramOuts[0], 16);
+        auto pooling = makePooling(conv);
+        auto clamp = builder::makeActivation(pooling, element::f32, helpers::ActivationTypes::Clamp, {}, {0, 6});
+        auto depthToSpace = std::make_shared<opset1::DepthToSpace>(clamp, opset1::DepthToSpace::DepthToSpaceMode::BLOCKS_FIRST, 2);
+        auto left = makeConv(depthToSpace, 16);
+        auto right = makeConv(makePooling(depthToSpace), 16);
+        auto add = std::make_shared<opset1::Add>(left, right);
+
+        function = std::make_shared<Function>(NodeVector{add}, inputParams, "LayoutSelection");
+    }
+};
+
+TEST_F(LayoutSelectionTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    std::vector<std::string> metrics = executableNetwork.GetMetric(METRIC_KEY(SUPPORTED_METRICS));
+    ASSERT_NE(metrics.end(), std::find(metrics.begin(), metrics.end(), METRIC_KEY(CPU_ESTIMATED_AVOIDED_REORDERS)));
+    ASSERT_NO_THROW(executableNetwork.GetMetric(METRIC_KEY(CPU_ESTIMATED_AVOIDED_REORDERS)).as<unsigned int>());
+}
+
+TEST_F(LayoutSelectionTest, smoke_CompareWithRefs_LayoutOptimizationDisabled) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration.insert({InferenceEngine::PluginConfigParams::KEY_CPU_LAYOUT_OPTIMIZATION,
+                          InferenceEngine::PluginConfigParams::NO});
+    Run();
+
+    ASSERT_EQ(0, executableNetwork.GetMetric(METRIC_KEY(CPU_ESTIMATED_AVOIDED_REORDERS)).as<unsigned int>());
+}
+
+TEST_F(LayoutSelectionTest, smoke_LayoutOptimizationReducesReorders) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    const auto optimizedReorders = countReorders(executableNetwork);
+
+    auto config = configuration;
+    config[InferenceEngine::PluginConfigParams::KEY_CPU_LAYOUT_OPTIMIZATION] = InferenceEngine::PluginConfigParams::NO;
+    auto localNetwork = getCore()->LoadNetwork(cnnNetwork, targetDevice, config);
+    const auto localReorders = countReorders(localNetwork);
+
+    ASSERT_LT(optimizedReorders, localReorders);
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,43 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "configuration_tests/dynamic_batch.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+// Batched MatMul inferred with the dynamic batch below the maximum one: the first MatMul broadcasts its second input
+// along the batch, the second one limits the batch of both inputs
+class MatMulDynamicBatchTest : public ConfigurationTestsDefinitions::DynamicBatchTest {
+protected:
+    void SetUp() override {
+        DynamicBatchTest::SetUp();
+
+        auto inputParams = builder::makeParams(element::f32, {{1, 2, 4, 8}, {1, 2, 16, 4}});
+        auto weights = builder::makeConstant<float>(element::f32, {1, 1, 8, 16}, {}, true);
+        auto matMul = std::make_shared<opset1::MatMul>(inputParams[0], weights);
+        auto relu = builder::makeActivation(matMul, element::f32, helpers::ActivationTypes::Relu);
+        auto secondMatMul = std::make_shared<opset1::MatMul>(relu, inputParams[1]);
+
+        function = std::make_shared<Function>(NodeVector{secondMatMul}, inputParams, "MatMulDynamicBatch");
+    }
+};
+
+TEST_P(MatMulDynamicBatchTest, CompareWithRefs) {
+    Run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulDynamicBatch, MatMulDynamicBatchTest,
+    ::testing::Combine(
+        ::testing::Values(CommonTestUtils::DEVICE_CPU),
+        ::testing::Values(InferenceEngine::Precision::FP32),
+        ::testing::Values(std::vector<size_t>{1, 3, 8}),
+        ::testing::Values(false),
+        ::testing::Values(std::map<std::string, std::string>{})),
+    MatMulDynamicBatchTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,69 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+// Inception-like block: independent branches are joined by Concat, intermediate tensors are reused by MemorySolver
+class ParallelBranchesTest : public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({InferenceEngine::PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES,
+                              InferenceEngine::PluginConfigParams::YES});
+
+        auto inputParams = builder::makeParams(element::f32, {{1, 16, 20, 20}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto makeConv = [](const Output<Node>& in, size_t kernel, size_t outChannels) {
+            const ptrdiff_t pad = static_cast<ptrdiff_t>(kernel / 2);
+            return builder::makeConvolution(in, element::f32, {kernel, kernel}, {1, 1}, {pad, pad}, {pad, pad}, {1, 1},
+                                            op::PadType::EXPLICIT, outChannels);
+        };
+
+        std::shared_ptr<Node> pooling = builder::makePooling(paramOuts[0], {1, 1}, {1, 1}, {1, 1}, {3, 3},
+                                                             op::RoundingType::FLOOR, op::PadType::EXPLICIT, false,
+                                                             helpers::PoolingTypes::MAX);
+
+        NodeVector branches {
+            makeConv(paramOuts[0], 1, 8),
+            makeConv(makeConv(paramOuts[0], 1, 8), 3, 8),
+            makeConv(makeConv(makeConv(paramOuts[0], 1, 8), 3, 8), 3, 8),
+            makeConv(pooling, 1, 8)
+        };
+        auto concat = std::make_shared<opset1::Concat>(branches, 1);
+        auto relu = builder::makeActivation(concat, element::f32, helpers::ActivationTypes::Relu);
+        auto secondConcat = std::make_shared<opset1::Concat>(NodeVector{makeConv(relu, 1, 8), makeConv(relu, 3, 8)}, 1);
+
+        function = std::make_shared<Function>(NodeVector{secondConcat}, inputParams, "ParallelBranches");
+    }
+};
+
+TEST_F(ParallelBranchesTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+TEST_F(ParallelBranchesTest, smoke_CriticalPathIsShorterThanNodesTime) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    using namespace InferenceEngine;
+    configuration.insert({PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES});
+    Run();
+
+    const auto nodesTime = executableNetwork.GetMetric(METRIC_KEY(CPU_PARALLEL_NODES_TIME_US)).as<unsigned int>();
+    const auto criticalPath = executableNetwork.GetMetric(METRIC_KEY(CPU_PARALLEL_CRITICAL_PATH_US)).as<unsigned int>();
+    if (nodesTime == 0)
+        GTEST_SKIP() << "Graph branches are executed in parallel only with TBB threading";
+    // the branches do not depend on each other, so the longest path skips the nodes of the other branches
+    EXPECT_GT(criticalPath, 0);
+    EXPECT_LT(criticalPath, nodesTime);
+}
+
+} // namespace SubgraphTestsDefinitions
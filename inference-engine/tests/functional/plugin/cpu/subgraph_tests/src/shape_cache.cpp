@@ -0,0 +1,143 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <blob_factory.hpp>
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+// Sequences of different lengths are inferred by one executable network with the shape cache of two graphs
+class ShapeCacheTest : public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({InferenceEngine::PluginConfigParams::KEY_CPU_SHAPE_CACHE_CAPACITY, "2"});
+
+        auto inputParams = builder::makeParams(element::f32, {{1, 8, 16}});
+        auto relu = builder::makeActivation(inputParams[0], element::f32, helpers::ActivationTypes::Relu);
+        auto scale = opset1::Constant::create(element::f32, {1}, {2.0f});
+        auto multiply = std::make_shared<opset1::Multiply>(relu, scale);
+
+        function = std::make_shared<Function>(NodeVector{multiply}, inputParams, "ShapeCache");
+    }
+
+    static InferenceEngine::Blob::Ptr makeBlob(size_t length) {
+        auto blob = make_blob_with_precision(InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32,
+                                                                         {1, length, 16}, InferenceEngine::Layout::CHW));
+        blob->allocate();
+        return blob;
+    }
+
+    static void fillInput(const InferenceEngine::Blob::Ptr& input, float shift) {
+        auto inputData = input->buffer().as<float*>();
+        for (size_t i = 0; i < input->size(); i++)
+            inputData[i] = static_cast<float>(i % 7) - shift;
+    }
+
+    static void checkOutput(const InferenceEngine::Blob::Ptr& input, const InferenceEngine::Blob::Ptr& output) {
+        ASSERT_EQ(input->getTensorDesc().getDims(), output->getTensorDesc().getDims());
+        auto inputData = input->cbuffer().as<const float*>();
+        auto outputData = output->cbuffer().as<const float*>();
+        for (size_t i = 0; i < output->size(); i++)
+            ASSERT_EQ(std::max(inputData[i], 0.0f) * 2.0f, outputData[i]) << "element " << i;
+    }
+};
+
+TEST_F(ShapeCacheTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+    auto request = executableNetwork.CreateInferRequest();
+
+    // 12 is evicted by 20, so it is compiled twice
+    for (size_t length : {4, 12, 4, 20, 12}) {
+        const InferenceEngine::SizeVector dims = {1, length, 16};
+        auto input = make_blob_with_precision(InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, dims,
+                                                                          InferenceEngine::Layout::CHW));
+        input->allocate();
+        auto inputData = input->buffer().as<float*>();
+        for (size_t i = 0; i < input->size(); i++)
+            inputData[i] = static_cast<float>(i % 7) - 3.0f;
+
+        request.SetBlob(inputName, input);
+        request.Infer();
+
+        auto output = request.GetBlob(outputName);
+        ASSERT_EQ(dims, output->getTensorDesc().getDims());
+        auto outputData = output->cbuffer().as<const float*>();
+        for (size_t i = 0; i < output->size(); i++)
+            ASSERT_EQ(std::max(inputData[i], 0.0f) * 2.0f, outputData[i]) << "length " << length << ", element " << i;
+    }
+
+    ASSERT_EQ(1u, executableNetwork.GetMetric(METRIC_KEY(CPU_SHAPE_CACHE_HITS)).as<unsigned int>());
+    ASSERT_EQ(4u, executableNetwork.GetMetric(METRIC_KEY(CPU_SHAPE_CACHE_MISSES)).as<unsigned int>());
+    ASSERT_LT(0.0f, executableNetwork.GetMetric(METRIC_KEY(CPU_SHAPE_CACHE_COMPILE_TIME_MS)).as<float>());
+}
+
+TEST_F(ShapeCacheTest, smoke_UserOutputBlobMustMatchShape) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+    auto request = executableNetwork.CreateInferRequest();
+
+    // the user blobs of the network shapes and of the new ones are filled in place
+    for (size_t length : {8, 4, 8}) {
+        auto input = makeBlob(length);
+        auto output = makeBlob(length);
+        fillInput(input, 3.0f);
+        request.SetBlob(inputName, input);
+        request.SetBlob(outputName, output);
+        request.Infer();
+        checkOutput(input, output);
+        ASSERT_EQ(output, request.GetBlob(outputName));
+    }
+
+    // the output blob set by the user is not replaced by a blob of the shape produced by the inference
+    auto input = makeBlob(4);
+    fillInput(input, 3.0f);
+    request.SetBlob(inputName, input);
+    request.SetBlob(outputName, makeBlob(8));
+    ASSERT_THROW(request.Infer(), InferenceEngine::ParameterMismatch);
+}
+
+TEST_F(ShapeCacheTest, smoke_ConcurrentRequestsWithNewShapes) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration.insert({InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"});
+    LoadNetwork();
+    const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+
+    // the requests run on both streams at once, each with its own sequence of shapes, 8 is the network shape
+    const std::vector<std::vector<size_t>> lengths = {{8, 4, 12, 8}, {4, 8, 4, 12}, {12, 12, 8, 4}, {8, 20, 8, 20}};
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (size_t r = 0; r < lengths.size(); r++)
+        requests.push_back(executableNetwork.CreateInferRequest());
+
+    for (size_t step = 0; step < lengths.front().size(); step++) {
+        std::vector<InferenceEngine::Blob::Ptr> inputs;
+        for (size_t r = 0; r < requests.size(); r++) {
+            inputs.push_back(makeBlob(lengths[r][step]));
+            fillInput(inputs.back(), static_cast<float>(r + step));
+            requests[r].SetBlob(inputName, inputs.back());
+            requests[r].StartAsync();
+        }
+        for (size_t r = 0; r < requests.size(); r++) {
+            ASSERT_EQ(InferenceEngine::StatusCode::OK,
+                      requests[r].Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY));
+            checkOutput(inputs[r], requests[r].GetBlob(outputName));
+        }
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
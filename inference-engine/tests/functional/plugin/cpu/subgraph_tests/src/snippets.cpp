@@ -0,0 +1,44 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+// A chain of elementwise operations with a broadcasted input is collapsed into a single Subgraph node
+// and executed by the code generated for the chain
+class SnippetsTest : public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_SNIPPETS_MODE,
+                              InferenceEngine::PluginConfigParams::YES});
+
+        auto inputParams = builder::makeParams(element::f32, {{1, 16, 10, 10}, {1, 16, 1, 10}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto add = std::make_shared<opset1::Add>(paramOuts[0], paramOuts[1]);
+        auto abs = std::make_shared<opset1::Abs>(add);
+        auto mul = std::make_shared<opset1::Multiply>(abs, paramOuts[0]);
+        auto sub = std::make_shared<opset1::Subtract>(mul, add);
+        auto pooling = builder::makePooling(sub, {1, 1}, {0, 0}, {0, 0}, {2, 2}, op::RoundingType::FLOOR,
+                                            op::PadType::EXPLICIT, false, helpers::PoolingTypes::MAX);
+
+        function = std::make_shared<Function>(NodeVector{pooling}, inputParams, "Snippets");
+    }
+};
+
+TEST_F(SnippetsTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CPUTestUtils::CheckNodeOfTypeCount(executableNetwork, "Subgraph", 1);
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,98 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/opsets/opset6.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+// Two accumulators kept in variable states: a += x and b += 2 * x. The states are read and written by the graph
+// in place through swapped buffers, so every inference has to see the value written by the previous one
+class VariableStatesTest : public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto inputParams = builder::makeParams(element::f32, {{1, 8}});
+        auto makeAccumulator = [&](const std::string& id, const Output<Node>& increment) {
+            auto variable = std::make_shared<Variable>(VariableInfo{PartialShape::dynamic(), element::dynamic, id});
+            auto readValue = std::make_shared<opset6::ReadValue>(inputParams[0], variable);
+            auto sum = std::make_shared<opset6::Add>(readValue, increment);
+            sum->set_friendly_name("sum_" + id);
+            return std::make_pair(sum, std::make_shared<opset6::Assign>(sum, variable));
+        };
+
+        auto a = makeAccumulator("a", inputParams[0]);
+        auto two = opset6::Constant::create(element::f32, {1}, {2.f});
+        auto b = makeAccumulator("b", std::make_shared<opset6::Multiply>(inputParams[0], two));
+
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset6::Result>(a.first),
+                                                           std::make_shared<opset6::Result>(b.first)},
+                                              SinkVector{a.second, b.second}, inputParams, "VariableStates");
+    }
+
+    // runs the inference with the input of ones and checks the outputs and the states after it
+    void inferAndCheck(InferenceEngine::InferRequest& request, float expected) {
+        auto input = request.GetBlob(cnnNetwork.getInputsInfo().begin()->first);
+        auto inputData = input->buffer().as<float*>();
+        std::fill(inputData, inputData + input->size(), 1.f);
+
+        request.Infer();
+
+        const std::map<std::string, float> expectedValues = {{"a", expected}, {"b", 2 * expected}};
+        for (const auto& value : expectedValues) {
+            auto output = request.GetBlob("sum_" + value.first);
+            auto outputData = output->cbuffer().as<const float*>();
+            for (size_t i = 0; i < output->size(); i++)
+                ASSERT_EQ(value.second, outputData[i]) << "output of " << value.first;
+        }
+
+        auto states = request.QueryState();
+        ASSERT_EQ(expectedValues.size(), states.size());
+        for (auto&& state : states) {
+            auto value = expectedValues.find(state.GetName());
+            ASSERT_NE(expectedValues.end(), value) << "unexpected state " << state.GetName();
+            auto stateBlob = state.GetState();
+            auto stateData = stateBlob->cbuffer().as<const float*>();
+            for (size_t i = 0; i < stateBlob->size(); i++)
+                ASSERT_EQ(value->second, stateData[i]) << "state " << value->first;
+        }
+    }
+};
+
+TEST_F(VariableStatesTest, smoke_StatesAccumulateAcrossInferences) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    auto request = executableNetwork.CreateInferRequest();
+    for (int i = 1; i <= 5; i++)
+        inferAndCheck(request, static_cast<float>(i));
+
+    // the reset state is visible to the next inference
+    for (auto&& state : request.QueryState())
+        state.Reset();
+    inferAndCheck(request, 1.f);
+}
+
+TEST_F(VariableStatesTest, smoke_StatesOfRequestsAreIndependent) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration.insert({InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"});
+    LoadNetwork();
+    auto first = executableNetwork.CreateInferRequest();
+    auto second = executableNetwork.CreateInferRequest();
+    // the second request falls behind the first one, so a state shared between the requests or the stream graphs
+    // is caught
+    float firstCount = 0.f, secondCount = 0.f;
+    for (int i = 0; i < 3; i++) {
+        inferAndCheck(first, ++firstCount);
+        inferAndCheck(first, ++firstCount);
+        inferAndCheck(second, ++secondCount);
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
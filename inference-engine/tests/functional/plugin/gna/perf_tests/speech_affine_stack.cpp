@@ -0,0 +1,61 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <ie_core.hpp>
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+namespace LayerTestsDefinitions {
+
+// Affine stack of a speech recognition model: 440 features, 5 hidden layers of 1024 with sigmoid, batch of 8 frames,
+// inferred by the float software mode. The suite is a benchmark of the GNA float runtime, it is disabled and run on
+// demand: --gtest_also_run_disabled_tests --gtest_filter=*SpeechAffineStackPerfTest* --gtest_output=xml
+// The average inference time is reported as a property of the test case in the XML report.
+class SpeechAffineStackPerfTest : public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_GNA;
+        configuration = {{"GNA_DEVICE_MODE", "GNA_SW_FP32"}, {"GNA_COMPACT_MODE", "NO"}};
+
+        const size_t batch = 8, features = 440, hidden = 1024, layers = 5;
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{batch, features}});
+        std::shared_ptr<ngraph::Node> layer = params[0];
+        for (size_t i = 0; i < layers; i++) {
+            const size_t inputSize = i == 0 ? features : hidden;
+            auto weights = CommonTestUtils::generate_float_numbers(inputSize * hidden, -0.05f, 0.05f);
+            auto biases = CommonTestUtils::generate_float_numbers(1, -0.05f, 0.05f);
+            auto affine = ngraph::builder::makeFullyConnected(layer, ngraph::element::f32, hidden, true,
+                                                              {inputSize, hidden}, weights, biases);
+            layer = ngraph::builder::makeActivation(affine, ngraph::element::f32,
+                                                    ngraph::helpers::ActivationTypes::Sigmoid);
+        }
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{layer}, params, "SpeechAffineStack");
+    }
+};
+
+TEST_F(SpeechAffineStackPerfTest, DISABLED_inferenceTime) {
+    // checks the results against the reference and leaves the request with the inputs set
+    Run();
+
+    const int iterations = 100;
+    inferRequest.Infer();
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+        inferRequest.Infer();
+    const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    const double averageUs = elapsed.count() / iterations;
+
+    RecordProperty("inference_time_us", static_cast<int>(averageUs));
+    std::cout << "[ INFO ] speech model affine stack: " << averageUs << " us per inference" << std::endl;
+}
+
+}  // namespace LayerTestsDefinitions
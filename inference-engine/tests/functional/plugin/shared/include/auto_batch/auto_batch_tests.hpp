@@ -0,0 +1,147 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "ie_core.hpp"
+#include "auto_batch/auto_batch_config.hpp"
+#include "common_test_utils/test_common.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+// device name and batch size
+using AutoBatchParams = std::tuple<std::string, size_t>;
+
+class AutoBatching_Test : public CommonTestUtils::TestsCommon, public testing::WithParamInterface<AutoBatchParams> {
+    void SetUp() override {
+        std::tie(device_name, batch) = this->GetParam();
+        fn_ptr = ngraph::builder::subgraph::makeConvPoolRelu({1, 3, 24, 24});
+    }
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<AutoBatchParams> &obj) {
+        return "device_name_" + std::get<0>(obj.param) + "_batch_" + std::to_string(std::get<1>(obj.param));
+    }
+protected:
+    std::string batchDeviceName() const {
+        return "BATCH:" + device_name + "(" + std::to_string(batch) + ")";
+    }
+
+    std::vector<InferenceEngine::InferRequest> createRequests(InferenceEngine::ExecutableNetwork& exec_net,
+                                                              size_t numRequests, int seed) {
+        const auto inputName = exec_net.GetInputsInfo().begin()->first;
+        std::vector<InferenceEngine::InferRequest> requests;
+        for (size_t i = 0; i < numRequests; i++) {
+            requests.push_back(exec_net.CreateInferRequest());
+            auto input = requests.back().GetBlob(inputName);
+            auto data = FuncTestUtils::createAndFillBlob(input->getTensorDesc(), 10, 0, 1, seed + static_cast<int>(i));
+            // half of the requests use the blobs set by the application, the rest fill the blobs of the request
+            if (i % 2)
+                requests.back().SetBlob(inputName, data);
+            else
+                std::memcpy(input->buffer(), data->cbuffer(), data->byteSize());
+        }
+        return requests;
+    }
+
+    // runs the requests concurrently and checks every result against the inference on the device itself
+    void inferAndCompare(std::vector<InferenceEngine::InferRequest>& requests, InferenceEngine::ExecutableNetwork& ref_net) {
+        const auto inputName = ref_net.GetInputsInfo().begin()->first;
+        const auto outputName = ref_net.GetOutputsInfo().begin()->first;
+        for (auto&& request : requests)
+            ASSERT_NO_THROW(request.StartAsync());
+        // the bounded wait fails the test instead of hanging if the batch of a request is never started
+        for (auto&& request : requests)
+            ASSERT_EQ(request.Wait(60000), InferenceEngine::StatusCode::OK);
+
+        auto ref_request = ref_net.CreateInferRequest();
+        for (auto&& request : requests) {
+            ref_request.SetBlob(inputName, request.GetBlob(inputName));
+            ref_request.Infer();
+            FuncTestUtils::compareBlobs(request.GetBlob(outputName), ref_request.GetBlob(outputName));
+        }
+    }
+
+    void inferAndCompare(InferenceEngine::ExecutableNetwork& exec_net, InferenceEngine::ExecutableNetwork& ref_net,
+                         size_t numRequests, int seed) {
+        auto requests = createRequests(exec_net, numRequests, seed);
+        inferAndCompare(requests, ref_net);
+    }
+
+    std::string device_name;
+    size_t batch;
+    std::shared_ptr<ngraph::Function> fn_ptr;
+};
+
+TEST_P(AutoBatching_Test, fullBatchesAreInferredTogether) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+
+    // the timeout is far longer than the test, so only the full batches are executed
+    auto exec_net = ie->LoadNetwork(net, batchDeviceName(), {{AUTO_BATCH_CONFIG_KEY(TIMEOUT), "100000"}});
+    auto ref_net = ie->LoadNetwork(net, device_name);
+    inferAndCompare(exec_net, ref_net, 2 * batch, 1);
+
+    std::map<unsigned int, uint64_t> distribution;
+    ASSERT_NO_THROW(distribution = exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_SIZE_DISTRIBUTION))
+                                       .as<std::map<unsigned int, uint64_t>>());
+    ASSERT_EQ(distribution.size(), 1);
+    ASSERT_EQ(distribution[batch], 2);
+}
+
+TEST_P(AutoBatching_Test, requestsCreatedForDifferentBatchesAreInferredTogether) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+
+    auto exec_net = ie->LoadNetwork(net, batchDeviceName(), {{AUTO_BATCH_CONFIG_KEY(TIMEOUT), "100000"}});
+    auto ref_net = ie->LoadNetwork(net, device_name);
+    // every other request of the two batches' worth of the created ones is started, so the started requests
+    // belong to different batches by the creation order, but they still take the slots of the same batch
+    auto created = createRequests(exec_net, 2 * batch, 200);
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (size_t i = 0; i < created.size(); i += 2)
+        requests.push_back(created[i]);
+    inferAndCompare(requests, ref_net);
+
+    std::map<unsigned int, uint64_t> distribution;
+    ASSERT_NO_THROW(distribution = exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_SIZE_DISTRIBUTION))
+                                       .as<std::map<unsigned int, uint64_t>>());
+    ASSERT_EQ(distribution.size(), 1);
+    ASSERT_EQ(distribution[batch], 1);
+}
+
+TEST_P(AutoBatching_Test, partialBatchIsInferredAfterTimeout) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+
+    auto exec_net = ie->LoadNetwork(net, batchDeviceName(), {{AUTO_BATCH_CONFIG_KEY(TIMEOUT), "1"}});
+    auto ref_net = ie->LoadNetwork(net, device_name);
+    inferAndCompare(exec_net, ref_net, batch + 1, 100);
+
+    std::map<unsigned int, uint64_t> distribution;
+    ASSERT_NO_THROW(distribution = exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_SIZE_DISTRIBUTION))
+                                       .as<std::map<unsigned int, uint64_t>>());
+    uint64_t inferred = 0;
+    for (auto&& count : distribution)
+        inferred += count.first * count.second;
+    ASSERT_EQ(inferred, batch + 1);
+
+    std::map<std::string, float> latency;
+    ASSERT_NO_THROW(latency = exec_net.GetMetric(METRIC_KEY(AUTO_BATCH_QUEUE_LATENCY))
+                                  .as<std::map<std::string, float>>());
+    ASSERT_EQ(latency.count("AVERAGE"), 1);
+    ASSERT_GE(latency["MAX"], latency["AVERAGE"]);
+    // at least the request of the second batch waited for the timeout
+    ASSERT_GE(latency["MAX"], 1.f);
+}
+
+TEST_P(AutoBatching_Test, wrongTimeoutIsRejected) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+    ASSERT_THROW(ie->LoadNetwork(net, batchDeviceName(), {{AUTO_BATCH_CONFIG_KEY(TIMEOUT), "-1"}}),
+                 InferenceEngine::Exception);
+}
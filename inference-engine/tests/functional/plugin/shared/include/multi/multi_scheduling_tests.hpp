@@ -0,0 +1,106 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "ie_core.hpp"
+#include "multi-device/multi_device_config.hpp"
+#include "base/multi/multi_helpers.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+
+TEST_P(MultiDevice_Test, throughputSchedulingDispatchesEveryInference) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+
+    auto exec_net = ie->LoadNetwork(net, device_names, {
+        {MULTI_CONFIG_KEY(SCHEDULING_POLICY), InferenceEngine::MultiDeviceConfigParams::MULTI_THROUGHPUT}});
+    ASSERT_EQ(exec_net.GetConfig(MULTI_CONFIG_KEY(SCHEDULING_POLICY)).as<std::string>(),
+              InferenceEngine::MultiDeviceConfigParams::MULTI_THROUGHPUT);
+
+    const size_t numRequests = 8, numIterations = 4;
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (size_t i = 0; i < numRequests; i++)
+        requests.push_back(exec_net.CreateInferRequest());
+    for (size_t iteration = 0; iteration < numIterations; iteration++) {
+        for (auto&& request : requests)
+            ASSERT_NO_THROW(request.StartAsync());
+        for (auto&& request : requests)
+            ASSERT_EQ(request.Wait(InferenceEngine::InferRequest::RESULT_READY), InferenceEngine::StatusCode::OK);
+    }
+
+    std::map<std::string, uint64_t> counts;
+    ASSERT_NO_THROW(counts = exec_net.GetMetric(METRIC_KEY(MULTI_DISPATCH_COUNTS)).as<std::map<std::string, uint64_t>>());
+    ASSERT_EQ(counts.size(), GetParam().size());
+    uint64_t total = 0;
+    for (auto&& count : counts)
+        total += count.second;
+    ASSERT_EQ(total, numRequests * numIterations);
+}
+
+TEST_P(MultiDevice_Test, wrongSchedulingPolicyIsRejected) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+    ASSERT_THROW(ie->LoadNetwork(net, device_names, {{MULTI_CONFIG_KEY(SCHEDULING_POLICY), "FASTEST"}}),
+                 InferenceEngine::Exception);
+}
+
+// devices of the MULTI and the one of them which infers the network much faster than the rest
+using MultiDeviceThroughputParams = std::tuple<DevicesNames, DeviceName>;
+
+class MultiDeviceThroughput_Test : public CommonTestUtils::TestsCommon,
+                                   public testing::WithParamInterface<MultiDeviceThroughputParams> {
+    void SetUp() override {
+        std::tie(devices, fastest_device) = this->GetParam();
+        device_names = getDeviceStringWithMulti(devices);
+        fn_ptr = ngraph::builder::subgraph::makeSplitMultiConvConcat();
+    }
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<MultiDeviceThroughputParams> &obj) {
+        auto s = getDeviceStringWithMulti(std::get<0>(obj.param));
+        std::replace(s.begin(), s.end(), ',', '_');
+        return "device_names_" + s + "_fastest_" + std::get<1>(obj.param);
+    }
+protected:
+    DevicesNames devices;
+    DeviceName fastest_device;
+    std::string device_names;
+    std::shared_ptr<ngraph::Function> fn_ptr;
+};
+
+TEST_P(MultiDeviceThroughput_Test, throughputSchedulingPrefersFasterDevice) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+    // the devices which are not built in the configuration are not tested, for example the TEMPLATE one
+    for (auto&& device : devices) {
+        try {
+            ie->GetVersions(device);
+        } catch (const InferenceEngine::Exception&) {
+            GTEST_SKIP() << device << " device is not available";
+        }
+    }
+
+    auto exec_net = ie->LoadNetwork(net, device_names, {
+        {MULTI_CONFIG_KEY(SCHEDULING_POLICY), InferenceEngine::MultiDeviceConfigParams::MULTI_THROUGHPUT}});
+    const size_t numRequests = 8, numIterations = 16;
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (size_t i = 0; i < numRequests; i++)
+        requests.push_back(exec_net.CreateInferRequest());
+    for (size_t iteration = 0; iteration < numIterations; iteration++) {
+        for (auto&& request : requests)
+            ASSERT_NO_THROW(request.StartAsync());
+        for (auto&& request : requests)
+            ASSERT_EQ(request.Wait(InferenceEngine::InferRequest::RESULT_READY), InferenceEngine::StatusCode::OK);
+    }
+
+    std::map<std::string, uint64_t> counts;
+    ASSERT_NO_THROW(counts = exec_net.GetMetric(METRIC_KEY(MULTI_DISPATCH_COUNTS)).as<std::map<std::string, uint64_t>>());
+    ASSERT_EQ(counts.size(), devices.size());
+    ASSERT_EQ(counts.count(fastest_device), 1);
+    for (auto&& count : counts) {
+        if (count.first != fastest_device)
+            EXPECT_GT(counts[fastest_device], count.second) << count.first;
+    }
+}
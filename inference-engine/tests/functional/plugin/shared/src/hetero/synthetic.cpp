@@ -5,6 +5,7 @@
 #include "hetero/synthetic.hpp"
 #include <ngraph/op/util/op_types.hpp>
 #include <ngraph/variant.hpp>
+#include <hetero/hetero_plugin_config.hpp>
 #include "ngraph_functions/builders.hpp"
 #include "ngraph_functions/subgraph_builders.hpp"
 #include <random>
@@ -149,4 +150,14 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     }
 }
 
+TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallbackPipelined) {
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    configuration[HETERO_CONFIG_KEY(PIPELINE)] = CONFIG_VALUE(YES);
+    Run();
+    if (!FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        ASSERT_NE(nullptr, cnnNetwork.getFunction());
+    }
+}
+
 }  //  namespace HeteroTests
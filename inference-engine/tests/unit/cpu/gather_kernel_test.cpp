@@ -0,0 +1,169 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "nodes/common/gather_kernel.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+struct GatherKernelParams {
+    size_t dataSize;
+    size_t sliceLen;
+    size_t idxStride;
+    size_t indexRange;
+    size_t workAmount;
+    bool elementwise;
+};
+
+std::string getTestCaseName(const testing::TestParamInfo<GatherKernelParams>& obj) {
+    const auto& p = obj.param;
+    return "dataSize" + std::to_string(p.dataSize) + "_sliceLen" + std::to_string(p.sliceLen) +
+           "_idxStride" + std::to_string(p.idxStride) + "_indexRange" + std::to_string(p.indexRange) +
+           "_workAmount" + std::to_string(p.workAmount) + (p.elementwise ? "_elementwise" : "");
+}
+
+void referenceGather(const GatherKernelParams& p, const uint8_t* src, const int32_t* indices, uint8_t* dst) {
+    const size_t sliceBytes = p.sliceLen * p.dataSize;
+    for (size_t j = 0; j < p.workAmount; j++) {
+        int64_t idx = indices[j] < 0 ? indices[j] + static_cast<int64_t>(p.indexRange) : indices[j];
+        if (idx < 0 || idx >= static_cast<int64_t>(p.indexRange)) {
+            std::memset(dst + j * sliceBytes, 0, sliceBytes);
+        } else {
+            const size_t offset = idx * p.idxStride + (p.elementwise ? j : 0);
+            std::memcpy(dst + j * sliceBytes, src + offset * p.dataSize, sliceBytes);
+        }
+    }
+}
+
+class GatherKernelTest : public testing::TestWithParam<GatherKernelParams> {
+protected:
+    void SetUp() override {
+        const auto& p = GetParam();
+        const size_t srcLen = p.indexRange * p.idxStride + (p.elementwise ? p.workAmount : p.sliceLen);
+        src.resize(srcLen * p.dataSize);
+        dst.resize(p.workAmount * p.sliceLen * p.dataSize, 0xFF);
+        ref.resize(dst.size());
+        indices.resize(p.workAmount);
+
+        std::mt19937 gen(42);
+        std::uniform_int_distribution<int> byte(0, 255);
+        for (auto& value : src)
+            value = static_cast<uint8_t>(byte(gen));
+        // negative values and values out of the range are included
+        const auto range = static_cast<int32_t>(p.indexRange);
+        std::uniform_int_distribution<int32_t> index(-range - 2, range + 1);
+        for (auto& value : indices)
+            value = index(gen);
+
+        kernel = std::make_shared<GatherKernel>(p.dataSize, p.sliceLen, p.idxStride, srcLen, p.elementwise);
+    }
+
+    std::vector<uint8_t> src;
+    std::vector<uint8_t> dst;
+    std::vector<uint8_t> ref;
+    std::vector<int32_t> indices;
+    std::shared_ptr<GatherKernel> kernel;
+};
+
+TEST_P(GatherKernelTest, matchesReference) {
+    const auto& p = GetParam();
+    kernel->execute(src.data(), indices.data(), dst.data(), p.workAmount, p.indexRange);
+    referenceGather(p, src.data(), indices.data(), ref.data());
+    ASSERT_EQ(ref, dst);
+}
+
+const std::vector<GatherKernelParams> gatherParams = {
+    // embedding lookups and short slices of dword elements
+    {4, 1, 1, 1000, 37, false},
+    {4, 2, 2, 100, 21, false},
+    {4, 4, 4, 100, 19, false},
+    {4, 8, 8, 100, 5, false},
+    {4, 3, 3, 100, 17, false},
+    {2, 1, 1, 100, 33, false},
+    {1, 4, 4, 100, 9, false},
+    // long slices
+    {4, 100, 100, 50, 11, false},
+    {4, 1000, 1000, 10, 7, false},
+    {1, 333, 333, 10, 5, false},
+    // GatherElements along the inner axis
+    {4, 1, 16, 10, 16, true},
+    {4, 1, 35, 10, 35, true},
+    {2, 1, 7, 10, 7, true},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_GatherKernel, GatherKernelTest, testing::ValuesIn(gatherParams), getTestCaseName);
+
+// Per shape comparison of the kernel with the copy of each slice by memcpy. The suite is a benchmark, it is disabled
+// and run on demand: --gtest_also_run_disabled_tests --gtest_filter=*GatherKernelPerfTest* --gtest_output=xml
+// The rates are reported as properties of the test cases in the XML report.
+using GatherKernelPerfParams = std::tuple<size_t, size_t, size_t>;  // data size, slice length, index range
+
+class GatherKernelPerfTest : public testing::TestWithParam<GatherKernelPerfParams> {};
+
+TEST_P(GatherKernelPerfTest, DISABLED_slicesPerSecond) {
+    size_t dataSize, sliceLen, indexRange;
+    std::tie(dataSize, sliceLen, indexRange) = GetParam();
+    const size_t sliceBytes = sliceLen * dataSize;
+    const size_t workAmount = 1 << 16;
+
+    std::vector<uint8_t> src(indexRange * sliceBytes);
+    std::vector<uint8_t> dst(workAmount * sliceBytes);
+    std::vector<uint8_t> ref(workAmount * sliceBytes);
+    std::vector<int32_t> indices(workAmount);
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> byte(0, 255);
+    for (auto& value : src)
+        value = static_cast<uint8_t>(byte(gen));
+    std::uniform_int_distribution<int32_t> index(0, static_cast<int32_t>(indexRange) - 1);
+    for (auto& value : indices)
+        value = index(gen);
+
+    GatherKernel kernel(dataSize, sliceLen, sliceLen, indexRange * sliceLen);
+    auto measure = [&](const std::function<void()>& gather) {
+        const size_t iterations = 10;
+        gather();
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++)
+            gather();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return static_cast<int>(iterations * workAmount / elapsed.count());
+    };
+
+    const auto kernelRate = measure([&] {
+        kernel.execute(src.data(), indices.data(), dst.data(), workAmount, indexRange);
+    });
+    const auto memcpyRate = measure([&] {
+        for (size_t j = 0; j < workAmount; j++)
+            std::memcpy(&ref[j * sliceBytes], &src[indices[j] * sliceBytes], sliceBytes);
+    });
+    ASSERT_EQ(ref, dst);
+
+    RecordProperty("kernel_slices_per_second", kernelRate);
+    RecordProperty("memcpy_slices_per_second", memcpyRate);
+    std::cout << "[ INFO ] data size " << dataSize << ", slice length " << sliceLen << ": kernel "
+              << kernelRate << " slices/s, memcpy " << memcpyRate << " slices/s" << std::endl;
+}
+
+INSTANTIATE_TEST_SUITE_P(GatherKernelPerf, GatherKernelPerfTest,
+                         testing::Values(std::make_tuple(4, 1, 100000),
+                                         std::make_tuple(4, 2, 50000),
+                                         std::make_tuple(4, 4, 25000),
+                                         std::make_tuple(4, 64, 10000),
+                                         std::make_tuple(4, 1024, 1000),
+                                         std::make_tuple(2, 1, 100000)));
+
+}  // namespace
@@ -0,0 +1,73 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "utils/lru_cache.hpp"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+TEST(LruCacheTest, evictsLeastRecentlyUsed) {
+    LruCache<std::string, int> cache(2);
+    int value = 0;
+
+    ASSERT_EQ(0, cache.put("a", 1));
+    ASSERT_EQ(0, cache.put("b", 2));
+    // "a" becomes the most recently used one
+    ASSERT_TRUE(cache.get("a", value));
+    ASSERT_EQ(1, value);
+
+    ASSERT_EQ(1, cache.put("c", 3));
+    ASSERT_EQ(2, cache.size());
+    ASSERT_FALSE(cache.get("b", value));
+    ASSERT_TRUE(cache.get("a", value));
+    ASSERT_TRUE(cache.get("c", value));
+    ASSERT_EQ(3, value);
+}
+
+TEST(LruCacheTest, replacesValueOfExistingKey) {
+    LruCache<std::string, int> cache(2);
+    int value = 0;
+
+    cache.put("a", 1);
+    cache.put("b", 2);
+    ASSERT_EQ(0, cache.put("a", 10));
+    ASSERT_EQ(2, cache.size());
+    // "b" is the least recently used one after the replacement of "a"
+    cache.put("c", 3);
+    ASSERT_FALSE(cache.get("b", value));
+    ASSERT_TRUE(cache.get("a", value));
+    ASSERT_EQ(10, value);
+}
+
+TEST(LruCacheTest, eraseAndClear) {
+    LruCache<std::string, int> cache(3);
+    int value = 0;
+
+    cache.put("a", 1);
+    cache.put("b", 2);
+    cache.erase("a");
+    cache.erase("missing");
+    ASSERT_EQ(1, cache.size());
+    ASSERT_FALSE(cache.get("a", value));
+
+    cache.clear();
+    ASSERT_EQ(0, cache.size());
+    ASSERT_FALSE(cache.get("b", value));
+}
+
+TEST(LruCacheTest, zeroCapacityKeepsNothing) {
+    LruCache<std::string, int> cache(0);
+    int value = 0;
+
+    ASSERT_EQ(0, cache.put("a", 1));
+    ASSERT_EQ(0, cache.size());
+    ASSERT_FALSE(cache.get("a", value));
+}
+
+}  // namespace
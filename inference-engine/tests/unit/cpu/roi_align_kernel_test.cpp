@@ -0,0 +1,108 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "nodes/common/roi_align_kernel.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+struct ROIAlignKernelParams {
+    Algorithm alg;
+    size_t channels;
+    size_t numSamples;
+};
+
+std::string getTestCaseName(const testing::TestParamInfo<ROIAlignKernelParams>& obj) {
+    const auto& p = obj.param;
+    return std::string(p.alg == Algorithm::ROIAlignMax ? "max" : "avg") + "_channels" + std::to_string(p.channels) +
+           "_numSamples" + std::to_string(p.numSamples);
+}
+
+// the source is a feature map of 10x10 points of the given channels stored one after another
+struct ROIAlignBin {
+    ROIAlignBin(size_t channels, size_t numSamples) {
+        const size_t points = 100;
+        src.resize(points * channels);
+        offsets.resize(4 * numSamples);
+        weights.resize(4 * numSamples);
+
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> value(-10.0f, 10.0f);
+        std::uniform_int_distribution<int32_t> point(0, points - 1);
+        std::uniform_real_distribution<float> weight(0.0f, 1.0f);
+        for (auto& v : src)
+            v = value(gen);
+        for (auto& o : offsets)
+            o = static_cast<int32_t>(point(gen) * channels * sizeof(float));
+        for (auto& w : weights)
+            w = weight(gen);
+    }
+
+    std::vector<float> src;
+    std::vector<int32_t> offsets;
+    std::vector<float> weights;
+};
+
+std::vector<float> referenceROIAlign(const ROIAlignKernelParams& p, const ROIAlignBin& bin) {
+    std::vector<float> dst(p.channels);
+    for (size_t c = 0; c < p.channels; c++) {
+        float pooled = 0.0f;
+        for (size_t s = 0; s < p.numSamples; s++) {
+            float sample = p.alg == Algorithm::ROIAlignMax ? -INFINITY : 0.0f;
+            for (size_t i = 4 * s; i < 4 * s + 4; i++) {
+                const float part = bin.weights[i] * bin.src[bin.offsets[i] / sizeof(float) + c];
+                sample = p.alg == Algorithm::ROIAlignMax ? std::max(sample, part) : sample + part;
+            }
+            pooled = p.alg == Algorithm::ROIAlignMax ? std::max(pooled, sample) : pooled + sample / p.numSamples;
+        }
+        dst[c] = pooled;
+    }
+    return dst;
+}
+
+class ROIAlignKernelTest : public testing::TestWithParam<ROIAlignKernelParams> {};
+
+TEST_P(ROIAlignKernelTest, matchesReference) {
+    const auto& p = GetParam();
+    ROIAlignBin bin(p.channels, p.numSamples);
+    std::vector<float> dst(p.channels + 1, 1000.0f);
+
+    ROIAlignKernel kernel(p.alg, Precision::FP32, Precision::FP32, p.channels);
+    kernel.execute(reinterpret_cast<const uint8_t*>(bin.src.data()), bin.offsets.data(), bin.weights.data(), p.numSamples,
+                   1.0f / p.numSamples, reinterpret_cast<uint8_t*>(dst.data()));
+
+    const auto ref = referenceROIAlign(p, bin);
+    for (size_t c = 0; c < p.channels; c++)
+        ASSERT_NEAR(ref[c], dst[c], 1e-4f * std::max(1.0f, std::fabs(ref[c]))) << "channel " << c;
+    // the kernel doesn't write after the last channel
+    ASSERT_EQ(1000.0f, dst[p.channels]);
+}
+
+const std::vector<ROIAlignKernelParams> roiAlignParams = {
+    // channel blocks of nChw8c and nChw16c
+    {Algorithm::ROIAlignAvg, 8, 4},
+    {Algorithm::ROIAlignAvg, 16, 4},
+    {Algorithm::ROIAlignMax, 8, 4},
+    {Algorithm::ROIAlignMax, 16, 9},
+    // all the channels of nhwc
+    {Algorithm::ROIAlignAvg, 3, 1},
+    {Algorithm::ROIAlignAvg, 35, 6},
+    {Algorithm::ROIAlignAvg, 256, 4},
+    {Algorithm::ROIAlignMax, 67, 2},
+    {Algorithm::ROIAlignMax, 256, 4},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ROIAlignKernel, ROIAlignKernelTest, testing::ValuesIn(roiAlignParams), getTestCaseName);
+
+}  // namespace
@@ -0,0 +1,334 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "runtime/cnn.h"
+#include "runtime/floatmath_gemm.hpp"
+#include "runtime/gna_float_runtime.hpp"
+
+using namespace GNAPluginNS::runtime;
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace ANY {
+// the baseline build of the kernel, XARCH::sgemm_nt dispatches to the AVX2/FMA one on the hosts which support it
+void sgemm_nt(const uint32_t M, const uint32_t N, const uint32_t K,
+              const float* A, const uint32_t lda,
+              const float* B, const uint32_t ldb,
+              float* C, const uint32_t ldc);
+}  // namespace ANY
+}  // namespace runtime
+}  // namespace GNAPluginNS
+
+namespace {
+
+using Sgemm = decltype(&XARCH::sgemm_nt);
+
+void fill(std::vector<float>& data, uint32_t seed) {
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<float>((i * 7919 + seed) % 97) / 48.f - 1.f;
+    }
+}
+
+// the loop of the former float runtime
+void naiveGemmNT(uint32_t M, uint32_t N, uint32_t K, const float* A, uint32_t lda, const float* B, uint32_t ldb,
+                 float* C, uint32_t ldc) {
+    for (uint32_t i = 0; i < M; i++) {
+        for (uint32_t j = 0; j < N; j++) {
+            float sum = 0.f;
+            for (uint32_t k = 0; k < K; k++) {
+                sum += A[i * lda + k] * B[j * ldb + k];
+            }
+            C[i * ldc + j] += sum;
+        }
+    }
+}
+
+void compareWithNaive(uint32_t M, uint32_t N, uint32_t K, uint32_t lda, uint32_t ldb, uint32_t ldc, Sgemm sgemm) {
+    std::vector<float> A(static_cast<size_t>(M - 1) * lda + K), B(static_cast<size_t>(N - 1) * ldb + K);
+    std::vector<float> C(static_cast<size_t>(M) * ldc), expected;
+    fill(A, 1);
+    fill(B, 2);
+    fill(C, 3);
+    expected = C;
+
+    sgemm(M, N, K, A.data(), lda, B.data(), ldb, C.data(), ldc);
+    naiveGemmNT(M, N, K, A.data(), lda, B.data(), ldb, expected.data(), ldc);
+
+    for (size_t i = 0; i < C.size(); i++) {
+        ASSERT_NEAR(expected[i], C[i], 1e-4f * K) << "M " << M << ", N " << N << ", K " << K << ", element " << i;
+    }
+}
+
+void compareWithNaive(uint32_t M, uint32_t N, uint32_t K, uint32_t lda, uint32_t ldb, uint32_t ldc) {
+    compareWithNaive(M, N, K, lda, ldb, ldc, &XARCH::sgemm_nt);
+    compareWithNaive(M, N, K, lda, ldb, ldc, &ANY::sgemm_nt);
+}
+
+void expectNear(const std::vector<float>& expected, const std::vector<float>& actual, float threshold) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_NEAR(expected[i], actual[i], threshold) << "element " << i;
+    }
+}
+
+}  // namespace
+
+TEST(GnaFloatRuntimeTest, sgemmMatchesNaiveLoop) {
+    // batch 1 affine, tails of the vector and of the row blocks
+    compareWithNaive(1, 7, 13, 13, 13, 7);
+    // batched affine which is split between the threads
+    compareWithNaive(8, 300, 440, 440, 440, 300);
+    compareWithNaive(37, 129, 65, 65, 65, 129);
+    // padded rows of the convolution filters
+    compareWithNaive(5, 6, 10, 10, 16, 6);
+}
+
+TEST(GnaFloatRuntimeTest, sgemmReadsOverlappingWindows) {
+    // windows of a 1D convolution with the stride 3 share the input
+    compareWithNaive(50, 8, 24, 3, 24, 8);
+}
+
+TEST(GnaFloatRuntimeTest, sgemmDoesNotTouchOtherColumns) {
+    const uint32_t M = 3, N = 5, K = 9, ldc = 8;
+    std::vector<float> A(M * K, 1.f), B(N * K, 1.f), C(M * ldc, -1.f);
+
+    XARCH::sgemm_nt(M, N, K, A.data(), K, B.data(), K, C.data(), ldc);
+
+    for (uint32_t i = 0; i < M; i++) {
+        for (uint32_t j = 0; j < ldc; j++) {
+            ASSERT_EQ(j < N ? K - 1.f : -1.f, C[i * ldc + j]);
+        }
+    }
+}
+
+TEST(GnaFloatRuntimeTest, convolution1DMatchesReferenceLoop) {
+    const uint32_t numberOfInputs = 96, filterSize = 26, stride = 8, numberOfFilters = 12;
+    const uint32_t numberOfOutputsPerFilter = (numberOfInputs - filterSize) / stride + 1;
+    std::vector<float> input(numberOfInputs), filters(filterSize * numberOfFilters), biases(numberOfFilters);
+    std::vector<float> output(numberOfOutputsPerFilter * numberOfFilters), expected(output.size());
+    fill(input, 1);
+    fill(filters, 2);
+    fill(biases, 3);
+
+    intel_dnn_component_t component{};
+    component.num_rows_in = 1;
+    component.num_rows_out = 1;
+    component.num_columns_in = numberOfInputs;
+    component.num_columns_out = static_cast<uint32_t>(output.size());
+    component.num_bytes_per_input = sizeof(float);
+    component.op.conv1D.num_filters = numberOfFilters;
+    component.op.conv1D.num_filter_coefficients = filterSize;
+    component.op.conv1D.convStride = stride;
+    component.op.conv1D.ptr_filters = filters.data();
+    component.op.conv1D.ptr_biases = biases.data();
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    component.original_layer_name = "conv1D";
+    FP::ApplyConvolutional1DTransform(&component);
+
+    // the loop of the former float runtime
+    for (uint32_t j = 0; j < numberOfOutputsPerFilter; j++) {
+        for (uint32_t i = 0; i < numberOfFilters; i++) {
+            float sum = biases[i];
+            for (uint32_t k = 0; k < filterSize; k++) {
+                sum += input[j * stride + k] * filters[i * filterSize + k];
+            }
+            expected[j * numberOfFilters + i] = sum;
+        }
+    }
+    expectNear(expected, output, 1e-4f * filterSize);
+}
+
+#if GNA_LIB_VER == 2
+TEST(GnaFloatRuntimeTest, convolution2DMatchesReferenceLoop) {
+    // the padded input with the vertical stride, the 27 coefficients of a kernel are aligned to 28
+    const uint32_t IH = 8, IW = 7, IC = 3, KH = 3, KW = 3, OC = 5;
+    const uint32_t strideH = 2, strideW = 1, padH = 1, padW = 1;
+    const uint32_t OH = (IH + 2 * padH - KH) / strideH + 1, OW = (IW + 2 * padW - KW) / strideW + 1;
+    const uint32_t kernelSize = KH * KW * IC, kernelStride = 28;
+    std::vector<float> input(IH * IW * IC), filters(kernelStride * OC), biases(OC);
+    std::vector<float> output(OH * OW * OC), expected(output.size());
+    fill(input, 4);
+    fill(filters, 5);
+    fill(biases, 6);
+
+    intel_dnn_component_t component{};
+    component.tensors = {{{1, IH, IW, IC}, OvGnaTypeInt32, OvGnaModeDefault},
+                         {{1, OH, OW, OC}, OvGnaTypeInt32, OvGnaModeDefault},
+                         {{OC, KH, KW, IC}, OvGnaTypeInt32, OvGnaModeDefault}};
+    component.num_bytes_per_input = sizeof(float);
+    component.op.conv2D.convStride = {strideH, strideW};
+    component.op.conv2D.zeroPadding = {padH, padW};
+    component.op.conv2D.ptr_filters = filters.data();
+    component.op.conv2D.ptr_biases = biases.data();
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    component.original_layer_name = "conv2D";
+    FP::ApplyConvolutional2DTransform(&component);
+
+    // the loop of the former float runtime, HWC layouts
+    for (uint32_t oc = 0; oc < OC; oc++) {
+        for (uint32_t oh = 0; oh < OH; oh++) {
+            for (uint32_t ow = 0; ow < OW; ow++) {
+                float sum = 0.f;
+                for (uint32_t kh = 0; kh < KH; kh++) {
+                    for (uint32_t kw = 0; kw < KW; kw++) {
+                        const int ih = static_cast<int>(strideH * oh + kh) - static_cast<int>(padH);
+                        const int iw = static_cast<int>(strideW * ow + kw) - static_cast<int>(padW);
+                        if (ih < 0 || iw < 0 || ih >= static_cast<int>(IH) || iw >= static_cast<int>(IW))
+                            continue;
+                        for (uint32_t kc = 0; kc < IC; kc++) {
+                            sum += input[(ih * IW + iw) * IC + kc] * filters[oc * kernelStride + (kh * KW + kw) * IC + kc];
+                        }
+                    }
+                }
+                expected[(oh * OW + ow) * OC + oc] = sum + biases[oc];
+            }
+        }
+    }
+    expectNear(expected, output, 1e-4f * kernelSize);
+}
+#endif
+
+TEST(GnaFloatRuntimeTest, poolingMatchesReferenceLoop) {
+    // 1D max and sum pooling of the rows with the channels interleaved, the last window is cut
+    const uint32_t channels = 6, rows = 23, window = 4, step = 3;
+    const uint32_t windows = (rows + step - 1) / step;
+    std::vector<float> input(rows * channels), output(windows * channels);
+    fill(input, 7);
+
+    intel_dnn_component_t component{};
+    component.num_bytes_per_input = sizeof(float);
+    component.op.maxpool.inCHW = {channels, rows, 1};
+    component.op.maxpool.outCHW = {channels, windows, 1};
+    component.op.maxpool.poolingWindowXY = {window, 1};
+    component.op.maxpool.poolingStrideXY = {step, 1};
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+
+    for (const bool sumPooling : {false, true}) {
+        std::fill(output.begin(), output.end(), 0.f);
+        if (sumPooling) {
+            CNNMaxPool(&component, kDnnFloat, true);
+        } else {
+            FP::ApplyMaxPoolTransform(&component, kDnnFloat);
+        }
+        // the loop of the former float runtime
+        for (uint32_t i = 0; i < channels; i++) {
+            uint32_t m = 0;
+            for (uint32_t j = 0; j < rows; j += step, m++) {
+                float expected = sumPooling ? 0.f : std::numeric_limits<float>::lowest();
+                for (uint32_t k = j; k < std::min(rows, j + window); k++) {
+                    expected = sumPooling ? expected + input[k * channels + i] : std::max(expected, input[k * channels + i]);
+                }
+                ASSERT_FLOAT_EQ(expected, output[m * channels + i]) << "sum " << sumPooling << ", channel " << i << ", window " << m;
+            }
+        }
+    }
+}
+
+TEST(GnaFloatRuntimeTest, pooling2DMatchesReferenceLoop) {
+    // HWC layout, the windows at the bottom and right borders are cut
+    const uint32_t IC = 5, IH = 7, IW = 6, winH = 3, winW = 2, strideH = 2, strideW = 2;
+    const uint32_t OH = 3, OW = 3;
+    std::vector<float> input(IH * IW * IC), output(OH * OW * IC);
+    fill(input, 8);
+
+    intel_dnn_component_t component{};
+    component.num_bytes_per_input = sizeof(float);
+    component.op.maxpool.inCHW = {IC, IH, IW};
+    component.op.maxpool.outCHW = {IC, OH, OW};
+    component.op.maxpool.poolingWindowXY = {winW, winH};
+    component.op.maxpool.poolingStrideXY = {strideW, strideH};
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    FP::ApplyMaxPoolTransform(&component, kDnnFloat);
+
+    // the loop of the former float runtime
+    for (uint32_t oc = 0; oc < IC; oc++) {
+        for (uint32_t oh = 0; oh < OH; oh++) {
+            for (uint32_t ow = 0; ow < OW; ow++) {
+                float expected = std::numeric_limits<float>::lowest();
+                for (uint32_t h = oh * strideH; h < std::min(IH, oh * strideH + winH); h++) {
+                    for (uint32_t w = ow * strideW; w < std::min(IW, ow * strideW + winW); w++) {
+                        expected = std::max(expected, input[(h * IW + w) * IC + oc]);
+                    }
+                }
+                ASSERT_FLOAT_EQ(expected, output[(oh * OW + ow) * IC + oc]) << oh << " " << ow << " " << oc;
+            }
+        }
+    }
+}
+
+TEST(GnaFloatRuntimeTest, parallelPwlMatchesReferenceLoop) {
+    // the range is large enough to be split between the threads by rows
+    const uint32_t rows = 16, columns = 512;
+    std::vector<float> input(rows * columns), output(rows * columns);
+    fill(input, 9);
+    for (auto& value : input) {
+        value *= 8.f;
+    }
+
+    intel_dnn_component_t component{};
+    component.num_rows_in = rows;
+    component.num_columns_in = columns;
+    component.orientation_in = kDnnInterleavedOrientation;
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+
+    for (const auto type : {kActSigmoid, kActTanh}) {
+        component.op.pwl.func_id = DnnActivation::fromType(type);
+        std::fill(output.begin(), output.end(), 0.f);
+        FP::ApplyPiecewiseLinearTransform(&component, kDnnFloat, rows);
+        // the loop of the former float runtime
+        for (size_t i = 0; i < input.size(); i++) {
+            const double expected = type == kActSigmoid ? 0.5 * (1.0 + std::tanh(0.5 * input[i])) : std::tanh(input[i]);
+            ASSERT_NEAR(expected, output[i], 1e-6) << "type " << type << ", element " << i;
+        }
+    }
+}
+
+TEST(GnaFloatRuntimeTest, recurrentMatchesReferenceLoop) {
+    // the weights of an output are the row of the input part followed by the row of the feedback part
+    const uint32_t rows = 3, inputs = 37, outputs = 21, row = 1;
+    std::vector<float> input(rows * inputs), feedbacks(outputs), weights(outputs * (inputs + outputs)), biases(outputs);
+    std::vector<float> output(rows * outputs), expected(outputs);
+    fill(input, 10);
+    fill(feedbacks, 11);
+    fill(weights, 12);
+    fill(biases, 13);
+
+    intel_dnn_component_t component{};
+    component.num_rows_in = rows;
+    component.num_columns_in = inputs;
+    component.num_rows_out = rows;
+    component.num_columns_out = outputs;
+    component.num_bytes_per_input = sizeof(float);
+    component.op.recurrent.ptr_feedbacks = feedbacks.data();
+    component.op.recurrent.ptr_weights = weights.data();
+    component.op.recurrent.ptr_biases = biases.data();
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    FP::ApplyRecurrentTransform(&component, row, feedbacks.data());
+
+    // the loop of the former float runtime
+    for (uint32_t i = 0; i < outputs; i++) {
+        float sum = biases[i];
+        for (uint32_t k = 0; k < inputs; k++) {
+            sum += weights[i * (inputs + outputs) + k] * input[row * inputs + k];
+        }
+        for (uint32_t k = 0; k < outputs; k++) {
+            sum += weights[i * (inputs + outputs) + inputs + k] * feedbacks[k];
+        }
+        expected[i] = sum;
+    }
+    expectNear(expected, std::vector<float>(output.begin() + row * outputs, output.begin() + (row + 1) * outputs),
+               1e-4f * (inputs + outputs));
+}
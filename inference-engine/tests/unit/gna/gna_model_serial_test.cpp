@@ -2,12 +2,23 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
 // to suppress deprecated definition errors
 #define IMPLEMENT_INFERENCE_ENGINE_PLUGIN
 #include "gna_model_serial.hpp"
+#if GNA_LIB_VER == 2
+#include "gna_api_wrapper.hpp"
+#endif
 
 using ::testing::Return;
 using ::testing::_;
@@ -24,3 +35,191 @@ TEST(GNAModelSerialTest, TestErrorOnTellg) {
     std::istream is(&mock);
     ASSERT_THROW(GNAModelSerial::ReadHeader(is), InferenceEngine::Exception);
 }
+
+#if GNA_LIB_VER == 2
+using namespace GNAPluginNS;
+
+namespace {
+
+// keyword spotting topology: 40 features, 3 hidden affine layers of 128 and 12 keywords
+const std::vector<uint32_t> kwsLayerSizes = {40, 128, 128, 128, 12};
+
+struct ImportedModel {
+    std::vector<uint8_t> graph;
+    std::unique_ptr<CPPWrapper<Gna2Model>> model;
+    GNAModelSerial::MemoryType states;
+    std::shared_ptr<InputDesc> inputsDesc = std::make_shared<InputDesc>();
+    std::vector<OutputDesc> outputsDesc;
+    InferenceEngine::InputsDataMap inputsDataMap;
+    InferenceEngine::OutputsDataMap outputsDataMap;
+};
+
+std::string exportKwsModel(std::vector<uint8_t>& graph) {
+    const size_t layers = kwsLayerSizes.size() - 1;
+    size_t graphSize = kwsLayerSizes.front() * sizeof(int16_t);
+    for (size_t l = 0; l < layers; l++) {
+        graphSize += kwsLayerSizes[l + 1] * (kwsLayerSizes[l] * sizeof(int16_t) + 2 * sizeof(int32_t));
+    }
+    graph.resize(graphSize);
+    for (size_t i = 0; i < graph.size(); i++) {
+        graph[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+
+    CPPWrapper<Gna2Model> model(layers);
+    uint8_t* ptr = graph.data();
+    uint8_t* input = ptr;
+    ptr += kwsLayerSizes.front() * sizeof(int16_t);
+    uint8_t* output = input;
+    for (size_t l = 0; l < layers; l++) {
+        const auto in = kwsLayerSizes[l], out = kwsLayerSizes[l + 1];
+        auto& operation = model.obj.Operations[l];
+        operation.Type = Gna2OperationTypeFullyConnectedAffine;
+        operation.NumberOfOperands = 5;
+        operation.Operands = static_cast<Gna2Tensor const **>(gnaUserAllocator(sizeof(Gna2Tensor*) * 5));
+        operation.Operands[0] = createGna2Tensor2D(in, 1, sizeof(int16_t), output);
+        output = ptr;
+        ptr += out * sizeof(int32_t);
+        operation.Operands[1] = createGna2Tensor2D(out, 1, sizeof(int32_t), output);
+        operation.Operands[2] = createGna2Tensor2D(out, in, sizeof(int16_t), ptr);
+        ptr += out * in * sizeof(int16_t);
+        operation.Operands[3] = createGna2BiasTensor1D(out, sizeof(int32_t), ptr);
+        ptr += out * sizeof(int32_t);
+        operation.Operands[4] = nullptr;
+    }
+
+    auto inputsDesc = std::make_shared<InputDesc>();
+    inputsDesc->getPtrInputsGlobal("input").push_back(input);
+    inputsDesc->orientation_in["input"] = kDnnInterleavedOrientation;
+    inputsDesc->inputScaleFactors.push_back(2048.f);
+    std::vector<OutputDesc> outputsDesc(1);
+    outputsDesc[0].ptrs.push_back(output);
+    outputsDesc[0].num_bytes_per_element = sizeof(int32_t);
+    outputsDesc[0].orientation = kDnnInterleavedOrientation;
+
+    InferenceEngine::InputsDataMap inputsDataMap;
+    inputsDataMap["input"] = std::make_shared<InferenceEngine::InputInfo>();
+    inputsDataMap["input"]->setInputData(std::make_shared<InferenceEngine::Data>("input",
+        InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, {1, kwsLayerSizes.front()},
+                                    InferenceEngine::Layout::NC)));
+    InferenceEngine::OutputsDataMap outputsDataMap;
+    outputsDataMap["keywords"] = std::make_shared<InferenceEngine::Data>("keywords",
+        InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, {1, kwsLayerSizes.back()},
+                                    InferenceEngine::Layout::NC));
+
+    std::ostringstream os;
+    GNAModelSerial(&model.obj, inputsDesc, outputsDesc, inputsDataMap, outputsDataMap)
+        .AddState(input, kwsLayerSizes.front() * sizeof(int16_t), "state")
+        .Export(graph.data(), graph.size(), os);
+    return os.str();
+}
+
+void importModel(ModelBuffer& buffer, ImportedModel& imported) {
+    const auto header = GNAModelSerial::ReadHeader(buffer);
+    imported.graph.resize(header.gnaMemSize);
+    imported.model.reset(new CPPWrapper<Gna2Model>(header.layersCount));
+    GNAModelSerial serial(&imported.model->obj, imported.states);
+    serial.setHeader(header);
+    TranspositionInfoMap inputsTranspositionInfo, outputsTranspositionInfo;
+    serial.Import(imported.graph.data(), header.gnaMemSize, buffer, imported.inputsDesc, imported.outputsDesc,
+                  imported.inputsDataMap, imported.outputsDataMap, inputsTranspositionInfo, outputsTranspositionInfo);
+}
+
+void checkImportedModel(const std::vector<uint8_t>& graph, const ImportedModel& imported) {
+    ASSERT_EQ(graph, imported.graph);
+    ASSERT_EQ(kwsLayerSizes.size() - 1, imported.model->obj.NumberOfOperations);
+    for (uint32_t l = 0; l < imported.model->obj.NumberOfOperations; l++) {
+        const auto& operation = imported.model->obj.Operations[l];
+        ASSERT_EQ(5u, operation.NumberOfOperands);
+        ASSERT_EQ(nullptr, operation.Operands[4]);
+        const auto weights = static_cast<const uint8_t*>(operation.Operands[2]->Data);
+        ASSERT_TRUE(weights >= imported.graph.data() && weights < imported.graph.data() + imported.graph.size());
+    }
+    ASSERT_EQ(1u, imported.inputsDataMap.count("input"));
+    ASSERT_EQ(1u, imported.outputsDataMap.count("keywords"));
+    ASSERT_EQ(2048.f, imported.inputsDesc->inputScaleFactors.at(0));
+    ASSERT_EQ(1u, imported.states.size());
+    ASSERT_EQ("state", std::get<2>(imported.states[0]));
+}
+
+}  // namespace
+
+TEST(GNAModelSerialTest, ImportFromStreamAdvancesPastModel) {
+    std::vector<uint8_t> graph;
+    const auto blob = exportKwsModel(graph);
+    std::istringstream is(blob + "tail");
+
+    auto buffer = ModelBuffer::FromStream(is);
+    ImportedModel imported;
+    importModel(buffer, imported);
+    is.seekg(buffer.Position(), std::ios_base::cur);
+
+    checkImportedModel(graph, imported);
+    ASSERT_EQ(blob.size(), static_cast<size_t>(is.tellg()));
+}
+
+TEST(GNAModelSerialTest, ImportFromMappedFile) {
+    std::vector<uint8_t> graph;
+    const auto blob = exportKwsModel(graph);
+    const std::string fileName = "gna_model_serial_test.blob";
+    std::ofstream(fileName, std::ios_base::binary) << blob;
+
+    ImportedModel imported;
+    {
+        auto buffer = ModelBuffer::FromFile(fileName);
+        importModel(buffer, imported);
+        ASSERT_EQ(blob.size(), buffer.Position());
+    }
+    std::remove(fileName.c_str());
+
+    checkImportedModel(graph, imported);
+}
+
+TEST(GNAModelSerialTest, TestErrorOnTruncatedModel) {
+    std::vector<uint8_t> graph;
+    const auto blob = exportKwsModel(graph);
+    std::istringstream is(blob.substr(0, blob.size() - 1));
+
+    auto buffer = ModelBuffer::FromStream(is);
+    ImportedModel imported;
+    ASSERT_THROW(importModel(buffer, imported), InferenceEngine::Exception);
+}
+
+// Import time of the keyword spotting model from a stream and from a mapped file. The test is a benchmark, it is
+// disabled and run on demand: --gtest_also_run_disabled_tests --gtest_filter=*ImportLatency* --gtest_output=xml
+// The import times are reported as properties of the test case in the XML report.
+TEST(GNAModelSerialTest, DISABLED_ImportLatency) {
+    std::vector<uint8_t> graph;
+    const auto blob = exportKwsModel(graph);
+    const std::string fileName = "gna_model_serial_latency.blob";
+    std::ofstream(fileName, std::ios_base::binary) << blob;
+
+    const int iterations = 200;
+    auto measure = [&](bool fromFile) {
+        ImportedModel imported;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            imported = ImportedModel{};
+            if (fromFile) {
+                auto buffer = ModelBuffer::FromFile(fileName);
+                importModel(buffer, imported);
+            } else {
+                std::ifstream is(fileName, std::ios_base::binary);
+                auto buffer = ModelBuffer::FromStream(is);
+                importModel(buffer, imported);
+            }
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        checkImportedModel(graph, imported);
+        return std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+    };
+
+    const double streamUs = measure(false);
+    const double fileUs = measure(true);
+    std::remove(fileName.c_str());
+
+    RecordProperty("stream_import_us", static_cast<int>(streamUs));
+    RecordProperty("mapped_file_import_us", static_cast<int>(fileUs));
+    std::cout << "[ INFO ] import of a " << blob.size() << " bytes keyword spotting model: stream " << streamUs
+              << " us, mapped file " << fileUs << " us" << std::endl;
+}
+#endif
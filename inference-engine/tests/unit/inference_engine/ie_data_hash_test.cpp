@@ -0,0 +1,129 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "ie_data_hash.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+std::vector<uint8_t> makeData(size_t size) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; i++)
+        data[i] = static_cast<uint8_t>((i * 2654435761u) >> 13);
+    return data;
+}
+}  // namespace
+
+TEST(DataHashTests, hashIsDeterministic) {
+    const auto data = makeData(3 * DataHash::blockSize + 123);
+    ASSERT_EQ(DataHash::hash(data.data(), data.size()), DataHash::hash(data.data(), data.size()));
+}
+
+TEST(DataHashTests, hashDependsOnContent) {
+    auto data = makeData(2 * DataHash::blockSize);
+    const auto reference = DataHash::hash(data.data(), data.size());
+    data[DataHash::blockSize + 1] ^= 1;
+    ASSERT_NE(reference, DataHash::hash(data.data(), data.size()));
+}
+
+TEST(DataHashTests, hashDependsOnSize) {
+    const std::vector<uint8_t> data(64, 0);
+    ASSERT_NE(DataHash::hash(data.data(), 32), DataHash::hash(data.data(), 64));
+    ASSERT_NE(DataHash::hash(data.data(), 0), DataHash::hash(data.data(), 1));
+}
+
+TEST(DataHashTests, blockOrderMatters) {
+    auto data = makeData(2 * DataHash::blockSize);
+    const auto reference = DataHash::hash(data.data(), data.size());
+    std::rotate(data.begin(), data.begin() + DataHash::blockSize, data.end());
+    ASSERT_NE(reference, DataHash::hash(data.data(), data.size()));
+}
+
+TEST(DataHashTests, streamingDigestDoesNotDependOnChunks) {
+    const auto data = makeData(5 * DataHash::blockSize + 777);
+    const auto reference = DataHash::hash(data.data(), data.size());
+
+    for (size_t chunk : {size_t(1), size_t(4093), DataHash::blockSize - 1, 3 * DataHash::blockSize + 5}) {
+        DataHash hasher;
+        for (size_t offset = 0; offset < data.size(); offset += chunk)
+            hasher.update(data.data() + offset, std::min(chunk, data.size() - offset));
+        ASSERT_EQ(reference, hasher.digest()) << "chunk size " << chunk;
+    }
+}
+
+TEST(DataHashTests, xxHash64MatchesReferenceVectors) {
+    // the digests of the reference xxHash64 implementation
+    const struct {
+        const char* data;
+        uint64_t seed;
+        uint64_t digest;
+    } vectors[] = {
+        {"", 0, 0xEF46DB3751D8E999ULL},
+        {"a", 0, 0xD24EC4F1A98C6E5BULL},
+        {"abc", 0, 0x44BC2CF5AD770999ULL},
+        {"Nobody inspects the spammish repetition", 0, 0xFBCEA83C8A378BF1ULL},
+        {"The quick brown fox jumps over the lazy dog", 0, 0x0B242D361FDA71BCULL},
+        {"The quick brown fox jumps over the lazy dog", 1234, 0x5B3C21FECFC907FDULL},
+    };
+    for (const auto& v : vectors) {
+        ASSERT_EQ(v.digest, DataHash::xxHash64(v.data, std::strlen(v.data), v.seed)) << "\"" << v.data << "\"";
+    }
+}
+
+TEST(DataHashTests, hashMatchesKnownAnswers) {
+    // the digests are computed by the reference xxHash64 implementation: the blocks are hashed with the seed 0,
+    // the tail is hashed with the total size as the seed
+    ASSERT_EQ(0x23BC019DFE394584ULL, DataHash::hash("", 0));
+    ASSERT_EQ(0x64FC49E436701431ULL, DataHash::hash("abc", 3));
+
+    const auto data = makeData(2 * DataHash::blockSize + 100);
+    ASSERT_EQ(0x105F5D5D4B17D3F9ULL, DataHash::hash(data.data(), data.size()));
+
+    DataHash hasher;
+    hasher.update(data.data(), DataHash::blockSize + 1);
+    DataHash moved(std::move(hasher));
+    moved.update(data.data() + DataHash::blockSize + 1, data.size() - DataHash::blockSize - 1);
+    ASSERT_EQ(0x105F5D5D4B17D3F9ULL, moved.digest());
+}
+
+// Throughput of hashing a large weights buffer, the block-parallel DataHash against the single-threaded xxHash64 of
+// the whole buffer. The test is a benchmark, it is disabled and run on demand:
+// --gtest_also_run_disabled_tests --gtest_filter=*DataHashPerfTests* --gtest_output=xml
+// The throughputs are reported as properties of the test case in the XML report.
+TEST(DataHashPerfTests, DISABLED_weightsThroughput) {
+    const auto data = makeData(size_t(512) << 20);
+    const int iterations = 5;
+
+    auto measure = [&](uint64_t (*hashFn)(const uint8_t*, size_t)) {
+        // the first pass brings the buffer into the memory and checks that the digest is stable
+        const auto reference = hashFn(data.data(), data.size());
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++)
+            EXPECT_EQ(reference, hashFn(data.data(), data.size()));
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return iterations * data.size() / elapsed.count() / 1e9;
+    };
+
+    const auto dataHashRate = measure([](const uint8_t* ptr, size_t size) {
+        return DataHash::hash(ptr, size);
+    });
+    const auto xxHash64Rate = measure([](const uint8_t* ptr, size_t size) {
+        return DataHash::xxHash64(ptr, size, 0);
+    });
+
+    // the properties are integral, so the throughputs are recorded in MB/s
+    RecordProperty("data_hash_mb_per_second", static_cast<int>(dataHashRate * 1000));
+    RecordProperty("xxhash64_mb_per_second", static_cast<int>(xxHash64Rate * 1000));
+    std::cout << "[ INFO ] DataHash: " << dataHashRate << " GB/s" << std::endl;
+    std::cout << "[ INFO ] xxHash64: " << xxHash64Rate << " GB/s" << std::endl;
+}
@@ -0,0 +1,68 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/test_common.hpp"
+
+#include "ie_mmap_blob.hpp"
+
+using namespace InferenceEngine;
+
+class MappedBlobTests : public CommonTestUtils::TestsCommon {
+protected:
+    void SetUp() override {
+        CommonTestUtils::TestsCommon::SetUp();
+        CommonTestUtils::createFile(fileName, content);
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFile(fileName);
+        CommonTestUtils::TestsCommon::TearDown();
+    }
+
+    const std::string fileName = "mapped_blob_test.bin";
+    const std::string content = "0123456789abcdef";
+};
+
+#ifndef _WIN32
+
+TEST_F(MappedBlobTests, canMapFile) {
+    auto blob = details::CreateMappedBlob(fileName);
+    ASSERT_NE(blob, nullptr);
+    ASSERT_EQ(blob->byteSize(), content.size());
+    ASSERT_EQ(0, std::memcmp(blob->cbuffer().as<const char*>(), content.data(), content.size()));
+}
+
+TEST_F(MappedBlobTests, blobOutlivesRemovedFile) {
+    auto blob = details::CreateMappedBlob(fileName);
+    ASSERT_NE(blob, nullptr);
+    CommonTestUtils::removeFile(fileName);
+    ASSERT_EQ(0, std::memcmp(blob->cbuffer().as<const char*>(), content.data(), content.size()));
+}
+
+TEST_F(MappedBlobTests, mappingCanNotBeLockedForWrite) {
+    auto blob = as<MemoryBlob>(std::const_pointer_cast<Blob>(details::CreateMappedBlob(fileName)));
+    ASSERT_NE(blob, nullptr);
+    ASSERT_EQ(nullptr, blob->wmap().as<char*>());
+    ASSERT_EQ(0, std::memcmp(blob->rmap().as<const char*>(), content.data(), content.size()));
+}
+
+TEST_F(MappedBlobTests, blobsOfSameFileShareMapping) {
+    auto first = details::CreateMappedBlob(fileName);
+    auto second = details::CreateMappedBlob(fileName);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    ASSERT_EQ(first->cbuffer().as<const char*>(), second->cbuffer().as<const char*>());
+}
+
+#endif
+
+TEST_F(MappedBlobTests, returnsNullptrForMissingFile) {
+    ASSERT_EQ(details::CreateMappedBlob("not_existing_file.bin"), nullptr);
+}
@@ -0,0 +1,158 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "common_test_utils/test_common.hpp"
+#include "ie_plugin_config.hpp"
+#include "pooled_allocator.hpp"
+#include "system_allocator.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+bool isAligned(void* ptr, size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+}  // namespace
+
+class PooledAllocatorTests : public CommonTestUtils::TestsCommon {};
+
+TEST_F(PooledAllocatorTests, sizeClassCoversRequest) {
+    for (size_t size : {size_t(0), size_t(1), size_t(64), size_t(65), size_t(1000), size_t(4096), size_t(100000),
+                        PooledMemoryAllocator::hugePageSize - 1, PooledMemoryAllocator::hugePageSize + 1}) {
+        const auto capacity = PooledMemoryAllocator::sizeClass(size);
+        EXPECT_GE(capacity, size);
+        EXPECT_EQ(capacity % PooledMemoryAllocator::cacheLineSize, 0);
+        // four size classes per power of two waste at most a quarter of the block
+        if (size > PooledMemoryAllocator::cacheLineSize && capacity < PooledMemoryAllocator::hugePageSize)
+            EXPECT_LE(capacity, size + size / 4 + PooledMemoryAllocator::cacheLineSize);
+    }
+    EXPECT_EQ(PooledMemoryAllocator::sizeClass(PooledMemoryAllocator::hugePageSize + 1) %
+                  PooledMemoryAllocator::hugePageSize, 0);
+}
+
+TEST_F(PooledAllocatorTests, blocksAreAligned) {
+    PooledMemoryAllocator allocator;
+    void* small = allocator.alloc(100);
+    void* large = allocator.alloc(3 * PooledMemoryAllocator::hugePageSize);
+    ASSERT_NE(small, nullptr);
+    ASSERT_NE(large, nullptr);
+    EXPECT_TRUE(isAligned(small, PooledMemoryAllocator::cacheLineSize));
+    EXPECT_TRUE(isAligned(large, PooledMemoryAllocator::hugePageSize));
+
+    auto bytes = static_cast<uint8_t*>(allocator.lock(large));
+    bytes[3 * PooledMemoryAllocator::hugePageSize - 1] = 11;
+    EXPECT_EQ(bytes[3 * PooledMemoryAllocator::hugePageSize - 1], 11);
+    allocator.unlock(large);
+
+    EXPECT_TRUE(allocator.free(small));
+    EXPECT_TRUE(allocator.free(large));
+}
+
+TEST_F(PooledAllocatorTests, hugePagesFallBackIfNotReserved) {
+    PooledMemoryAllocator allocator(true);
+    void* large = allocator.alloc(PooledMemoryAllocator::hugePageSize);
+    ASSERT_NE(large, nullptr);
+    EXPECT_TRUE(isAligned(large, PooledMemoryAllocator::hugePageSize));
+    EXPECT_TRUE(allocator.free(large));
+}
+
+TEST_F(PooledAllocatorTests, releasedBlockIsReused) {
+    PooledMemoryAllocator allocator;
+    void* first = allocator.alloc(1000);
+    ASSERT_TRUE(allocator.free(first));
+    // the same size class is served from the pool
+    void* second = allocator.alloc(990);
+    EXPECT_EQ(first, second);
+    EXPECT_TRUE(allocator.free(second));
+    allocator.trim();
+}
+
+TEST_F(PooledAllocatorTests, freeRejectsForeignHandles) {
+    PooledMemoryAllocator allocator;
+    int foreign = 0;
+    EXPECT_TRUE(allocator.free(nullptr));
+    EXPECT_FALSE(allocator.free(&foreign));
+}
+
+TEST_F(PooledAllocatorTests, defaultAllocatorIsSelectable) {
+    SetDefaultAllocatorType(CONFIG_VALUE(POOLED));
+    auto pooled = CreateDefaultAllocator();
+    EXPECT_NE(nullptr, std::dynamic_pointer_cast<PooledMemoryAllocator>(pooled));
+    EXPECT_EQ(pooled, CreateDefaultAllocator());
+
+    SetDefaultAllocatorType(CONFIG_VALUE(SYSTEM));
+    EXPECT_NE(nullptr, std::dynamic_pointer_cast<SystemMemoryAllocator>(CreateDefaultAllocator()));
+
+    EXPECT_THROW(SetDefaultAllocatorType("UNKNOWN"), Exception);
+}
+
+TEST_F(PooledAllocatorTests, blobsRecreatedForEveryRequestReuseBlocks) {
+    // sizes of typical input and output blobs re-created for every request
+    const std::vector<size_t> sizes = {4 * 1024, 150 * 1024, 600 * 1024, 4 * 1024 * 1024};
+
+    PooledMemoryAllocator allocator;
+    std::vector<void*> first;
+    for (auto size : sizes) {
+        first.push_back(allocator.alloc(size));
+        ASSERT_NE(first.back(), nullptr);
+    }
+    for (auto ptr : first)
+        ASSERT_TRUE(allocator.free(ptr));
+
+    for (size_t i = 0; i < sizes.size(); i++) {
+        void* ptr = allocator.alloc(sizes[i]);
+        EXPECT_EQ(first[i], ptr);
+        EXPECT_TRUE(allocator.free(ptr));
+    }
+}
+
+// Allocation rate of the pooled and the system allocators for blobs re-created for every request. The suite is
+// a benchmark, it is disabled and run on demand:
+// --gtest_also_run_disabled_tests --gtest_filter=*PooledAllocatorPerfTests* --gtest_output=xml
+// The rates are reported as properties of the test case in the XML report.
+class PooledAllocatorPerfTests : public CommonTestUtils::TestsCommon {};
+
+TEST_F(PooledAllocatorPerfTests, DISABLED_allocationRate) {
+    // sizes of typical input and output blobs re-created for every request
+    const std::vector<size_t> sizes = {4 * 1024, 150 * 1024, 600 * 1024, 4 * 1024 * 1024};
+    const size_t iterations = 2000;
+
+    auto request = [&](IAllocator& allocator) {
+        for (auto size : sizes) {
+            auto ptr = static_cast<uint8_t*>(allocator.alloc(size));
+            ASSERT_NE(nullptr, ptr);
+            // the first write makes the system allocator fault the pages in, as a blob does; the access is
+            // volatile so that the compiler does not elide the allocation
+            static_cast<volatile uint8_t*>(ptr)[size - 1] = 1;
+            ASSERT_TRUE(allocator.free(ptr));
+        }
+    };
+
+    auto measure = [&](IAllocator& allocator) {
+        // the first request fills the pools, the steady state of the following requests is measured
+        request(allocator);
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++)
+            request(allocator);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return static_cast<int>(iterations * sizes.size() / elapsed.count());
+    };
+
+    SystemMemoryAllocator system;
+    PooledMemoryAllocator pooled;
+    const auto systemRate = measure(system);
+    const auto pooledRate = measure(pooled);
+
+    RecordProperty("system_allocations_per_second", systemRate);
+    RecordProperty("pooled_allocations_per_second", pooledRate);
+    std::cout << "[ INFO ] system allocator: " << systemRate << " allocations/s" << std::endl;
+    std::cout << "[ INFO ] pooled allocator: " << pooledRate << " allocations/s" << std::endl;
+}
@@ -6,7 +6,14 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
 #include <limits>
+#include <random>
+#include <vector>
 
 using namespace InferenceEngine;
 
@@ -46,3 +53,148 @@ TEST_F(PrecisionUtilsTests, FP32ToFP16LowestValue) {
     const auto fp16ConvertedLowestValue = InferenceEngine::PrecisionUtils::f32tof16(std::numeric_limits<float>::lowest());
     ASSERT_EQ(fp16ConvertedLowestValue, lowestNumber);
 }
+
+// the length is not a multiple of the vector length to check the scalar tail as well
+static constexpr size_t arrayLength = 1027;
+
+static std::vector<float> randomFloats(size_t length, float min, float max) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(min, max);
+    std::vector<float> values(length);
+    for (auto& v : values)
+        v = dist(gen);
+    return values;
+}
+
+TEST_F(PrecisionUtilsTests, FP32ToFP16ArraysMatchScalarConversion) {
+    auto src = randomFloats(arrayLength, -70000.f, 70000.f);
+    // special values: infinities, NaN, denormals and the values between the smallest normal FP16 values
+    const std::vector<float> special = {std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+                                        std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::denorm_min(),
+                                        4.0e-5f, -4.0e-5f, 6.5e-5f, 65519.f, 65520.f, -0.f};
+    std::copy(special.begin(), special.end(), src.begin() + 3);
+
+    std::vector<ie_fp16> dst(arrayLength);
+    PrecisionUtils::f32tof16Arrays(dst.data(), src.data(), arrayLength);
+    for (size_t i = 0; i < arrayLength; i++)
+        ASSERT_EQ(PrecisionUtils::f32tof16(src[i]), dst[i]) << "element " << i << " value " << src[i];
+}
+
+TEST_F(PrecisionUtilsTests, FP16ToFP32ArraysMatchScalarConversion) {
+    // all the FP16 values including NaN, infinities and denormals
+    std::vector<ie_fp16> src(1 << 16);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<ie_fp16>(i);
+
+    std::vector<float> dst(src.size());
+    PrecisionUtils::f16tof32Arrays(dst.data(), src.data(), src.size());
+    for (size_t i = 0; i < src.size(); i++) {
+        const float expected = PrecisionUtils::f16tof32(src[i]);
+        ASSERT_EQ(0, std::memcmp(&expected, &dst[i], sizeof(float))) << "element " << i;
+    }
+}
+
+TEST_F(PrecisionUtilsTests, ConvertArraysAppliesScaleAndBias) {
+    const auto src = randomFloats(arrayLength, -100.f, 100.f);
+    std::vector<ie_fp16> fp16(arrayLength);
+    PrecisionUtils::f32tof16Arrays(fp16.data(), src.data(), arrayLength, 0.5f, 2.f);
+
+    std::vector<float> dst(arrayLength);
+    PrecisionUtils::f16tof32Arrays(dst.data(), fp16.data(), arrayLength, 2.f, -4.f);
+    for (size_t i = 0; i < arrayLength; i++) {
+        ASSERT_EQ(PrecisionUtils::f32tof16(src[i] * 0.5f + 2.f), fp16[i]) << "element " << i;
+        ASSERT_EQ(PrecisionUtils::f16tof32(fp16[i]) * 2.f - 4.f, dst[i]) << "element " << i;
+    }
+}
+
+TEST_F(PrecisionUtilsTests, ConvertArraysToIntegralTruncatesAndSaturates) {
+    const auto src = randomFloats(arrayLength, -300.f, 300.f);
+    std::vector<uint8_t> u8(arrayLength);
+    std::vector<int8_t> i8(arrayLength);
+    std::vector<int32_t> i32(arrayLength);
+    PrecisionUtils::convertArrays(u8.data(), Precision::U8, src.data(), Precision::FP32, arrayLength);
+    PrecisionUtils::convertArrays(i8.data(), Precision::I8, src.data(), Precision::FP32, arrayLength);
+    PrecisionUtils::convertArrays(i32.data(), Precision::I32, src.data(), Precision::FP32, arrayLength);
+
+    for (size_t i = 0; i < arrayLength; i++) {
+        const auto truncated = static_cast<int32_t>(src[i]);
+        ASSERT_EQ(std::min(std::max(truncated, 0), 255), u8[i]) << "element " << i;
+        ASSERT_EQ(std::min(std::max(truncated, -128), 127), i8[i]) << "element " << i;
+        ASSERT_EQ(truncated, i32[i]) << "element " << i;
+    }
+
+    const std::vector<float> outOfRange = {std::numeric_limits<float>::quiet_NaN(), 1e10f, -1e10f};
+    PrecisionUtils::convertArrays(i32.data(), Precision::I32, outOfRange.data(), Precision::FP32, outOfRange.size());
+    ASSERT_EQ(std::numeric_limits<int32_t>::lowest(), i32[0]);
+    ASSERT_EQ(2147483520, i32[1]);
+    ASSERT_EQ(std::numeric_limits<int32_t>::lowest(), i32[2]);
+}
+
+TEST_F(PrecisionUtilsTests, ConvertArraysFromIntegralAndBF16) {
+    std::vector<uint8_t> u8(arrayLength);
+    std::vector<int16_t> i16(arrayLength);
+    for (size_t i = 0; i < arrayLength; i++) {
+        u8[i] = static_cast<uint8_t>(i * 7);
+        i16[i] = static_cast<int16_t>(i * 97 - 50000);
+    }
+
+    std::vector<float> fromU8(arrayLength), fromI16(arrayLength), fromBF16(arrayLength);
+    std::vector<uint16_t> bf16(arrayLength);
+    PrecisionUtils::convertArrays(fromU8.data(), Precision::FP32, u8.data(), Precision::U8, arrayLength);
+    PrecisionUtils::convertArrays(fromI16.data(), Precision::FP32, i16.data(), Precision::I16, arrayLength);
+    PrecisionUtils::convertArrays(bf16.data(), Precision::BF16, fromI16.data(), Precision::FP32, arrayLength);
+    PrecisionUtils::convertArrays(fromBF16.data(), Precision::FP32, bf16.data(), Precision::BF16, arrayLength);
+
+    for (size_t i = 0; i < arrayLength; i++) {
+        ASSERT_EQ(static_cast<float>(u8[i]), fromU8[i]) << "element " << i;
+        ASSERT_EQ(static_cast<float>(i16[i]), fromI16[i]) << "element " << i;
+        // BF16 keeps 8 significant bits
+        ASSERT_NEAR(fromI16[i], fromBF16[i], std::fabs(fromI16[i]) / 128) << "element " << i;
+    }
+}
+
+TEST_F(PrecisionUtilsTests, ConvertArraysThrowsOnUnsupportedPrecisions) {
+    ASSERT_FALSE(PrecisionUtils::canConvertArrays(Precision::I32, Precision::U8));
+    ASSERT_FALSE(PrecisionUtils::canConvertArrays(Precision::FP32, Precision::FP32));
+    ASSERT_FALSE(PrecisionUtils::canConvertArrays(Precision::I64, Precision::FP32));
+    ASSERT_TRUE(PrecisionUtils::canConvertArrays(Precision::U8, Precision::BF16));
+
+    int32_t src = 0;
+    uint8_t dst = 0;
+    ASSERT_THROW(PrecisionUtils::convertArrays(&dst, Precision::U8, &src, Precision::I32, 1), Exception);
+}
+
+// Throughput of every supported pair of precisions. The test is a benchmark, it is disabled and run on demand:
+// --gtest_also_run_disabled_tests --gtest_filter=*ConvertArraysThroughput* --gtest_output=xml
+// The throughputs are reported as properties of the test case in the XML report.
+TEST_F(PrecisionUtilsTests, DISABLED_ConvertArraysThroughput) {
+    const std::vector<Precision> precisions = {Precision::U8, Precision::I8, Precision::U16, Precision::I16,
+                                               Precision::I32, Precision::FP16, Precision::BF16, Precision::FP32};
+    const size_t length = 1 << 20;
+    const size_t iterations = 10;
+    // zero is represented by zero bytes in every precision
+    const std::vector<uint8_t> src(length * sizeof(float), 0);
+    std::vector<uint8_t> dst(length * sizeof(float));
+
+    for (auto srcPrc : precisions) {
+        for (auto dstPrc : precisions) {
+            if (!PrecisionUtils::canConvertArrays(srcPrc, dstPrc))
+                continue;
+            std::fill(dst.begin(), dst.end(), 0xFF);
+            PrecisionUtils::convertArrays(dst.data(), dstPrc, src.data(), srcPrc, length);
+            ASSERT_TRUE(std::all_of(dst.begin(), dst.begin() + length * dstPrc.size(), [](uint8_t v) {
+                return v == 0;
+            })) << srcPrc << " -> " << dstPrc;
+
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < iterations; i++)
+                PrecisionUtils::convertArrays(dst.data(), dstPrc, src.data(), srcPrc, length);
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            const auto rate = iterations * length / elapsed.count() / 1e6;
+
+            RecordProperty(std::string(srcPrc.name()) + "_to_" + dstPrc.name() + "_melements_per_second",
+                           static_cast<int>(rate));
+            std::cout << "[ INFO ] " << srcPrc << " -> " << dstPrc << ": " << rate << " Melements/s" << std::endl;
+        }
+    }
+}
@@ -0,0 +1,47 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_transformer_tests.hpp"
+#include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
+
+using namespace vpu;
+
+class VPU_HWConvTilingTest : public GraphTransformerTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+    }
+
+    static HWTilingNS::ConvolutionOptions convolutionOptions(const std::string& name, int inputSize, int channels) {
+        const auto inputDims = DataDesc(DataType::FP16, DimsOrder::NCHW, {inputSize, inputSize, channels, 1}).dims();
+        const auto outputDims = DataDesc(DataType::FP16, DimsOrder::NCHW, {inputSize, inputSize, channels, 1}).dims();
+
+        return HWTilingNS::ConvolutionOptions{name, inputDims, outputDims, outputDims, 3, 3, 1, 1, 1, 1, 1, false};
+    }
+};
+
+TEST_F(VPU_HWConvTilingTest, SameConvolutionParametersReuseTiling) {
+    // the stage names differ, the tiling depends on the parameters of the convolution only
+    const auto first = std::make_shared<HWTilingNS::HWConvolutionTiler>(convolutionOptions("conv1", 112, 256),
+                                                                         HWTilingNS::Direction::INPUT_TO_OUTPUT, 1);
+    const auto hitsBefore = HWTilingNS::HWConvolutionTilingSearcher::cacheHits();
+    const auto second = std::make_shared<HWTilingNS::HWConvolutionTiler>(convolutionOptions("conv2", 112, 256),
+                                                                          HWTilingNS::Direction::INPUT_TO_OUTPUT, 1);
+    // the second search takes the options found by the first one
+    ASSERT_EQ(hitsBefore + 1, HWTilingNS::HWConvolutionTilingSearcher::cacheHits());
+
+    ASSERT_TRUE(first->isTilingPossible());
+    ASSERT_TRUE(second->isTilingPossible());
+    ASSERT_EQ(first->getHwTilings().size(), second->getHwTilings().size());
+
+    for (size_t i = 0; i < first->getHwTilings().size(); ++i) {
+        const auto& firstTiling = first->getHwTilings()[i];
+        const auto& secondTiling = second->getHwTilings()[i];
+
+        ASSERT_EQ(firstTiling->sohTiles, secondTiling->sohTiles);
+        ASSERT_EQ(firstTiling->sowTiles, secondTiling->sowTiles);
+        ASSERT_EQ(firstTiling->socTiles, secondTiling->socTiles);
+    }
+}
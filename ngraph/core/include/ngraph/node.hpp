@@ -10,6 +10,7 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <tuple>
@@ -37,6 +38,10 @@
 #include "ngraph/type.hpp"
 #include "ngraph/variant.hpp"
 
+namespace ov {
+class Function;
+}  // namespace ov
+
 namespace ngraph {
 template <typename NodeType>
 class Input;
@@ -46,6 +51,7 @@ class Output;
 
 class AttributeVisitor;
 class Node;
+class SharedRTInfo;
 
 namespace runtime {
 class HostTensor;
@@ -127,6 +133,9 @@ class NGRAPH_API Node : public std::enable_shared_from_this<Node> {
     template <typename NodeType>
     friend class Output;
 
+    // For access to m_shared_rt_info.
+    friend class ov::Function;
+
 public:
     /// \brief Verifies that attributes and inputs are consistent and computes output shapes
     /// and element types. Must be implemented by concrete child classes so that it
@@ -494,6 +503,11 @@ private:
     descriptor::Input& get_input_descriptor(size_t position);
     descriptor::Output& get_output_descriptor(size_t position);
 
+    /// \brief Registers the node as a part of the cached topological order of a Function
+    void insert_info(std::shared_ptr<SharedRTInfo> info);
+    /// \brief Invalidates the cached topological orders of all Functions the node belongs to
+    void invalidate_topological_cache();
+
     std::vector<Node*> m_control_dependents;
     std::vector<std::shared_ptr<Node>> m_control_dependencies;
     std::string m_node_type;
@@ -503,6 +517,11 @@ private:
     static std::atomic<size_t> m_next_instance_id;
     std::unordered_set<std::string> m_provenance_tags;
     std::set<std::shared_ptr<Node>> m_provenance_group;
+    // declared before the inputs since the inputs access them on destruction.
+    // The infos are owned by the Functions, the ones of the destroyed Functions are pruned on the next insertion
+    std::vector<std::weak_ptr<SharedRTInfo>> m_shared_rt_info;
+    // the nodes shared by several Functions may be sorted by them concurrently
+    std::mutex m_shared_rt_info_mutex;
     std::deque<descriptor::Input> m_inputs;
     std::deque<descriptor::Output> m_outputs;
     NGRAPH_SUPPRESS_DEPRECATED_START
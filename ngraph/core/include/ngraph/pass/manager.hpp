@@ -14,6 +14,8 @@
 
 namespace ngraph {
 namespace pass {
+class Profiler;
+
 class NGRAPH_API Manager {
 public:
     Manager();
@@ -58,6 +60,11 @@ public:
     void set_per_pass_validation(bool new_state) {
         m_per_pass_validation = new_state;
     }
+    /// \brief Set the profiler the passes of this manager and of the managers nested into them
+    /// report to. The manager without own profiler reports to the profiler active for the thread.
+    void set_profiler(std::shared_ptr<Profiler> profiler) {
+        m_profiler = std::move(profiler);
+    }
     /// \brief Callback is a lambda function that can be used by registered transformations.
     /// The main purpose of this callback is to provide a way for plugins to disable/enable
     /// transformations based on some conditions. In some cases plugins may want not to
@@ -108,6 +115,7 @@ protected:
     }
 
     std::shared_ptr<PassConfig> m_pass_config;
+    std::shared_ptr<Profiler> m_profiler;
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
     bool m_visualize = false;
     bool m_per_pass_validation = true;
@@ -0,0 +1,121 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph {
+namespace pass {
+/// \brief Collects the wall time and the node counts of the passes run by pass::Manager and of
+/// the other compilation stages reported by Profiler::Scope.
+///
+/// A profiler is active for a thread while a Profiler::Activation of it exists on that thread.
+/// Every pass::Manager run by the thread, including the managers nested into the passes,
+/// reports its passes to the active profiler. A profiler may be active for several threads at
+/// once, the records of every thread are nested by their time.
+///
+/// Example:
+///
+///     auto profiler = std::make_shared<pass::Profiler>();
+///     {
+///         pass::Profiler::Activation activation(profiler);
+///         manager.run_passes(f);
+///     }
+///     profiler->serialize(std::cout);
+class NGRAPH_API Profiler {
+public:
+    struct Record {
+        std::string name;
+        std::string category;
+        /// \brief Start from the creation of the profiler, in microseconds
+        int64_t start_us = 0;
+        int64_t duration_us = 0;
+        /// \brief Index of the thread in the order the threads reported to the profiler
+        size_t thread = 0;
+        /// \brief Number of the enclosing records of the same thread
+        size_t depth = 0;
+        /// \brief Number of the nodes before and after the pass, -1 if not known
+        int64_t nodes_before = -1;
+        int64_t nodes_after = -1;
+        /// \brief Number of the nodes allocated by the pass which remain after it, -1 if not known
+        int64_t nodes_created = -1;
+    };
+
+    /// \brief Makes the profiler active for the calling thread until the destruction
+    class NGRAPH_API Activation {
+    public:
+        explicit Activation(std::shared_ptr<Profiler> profiler);
+        ~Activation();
+
+        Activation(const Activation&) = delete;
+        Activation& operator=(const Activation&) = delete;
+
+    private:
+        std::shared_ptr<Profiler> m_previous;
+        size_t m_previous_depth;
+    };
+
+    /// \brief Records the time from the construction to the destruction to the profiler active
+    /// for the calling thread, does nothing if there is no active profiler
+    class NGRAPH_API Scope {
+    public:
+        Scope(std::string name, std::string category);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        /// \brief Sets the node counts of the record, ignored if the profiler doesn't count nodes
+        void set_nodes(int64_t before, int64_t after, int64_t created = -1);
+
+    private:
+        std::shared_ptr<Profiler> m_profiler;
+        Record m_record;
+    };
+
+    /// \param count_nodes Count the nodes of the function after every recorded pass.
+    /// Counting walks the whole function, so by default the passes are recorded with the time only.
+    explicit Profiler(bool count_nodes = false);
+
+    /// \return true if the pass managers report the node counts of the passes to the profiler
+    bool is_counting_nodes() const {
+        return m_count_nodes;
+    }
+
+    /// \return The profiler active for the calling thread or nullptr
+    static std::shared_ptr<Profiler> get_active();
+
+    /// \return Time from the creation of the profiler, in microseconds
+    int64_t now_us() const;
+
+    void add_record(Record record);
+
+    /// \return Records in the order of their completion
+    std::vector<Record> get_records() const;
+
+    /// \brief Writes the records in the JSON object format of the Chrome trace events, which can
+    /// be opened by chrome://tracing or Perfetto. The node counts are the arguments of the events.
+    void serialize(std::ostream& out) const;
+
+private:
+    const std::chrono::steady_clock::time_point m_origin;
+    const bool m_count_nodes;
+
+    mutable std::mutex m_mutex;
+    std::vector<Record> m_records;
+    std::unordered_map<std::thread::id, size_t> m_threads;
+};
+}  // namespace pass
+}  // namespace ngraph
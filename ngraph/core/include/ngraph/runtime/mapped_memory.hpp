@@ -0,0 +1,60 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "ngraph/ngraph_visibility.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
+
+namespace ngraph {
+namespace runtime {
+/// \brief Contents of a file mapped to the memory. The pages are loaded on demand and stay shared
+/// through the page cache with other processes mapping the same file.
+class NGRAPH_API MappedMemory {
+public:
+    /// \brief Maps the whole file read-only. While the mapping is alive, mapping the same unchanged
+    /// file again returns it instead of creating a new one, so the memory must never be written.
+    ///
+    /// \param path Path to the file
+    ///
+    /// \return The mapping or nullptr if mapping is not supported on the platform or failed
+    static std::shared_ptr<MappedMemory> map_file(const std::string& path);
+
+    /// \brief Creates a buffer over a part of the mapping for Constants referencing the file data.
+    /// The buffer keeps the mapping alive. Constants give only const access to the data they are
+    /// created with, so the mapping stays unwritten.
+    ///
+    /// \param memory The mapping
+    /// \param offset Offset of the data in the mapping
+    /// \param size Size of the data in bytes
+    ///
+    /// \return The buffer, throws if the data is out of the mapping bounds
+    static std::shared_ptr<SharedBuffer<std::shared_ptr<MappedMemory>>> make_buffer(
+        const std::shared_ptr<MappedMemory>& memory,
+        size_t offset,
+        size_t size);
+
+    MappedMemory(const MappedMemory&) = delete;
+    MappedMemory& operator=(const MappedMemory&) = delete;
+    ~MappedMemory();
+
+    const char* data() const {
+        return m_data;
+    }
+    size_t size() const {
+        return m_size;
+    }
+
+private:
+    MappedMemory(const char* data, size_t size) : m_data(data), m_size(size) {}
+
+    const char* m_data;
+    size_t m_size;
+};
+}  // namespace runtime
+}  // namespace ngraph
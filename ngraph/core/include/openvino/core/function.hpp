@@ -8,6 +8,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -121,6 +122,8 @@ public:
     const std::string& get_friendly_name() const;
 
     std::vector<std::shared_ptr<ngraph::Node>> get_ops() const;
+    /// \brief Returns the nodes of the function in topological order.
+    ///        The order is cached and recomputed only after the graph has changed.
     std::vector<std::shared_ptr<ngraph::Node>> get_ordered_ops() const;
     void map_unordered_ops(std::function<void(ngraph::Node*)> f) const;
 
@@ -263,6 +266,10 @@ private:
     const std::string m_unique_name;
     size_t m_placement{0};
     topological_sort_t m_topological_sorter;
+    // invalidated by the nodes of the cached order when their inputs or control dependencies change
+    std::shared_ptr<ngraph::SharedRTInfo> m_shared_rt_info;
+    mutable std::vector<std::weak_ptr<ngraph::Node>> m_cached_ordered_ops;
+    mutable std::mutex m_topological_sort_mutex;
 
     ngraph::ResultVector m_results;
     // List of the nodes with side effect in graph.
@@ -34,6 +34,7 @@ descriptor::Input::~Input() {
 }
 
 void descriptor::Input::replace_output(Output& new_output) {
+    m_node->invalidate_topological_cache();
     if (m_output != nullptr) {
         m_output->remove_input(this);
     }
@@ -55,6 +56,7 @@ void descriptor::Input::replace_output(std::shared_ptr<Node> node, size_t i) {
 
 void descriptor::Input::remove_output() {
     if (m_output != nullptr) {
+        m_node->invalidate_topological_cache();
         m_output->remove_input(this);
         m_src_node = nullptr;
         m_output = nullptr;
@@ -17,6 +17,7 @@
 #include "ngraph/op/util/variable_extension.hpp"
 #include "ngraph/opsets/opset7.hpp"
 #include "ngraph/validation_util.hpp"
+#include "shared_node_info.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -77,6 +78,7 @@ Function::Function(const ResultVector& results, const ParameterVector& parameter
     : m_name(name),
       m_unique_name("Function_" + to_string(m_next_instance_id.fetch_add(1))),
       m_topological_sorter(topological_sort<std::vector<std::shared_ptr<Node>>>),
+      m_shared_rt_info(std::make_shared<SharedRTInfo>()),
       m_results(results),
       m_parameters(parameters) {
     prerequirements(true, false);
@@ -86,6 +88,7 @@ Function::Function(const OutputVector& results, const ParameterVector& parameter
     : m_name(name),
       m_unique_name("Function_" + to_string(m_next_instance_id.fetch_add(1))),
       m_topological_sorter(topological_sort<std::vector<std::shared_ptr<Node>>>),
+      m_shared_rt_info(std::make_shared<SharedRTInfo>()),
       m_results(as_result_vector(results)),
       m_parameters(parameters) {
     prerequirements(true, false);
@@ -95,6 +98,7 @@ Function::Function(const NodeVector& results, const ParameterVector& parameters,
     : m_name(name),
       m_unique_name("Function_" + to_string(m_next_instance_id.fetch_add(1))),
       m_topological_sorter(topological_sort<std::vector<std::shared_ptr<Node>>>),
+      m_shared_rt_info(std::make_shared<SharedRTInfo>()),
       m_results(as_result_vector(as_output_vector(results))),
       m_parameters(parameters) {
     prerequirements(true, false);
@@ -110,6 +114,7 @@ Function::Function(const ResultVector& results,
     : m_name(name),
       m_unique_name("Function_" + to_string(m_next_instance_id.fetch_add(1))),
       m_topological_sorter(topological_sort<std::vector<std::shared_ptr<Node>>>),
+      m_shared_rt_info(std::make_shared<SharedRTInfo>()),
       m_results(results),
       m_sinks(sinks),
       m_parameters(parameters) {
@@ -130,6 +135,7 @@ Function::Function(const ResultVector& results,
     : m_name(name),
       m_unique_name("Function_" + to_string(m_next_instance_id.fetch_add(1))),
       m_topological_sorter(topological_sort<std::vector<std::shared_ptr<Node>>>),
+      m_shared_rt_info(std::make_shared<SharedRTInfo>()),
       m_results(results),
       m_sinks(sinks),
       m_parameters(parameters),
@@ -160,6 +166,7 @@ Function::Function(const OutputVector& results, const SinkVector& sinks, const s
     : m_name(name),
       m_unique_name("Function_" + to_string(m_next_instance_id.fetch_add(1))),
       m_topological_sorter(topological_sort<std::vector<std::shared_ptr<Node>>>),
+      m_shared_rt_info(std::make_shared<SharedRTInfo>()),
       m_results(as_result_vector(results)),
       m_sinks(sinks) {
     prerequirements(true, true);
@@ -224,8 +231,26 @@ void Function::validate_nodes_and_infer_types() const {
 
 std::vector<shared_ptr<Node>> Function::get_ordered_ops() const {
     OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "Function::get_ordered_ops");
+    lock_guard<mutex> lock(m_topological_sort_mutex);
 
     vector<shared_ptr<Node>> nodes;
+    if (m_shared_rt_info->get_use_topological_cache()) {
+        nodes.reserve(m_cached_ordered_ops.size());
+        for (const auto& cached : m_cached_ordered_ops) {
+            if (auto node = cached.lock()) {
+                nodes.push_back(std::move(node));
+            } else {
+                m_shared_rt_info->set_use_topological_cache(false);
+                break;
+            }
+        }
+        if (m_shared_rt_info->get_use_topological_cache()) {
+            OV_ITT_COUNTER_INC(ov::itt::domains::nGraph, "Function::get_ordered_ops cache hit");
+            return nodes;
+        }
+        nodes.clear();
+    }
+
     for (auto& r : get_results()) {
         nodes.push_back(r);
     }
@@ -236,7 +261,15 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const {
         nodes.push_back(param);
     }
 
-    return m_topological_sorter(nodes);
+    auto order = m_topological_sorter(nodes);
+    m_cached_ordered_ops.clear();
+    m_cached_ordered_ops.reserve(order.size());
+    for (const auto& node : order) {
+        node->insert_info(m_shared_rt_info);
+        m_cached_ordered_ops.emplace_back(node);
+    }
+    m_shared_rt_info->set_use_topological_cache(true);
+    return order;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const {
@@ -369,10 +402,12 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    m_shared_rt_info->set_use_topological_cache(false);
 }
 
 void Function::set_topological_sort(topological_sort_t sorter) {
     m_topological_sorter = sorter;
+    m_shared_rt_info->set_use_topological_cache(false);
 }
 
 int64_t Function::get_parameter_index(const std::shared_ptr<op::Parameter>& parameter) const {
@@ -437,6 +472,7 @@ bool Function::visit_attributes(AttributeVisitor& visitor) {
 }
 
 void Function::add_sinks(const SinkVector& sinks) {
+    m_shared_rt_info->set_use_topological_cache(false);
     m_sinks.insert(m_sinks.end(), sinks.begin(), sinks.end());
     for (const auto& sink : sinks) {
         if (const auto& variable_op = dynamic_pointer_cast<VariableExtension>(sink)) {
@@ -448,6 +484,7 @@ void Function::add_sinks(const SinkVector& sinks) {
 }
 
 void Function::remove_sink(const std::shared_ptr<op::Sink>& sink) {
+    m_shared_rt_info->set_use_topological_cache(false);
     m_sinks.erase(std::remove_if(m_sinks.begin(),
                                  m_sinks.end(),
                                  [&sink](std::shared_ptr<op::Sink>& s) {
@@ -457,10 +494,12 @@ void Function::remove_sink(const std::shared_ptr<op::Sink>& sink) {
 }
 
 void Function::add_results(const ResultVector& results) {
+    m_shared_rt_info->set_use_topological_cache(false);
     m_results.insert(m_results.end(), results.begin(), results.end());
 }
 
 void Function::remove_result(const std::shared_ptr<op::Result>& result) {
+    m_shared_rt_info->set_use_topological_cache(false);
     m_results.erase(std::remove_if(m_results.begin(),
                                    m_results.end(),
                                    [&result](std::shared_ptr<op::v0::Result>& r) {
@@ -479,10 +518,12 @@ void Function::add_parameters(const ParameterVector& params) {
                          j);
         }
     }
+    m_shared_rt_info->set_use_topological_cache(false);
     m_parameters.insert(m_parameters.end(), params.begin(), params.end());
 }
 
 void Function::remove_parameter(const std::shared_ptr<op::Parameter>& param) {
+    m_shared_rt_info->set_use_topological_cache(false);
     m_parameters.erase(std::remove_if(m_parameters.begin(),
                                       m_parameters.end(),
                                       [&param](std::shared_ptr<op::v0::Parameter>& r) {
@@ -17,6 +17,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/pattern/matcher.hpp"
+#include "shared_node_info.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -155,6 +156,7 @@ void Node::set_arguments(const NodeVector& arguments) {
 }
 
 void Node::set_arguments(const OutputVector& arguments) {
+    invalidate_topological_cache();
     // Add this node as a user of each argument.
     size_t i = 0;
     for (auto& output : arguments) {
@@ -180,6 +182,31 @@ descriptor::Output& Node::get_output_descriptor(size_t position) {
     return m_outputs[position];
 }
 
+void Node::insert_info(std::shared_ptr<SharedRTInfo> info) {
+    lock_guard<mutex> lock(m_shared_rt_info_mutex);
+    bool inserted = false;
+    m_shared_rt_info.erase(remove_if(m_shared_rt_info.begin(),
+                                     m_shared_rt_info.end(),
+                                     [&](const weak_ptr<SharedRTInfo>& item) {
+                                         const auto existing = item.lock();
+                                         inserted = inserted || existing == info;
+                                         return !existing;
+                                     }),
+                           m_shared_rt_info.end());
+    if (!inserted) {
+        m_shared_rt_info.emplace_back(std::move(info));
+    }
+}
+
+void Node::invalidate_topological_cache() {
+    lock_guard<mutex> lock(m_shared_rt_info_mutex);
+    for (const auto& item : m_shared_rt_info) {
+        if (const auto info = item.lock()) {
+            info->set_use_topological_cache(false);
+        }
+    }
+}
+
 void Node::set_argument(size_t position, const Output<Node>& argument) {
     auto output_node = argument.get_node();
     auto& output_descriptor = output_node->get_output_descriptor(argument.get_index());
@@ -390,6 +417,7 @@ const std::vector<Node*>& Node::get_control_dependents() const {
 
 void Node::add_control_dependency(std::shared_ptr<Node> node) {
     if (find(m_control_dependencies.begin(), m_control_dependencies.end(), node) == m_control_dependencies.end()) {
+        invalidate_topological_cache();
         m_control_dependencies.push_back(node);
         if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
             node->m_control_dependents.end()) {
@@ -419,6 +447,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node) {
     {
         auto it = find(m_control_dependencies.begin(), m_control_dependencies.end(), node);
         if (it != m_control_dependencies.end()) {
+            invalidate_topological_cache();
             m_control_dependencies.erase(it);
         }
     }
@@ -437,6 +466,7 @@ void Node::clear_control_dependencies() {
             node->m_control_dependents.erase(it);
         }
     }
+    invalidate_topological_cache();
     m_control_dependencies.clear();
 }
 
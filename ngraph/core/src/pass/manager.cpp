@@ -19,6 +19,7 @@
 #include "ngraph/node.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/pass.hpp"
+#include "ngraph/pass/profiler.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/util.hpp"
 #include "perf_counters.hpp"
@@ -37,6 +38,28 @@ PerfCounters& perf_counters() {
 }  // namespace pass
 }  // namespace ngraph
 
+namespace {
+struct NodeCount {
+    int64_t nodes = 0;
+    size_t max_instance_id = 0;
+    int64_t nodes_created = 0;
+};
+
+// nodes_created are the nodes allocated after the nodes of the previous count
+NodeCount count_nodes(const shared_ptr<Function>& func, const NodeCount& previous) {
+    NodeCount count;
+    for (const auto& node : func->get_ops()) {
+        const auto instance_id = node->get_instance_id();
+        count.nodes++;
+        count.max_instance_id = std::max(count.max_instance_id, instance_id);
+        if (instance_id > previous.max_instance_id) {
+            count.nodes_created++;
+        }
+    }
+    return count;
+}
+}  // namespace
+
 pass::Manager::Manager()
     : m_pass_config(std::make_shared<PassConfig>()),
       m_visualize(getenv_bool("NGRAPH_ENABLE_VISUALIZE_TRACING")) {}
@@ -50,6 +73,18 @@ void pass::Manager::run_passes(shared_ptr<Function> func) {
 
     static bool profile_enabled = getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
 
+    // the managers run by the passes report to the profiler of this manager too
+    const auto profiler = m_profiler ? m_profiler : Profiler::get_active();
+    std::unique_ptr<Profiler::Activation> profiler_activation;
+    if (m_profiler) {
+        profiler_activation.reset(new Profiler::Activation(m_profiler));
+    }
+    const bool count_nodes_enabled = profiler && profiler->is_counting_nodes();
+    NodeCount node_count;
+    if (count_nodes_enabled) {
+        node_count = count_nodes(func, node_count);
+    }
+
     size_t index = 0;
     stopwatch pass_timer;
     stopwatch overall_timer;
@@ -67,6 +102,13 @@ void pass::Manager::run_passes(shared_ptr<Function> func) {
 
         pass_timer.start();
 
+        // the passes skipped below are not recorded
+        std::unique_ptr<Profiler::Scope> profiler_scope;
+        if (profiler && !(pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && func->is_dynamic()) &&
+            !(dynamic_pointer_cast<Validate>(pass) && !function_changed)) {
+            profiler_scope.reset(new Profiler::Scope(pass->get_name(), "pass"));
+        }
+
         NGRAPH_SUPPRESS_DEPRECATED_START
         if (auto matcher_pass = dynamic_pointer_cast<MatcherPass>(pass)) {
             // This checks is to skip the graph transformation when the graph pass relies on
@@ -108,6 +150,14 @@ void pass::Manager::run_passes(shared_ptr<Function> func) {
         }
         NGRAPH_SUPPRESS_DEPRECATED_END
 
+        if (profiler_scope && count_nodes_enabled) {
+            // the passes don't always report the changes they make, so the nodes are counted after each of them
+            const auto nodes_before = node_count.nodes;
+            node_count = count_nodes(func, node_count);
+            profiler_scope->set_nodes(nodes_before, node_count.nodes, node_count.nodes_created);
+        }
+        profiler_scope.reset();
+
         if (m_visualize) {
             // visualizations and serializations will be named after the outermost function
             const size_t num_digits_in_pass_index = 3;
@@ -0,0 +1,138 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/pass/profiler.hpp"
+
+#include <iomanip>
+
+using namespace std;
+using namespace ngraph;
+
+namespace {
+struct ActiveProfiler {
+    shared_ptr<pass::Profiler> profiler;
+    // number of the scopes of the thread which are not finished yet
+    size_t depth = 0;
+};
+
+ActiveProfiler& active_profiler() {
+    static thread_local ActiveProfiler active;
+    return active;
+}
+
+void write_json_string(ostream& out, const string& str) {
+    out << '"';
+    for (const auto c : str) {
+        switch (c) {
+        case '"':
+            out << "\\\"";
+            break;
+        case '\\':
+            out << "\\\\";
+            break;
+        case '\n':
+            out << "\\n";
+            break;
+        case '\t':
+            out << "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                out << "\\u" << hex << setw(4) << setfill('0') << static_cast<int>(c) << dec << setfill(' ');
+            } else {
+                out << c;
+            }
+        }
+    }
+    out << '"';
+}
+}  // namespace
+
+pass::Profiler::Activation::Activation(shared_ptr<Profiler> profiler) {
+    auto& active = active_profiler();
+    m_previous = move(active.profiler);
+    m_previous_depth = active.depth;
+    active.profiler = move(profiler);
+    active.depth = 0;
+}
+
+pass::Profiler::Activation::~Activation() {
+    auto& active = active_profiler();
+    active.profiler = move(m_previous);
+    active.depth = m_previous_depth;
+}
+
+pass::Profiler::Scope::Scope(string name, string category) : m_profiler(get_active()) {
+    if (m_profiler) {
+        m_record.name = move(name);
+        m_record.category = move(category);
+        m_record.depth = active_profiler().depth++;
+        m_record.start_us = m_profiler->now_us();
+    }
+}
+
+pass::Profiler::Scope::~Scope() {
+    if (m_profiler) {
+        m_record.duration_us = m_profiler->now_us() - m_record.start_us;
+        active_profiler().depth--;
+        m_profiler->add_record(move(m_record));
+    }
+}
+
+void pass::Profiler::Scope::set_nodes(int64_t before, int64_t after, int64_t created) {
+    if (!m_profiler || !m_profiler->is_counting_nodes()) {
+        return;
+    }
+    m_record.nodes_before = before;
+    m_record.nodes_after = after;
+    m_record.nodes_created = created;
+}
+
+pass::Profiler::Profiler(bool count_nodes) : m_origin(chrono::steady_clock::now()), m_count_nodes(count_nodes) {}
+
+shared_ptr<pass::Profiler> pass::Profiler::get_active() {
+    return active_profiler().profiler;
+}
+
+int64_t pass::Profiler::now_us() const {
+    return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - m_origin).count();
+}
+
+void pass::Profiler::add_record(Record record) {
+    lock_guard<mutex> guard(m_mutex);
+    auto thread = m_threads.emplace(this_thread::get_id(), m_threads.size()).first;
+    record.thread = thread->second;
+    m_records.push_back(move(record));
+}
+
+vector<pass::Profiler::Record> pass::Profiler::get_records() const {
+    lock_guard<mutex> guard(m_mutex);
+    return m_records;
+}
+
+void pass::Profiler::serialize(ostream& out) const {
+    const auto records = get_records();
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    for (size_t i = 0; i < records.size(); i++) {
+        const auto& record = records[i];
+        out << (i == 0 ? "" : ",") << "\n{\"name\":";
+        write_json_string(out, record.name);
+        out << ",\"cat\":";
+        write_json_string(out, record.category);
+        out << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << record.thread << ",\"ts\":" << record.start_us
+            << ",\"dur\":" << record.duration_us << ",\"args\":{\"depth\":" << record.depth;
+        if (record.nodes_before >= 0) {
+            out << ",\"nodes_before\":" << record.nodes_before;
+        }
+        if (record.nodes_after >= 0) {
+            out << ",\"nodes_after\":" << record.nodes_after;
+        }
+        if (record.nodes_created >= 0) {
+            out << ",\"nodes_created\":" << record.nodes_created;
+        }
+        out << "}}";
+    }
+    out << "\n]}\n";
+}
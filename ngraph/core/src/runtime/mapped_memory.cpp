@@ -0,0 +1,108 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/runtime/mapped_memory.hpp"
+
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include <map>
+#include <mutex>
+
+#include "ngraph/check.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+shared_ptr<runtime::SharedBuffer<shared_ptr<runtime::MappedMemory>>> runtime::MappedMemory::make_buffer(
+    const shared_ptr<MappedMemory>& memory,
+    size_t offset,
+    size_t size) {
+    NGRAPH_CHECK(memory, "Buffer is created over an empty mapping");
+    NGRAPH_CHECK(offset <= memory->size() && size <= memory->size() - offset,
+                 "Buffer of ",
+                 size,
+                 " bytes at offset ",
+                 offset,
+                 " is out of the mapping of ",
+                 memory->size(),
+                 " bytes");
+    // the only writable pointer to the mapping, SharedBuffer stores the data as char*
+    return make_shared<SharedBuffer<shared_ptr<MappedMemory>>>(const_cast<char*>(memory->data()) + offset,
+                                                                size,
+                                                                memory);
+}
+
+#ifndef _WIN32
+
+namespace {
+struct CachedMapping {
+    off_t size;
+    time_t mtime;
+    weak_ptr<runtime::MappedMemory> memory;
+};
+
+mutex cache_mutex;
+map<string, CachedMapping> cache;
+}  // namespace
+
+shared_ptr<runtime::MappedMemory> runtime::MappedMemory::map_file(const string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        return nullptr;
+    }
+    struct stat file_stat = {};
+    if (::fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    lock_guard<mutex> lock{cache_mutex};
+    auto it = cache.find(path);
+    if (it != cache.end()) {
+        auto memory = it->second.memory.lock();
+        if (memory && it->second.size == file_stat.st_size && it->second.mtime == file_stat.st_mtime) {
+            ::close(fd);
+            return memory;
+        }
+        cache.erase(it);
+    }
+    // entries of the released mappings are dropped here instead of in the destructor, so the
+    // destructor never waits for the lock
+    for (auto entry = cache.begin(); entry != cache.end();) {
+        if (entry->second.memory.expired())
+            entry = cache.erase(entry);
+        else
+            ++entry;
+    }
+
+    const auto size = static_cast<size_t>(file_stat.st_size);
+    void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // mapping holds its own reference to the file
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        return nullptr;
+    }
+    shared_ptr<MappedMemory> memory{new MappedMemory{static_cast<const char*>(data), size}};
+    cache[path] = CachedMapping{file_stat.st_size, file_stat.st_mtime, memory};
+    return memory;
+}
+
+runtime::MappedMemory::~MappedMemory() {
+    ::munmap(const_cast<char*>(m_data), m_size);
+}
+
+#else
+
+shared_ptr<runtime::MappedMemory> runtime::MappedMemory::map_file(const string&) {
+    return nullptr;
+}
+
+runtime::MappedMemory::~MappedMemory() {}
+
+#endif
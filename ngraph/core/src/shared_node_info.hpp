@@ -0,0 +1,28 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+
+namespace ngraph {
+/// \brief State shared between a Function and the nodes it consists of.
+///
+/// Every node of the cached topological order references the info of the Function, so any
+/// change of the node connections invalidates the cached order of all Functions the node
+/// belongs to.
+class SharedRTInfo {
+public:
+    void set_use_topological_cache(bool use) {
+        m_use_topological_cache = use;
+    }
+
+    bool get_use_topological_cache() const {
+        return m_use_topological_cache;
+    }
+
+private:
+    std::atomic<bool> m_use_topological_cache{false};
+};
+}  // namespace ngraph
@@ -7,10 +7,13 @@
 #include <onnx/onnx_pb.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <memory>
 #include <utility>
 #include <vector>
 
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "onnx_common/utils.hpp"
@@ -93,7 +96,8 @@ inline std::vector<T> get_external_data(const ONNX_NAMESPACE::TensorProto& tenso
     const auto tensor_external_data = TensorExternalData(tensor);
     const auto raw_data = tensor_external_data.load_external_data();
 
-    return detail::__get_raw_data<T>(raw_data, tensor.data_type());
+    auto it = raw_data->get_ptr<T>();
+    return std::vector<T>(it, it + (raw_data->size() / onnx_common::get_onnx_data_size(tensor.data_type())));
 }
 
 bool has_tensor_external_data(const ONNX_NAMESPACE::TensorProto& tensor) {
@@ -352,8 +356,15 @@ public:
     };
 
     Tensor() = delete;
-    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor) : Tensor(tensor, nullptr) {}
+
+    /// \param tensor      Tensor proto
+    /// \param model_proto Model which owns the tensor proto. If it is set, the constant created from
+    ///                    the raw data of the tensor references the data and keeps the model alive
+    ///                    instead of copying the data.
+    Tensor(const ONNX_NAMESPACE::TensorProto& tensor, std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto)
         : m_tensor_proto{&tensor},
+          m_model_proto{std::move(model_proto)},
           m_shape{std::begin(tensor.dims()), std::end(tensor.dims())} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
@@ -469,9 +480,46 @@ public:
     }
 
 private:
+    // the bytes are used by the constant as they are if they have exactly its size and alignment
+    bool is_constant_data(const void* data, size_t byte_size, const element::Type& type) const {
+        return byte_size != 0 && byte_size == shape_size(m_shape) * type.size() &&
+               reinterpret_cast<uintptr_t>(data) % type.size() == 0;
+    }
+
     template <typename T>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
-        auto constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+        if (m_tensor_proto->has_segment()) {
+            throw error::tensor::segments_unsupported{};
+        }
+        std::shared_ptr<ngraph::op::Constant> constant;
+        if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto)) {
+            // external data is a slice of the memory-mapped file, the constant references it
+            auto buffer = detail::TensorExternalData(*m_tensor_proto).load_external_data();
+            if (is_constant_data(buffer->get_ptr(), buffer->size(), type)) {
+                auto shared_buffer = std::make_shared<runtime::SharedBuffer<std::shared_ptr<runtime::AlignedBuffer>>>(
+                    buffer->get_ptr<char>(),
+                    buffer->size(),
+                    buffer);
+                constant = std::make_shared<ngraph::op::Constant>(type, m_shape, shared_buffer);
+            }
+        } else if (m_tensor_proto->has_raw_data()) {
+            const auto& raw_data = m_tensor_proto->raw_data();
+            if (is_constant_data(raw_data.data(), raw_data.size(), type)) {
+                if (m_model_proto) {
+                    auto shared_buffer =
+                        std::make_shared<runtime::SharedBuffer<std::shared_ptr<ONNX_NAMESPACE::ModelProto>>>(
+                            const_cast<char*>(raw_data.data()),
+                            raw_data.size(),
+                            m_model_proto);
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, shared_buffer);
+                } else {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, raw_data.data());
+                }
+            }
+        }
+        if (!constant) {
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+        }
         if (m_tensor_proto->has_name()) {
             constant->set_friendly_name(get_name());
         }
@@ -479,6 +527,7 @@ private:
     }
 
     const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
+    std::shared_ptr<ONNX_NAMESPACE::ModelProto> m_model_proto;
     Shape m_shape;
 };
 
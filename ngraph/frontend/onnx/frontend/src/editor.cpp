@@ -191,6 +191,15 @@ struct onnx_editor::ONNXModelEditor::Impl {
 
     Impl(const std::string& model_path)
         : m_model_proto{std::make_shared<ONNX_NAMESPACE::ModelProto>(onnx_common::parse_from_file(model_path))} {}
+
+    // constants of the functions converted from the model reference the raw data of its initializers,
+    // so the model is copied before its initializers are modified
+    void detach_model_proto() {
+        if (m_model_proto.use_count() > 1) {
+            m_model_proto = std::make_shared<ONNX_NAMESPACE::ModelProto>(*m_model_proto);
+            m_is_mapper_updated = false;
+        }
+    }
 };
 
 onnx_editor::ONNXModelEditor::ONNXModelEditor(const std::string& model_path)
@@ -287,6 +296,7 @@ void onnx_editor::ONNXModelEditor::cut_graph_fragment(const std::vector<InputEdg
         return;
     }
 
+    m_pimpl->detach_model_proto();
     InferShapesAutoRelease onnx_shapes(m_pimpl->m_model_proto);
     onnx_shapes.infer_shapes();
 
@@ -365,6 +375,7 @@ std::shared_ptr<Function> onnx_editor::ONNXModelEditor::get_function() const {
 
 void onnx_editor::ONNXModelEditor::set_input_values(
     const std::map<std::string, std::shared_ptr<ngraph::op::Constant>>& input_values) {
+    m_pimpl->detach_model_proto();
     auto onnx_graph = m_pimpl->m_model_proto->mutable_graph();
 
     for (const auto& input : input_values) {
@@ -10,6 +10,8 @@
 #include "exceptions.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/runtime/mapped_memory.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 
 namespace ngraph {
 namespace onnx_import {
@@ -19,15 +21,27 @@ TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor
         if (entry.key() == "location")
             m_data_location = entry.value();
         if (entry.key() == "offset")
-            m_offset = std::stoi(entry.value());
+            m_offset = std::stoull(entry.value());
         if (entry.key() == "length")
-            m_data_length = std::stoi(entry.value());
+            m_data_length = std::stoull(entry.value());
         if (entry.key() == "checksum")
             m_sha1_digest = std::stoi(entry.value());
     }
 }
 
-std::string TensorExternalData::load_external_data() const {
+std::shared_ptr<ngraph::runtime::AlignedBuffer> TensorExternalData::load_external_data() const {
+    if (m_sha1_digest != 0) {
+        NGRAPH_WARN << "SHA1 checksum is not supported";
+    }
+
+    if (auto mapped_memory = runtime::MappedMemory::map_file(m_data_location)) {
+        if (m_offset > mapped_memory->size() || m_data_length > mapped_memory->size() - m_offset)
+            throw error::invalid_external_data{*this};
+        // default value of m_offset is 0, zero m_data_length means the rest of the file
+        const auto data_length = m_data_length == 0 ? mapped_memory->size() - m_offset : m_data_length;
+        return runtime::MappedMemory::make_buffer(mapped_memory, m_offset, data_length);
+    }
+
     NGRAPH_SUPPRESS_DEPRECATED_START
 #if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
     std::wstring path = file_util::multi_byte_char_to_wstring(m_data_location.c_str());
@@ -39,28 +53,19 @@ std::string TensorExternalData::load_external_data() const {
     if (external_data_stream.fail())
         throw error::invalid_external_data{*this};
 
-    std::streamsize read_data_length;
-    if (m_data_length == 0)  // read entire file
-        read_data_length = external_data_stream.tellg();
-    else
-        read_data_length = m_data_length;
-
-    const auto page_size = 4096;
-    if (m_offset != 0 && m_offset % page_size != 0) {
-        NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                       "support, current value is "
-                    << m_offset;
-    }
-    // default value of m_offset is 0
+    const uint64_t file_size = external_data_stream.tellg();
+    if (m_offset > file_size || m_data_length > file_size - m_offset)
+        throw error::invalid_external_data{*this};
+    const auto data_length = m_data_length == 0 ? file_size - m_offset : m_data_length;
     external_data_stream.seekg(m_offset, std::ios::beg);
 
-    if (m_sha1_digest != 0) {
-        NGRAPH_WARN << "SHA1 checksum is not supported";
-    }
-
-    std::string read_data;
-    read_data.resize(read_data_length);
-    external_data_stream.read(&read_data[0], read_data_length);
+    if (data_length == 0)
+        return std::make_shared<runtime::AlignedBuffer>();
+    // the data is read straight into the buffer of the constant
+    auto read_data = std::make_shared<runtime::AlignedBuffer>(data_length);
+    external_data_stream.read(read_data->get_ptr<char>(), data_length);
+    if (external_data_stream.fail())
+        throw error::invalid_external_data{*this};
     external_data_stream.close();
 
     return read_data;
@@ -6,6 +6,12 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
@@ -16,12 +22,14 @@ public:
 
     /// \brief      Load external data from tensor passed to constructor
     ///
-    /// \note       If read data from external file fails,
+    /// \note       The data is a slice of the memory-mapped file, so it is not copied
+    ///             and its pages are loaded on demand. If the file cannot be mapped,
+    ///             it is read into a buffer.
     /// \note       If reading data from external files fails,
     ///             the invalid_external_data exception is thrown.
     ///
-    /// \return     External binary data loaded into a std::string
-    std::string load_external_data() const;
+    /// \return     Buffer with the external binary data
+    std::shared_ptr<ngraph::runtime::AlignedBuffer> load_external_data() const;
 
     /// \brief      Represets parameter of external data as string
     ///
@@ -30,8 +38,8 @@ public:
 
 private:
     std::string m_data_location{};
-    int m_offset = 0;
-    int m_data_length = 0;
+    uint64_t m_offset = 0;
+    uint64_t m_data_length = 0;
     int m_sha1_digest = 0;
 };
 }  // namespace detail
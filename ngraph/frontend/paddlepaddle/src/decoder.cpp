@@ -14,12 +14,13 @@
 #include <vector>
 
 #include "framework.pb.h"
+#include "frontend_manager/frontend_exceptions.hpp"
 
 namespace ngraph {
 namespace frontend {
 using namespace paddle::framework;
 
-std::map<paddle::framework::proto::VarType_Type, ngraph::element::Type> TYPE_MAP{
+const std::map<paddle::framework::proto::VarType_Type, ngraph::element::Type> TYPE_MAP{
     {proto::VarType_Type::VarType_Type_BOOL, ngraph::element::boolean},
     {proto::VarType_Type::VarType_Type_INT16, ngraph::element::i16},
     {proto::VarType_Type::VarType_Type_INT32, ngraph::element::i32},
@@ -31,6 +32,15 @@ std::map<paddle::framework::proto::VarType_Type, ngraph::element::Type> TYPE_MAP
     {proto::VarType_Type::VarType_Type_INT8, ngraph::element::i8},
     {proto::VarType_Type::VarType_Type_BF16, ngraph::element::bf16}};
 
+ngraph::element::Type get_ng_type(paddle::framework::proto::VarType_Type data_type) {
+    const auto it = TYPE_MAP.find(data_type);
+    FRONT_END_GENERAL_CHECK(it != TYPE_MAP.end(),
+                            "Data type ",
+                            static_cast<int>(data_type),
+                            " is not supported by the PaddlePaddle frontend.");
+    return it->second;
+}
+
 std::shared_ptr<Variant> DecoderPDPDProto::get_attribute(const std::string& name,
                                                          const VariantTypeInfo& type_info) const {
     auto attrs = decode_attribute_helper(name);
@@ -57,7 +67,7 @@ std::shared_ptr<Variant> DecoderPDPDProto::get_attribute(const std::string& name
         return std::make_shared<VariantWrapper<std::vector<float>>>(floats);
     } else if (type_info == VariantWrapper<ngraph::element::Type>::type_info) {
         auto data_type = (paddle::framework::proto::VarType_Type)attrs[0].i();
-        return std::make_shared<VariantWrapper<ngraph::element::Type>>(TYPE_MAP[data_type]);
+        return std::make_shared<VariantWrapper<ngraph::element::Type>>(get_ng_type(data_type));
     } else if (type_info == VariantWrapper<bool>::type_info) {
         return std::make_shared<VariantWrapper<bool>>(attrs[0].b());
     }
@@ -21,7 +21,10 @@
 
 namespace ngraph {
 namespace frontend {
-extern std::map<paddle::framework::proto::VarType_Type, ngraph::element::Type> TYPE_MAP;
+extern const std::map<paddle::framework::proto::VarType_Type, ngraph::element::Type> TYPE_MAP;
+
+/// \brief Returns the element type of the PaddlePaddle data type, throws if the data type is not supported
+ngraph::element::Type get_ng_type(paddle::framework::proto::VarType_Type data_type);
 
 class DecoderPDPDProto : public pdpd::DecoderBase {
 public:
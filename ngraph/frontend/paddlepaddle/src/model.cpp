@@ -2,12 +2,20 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <exception>
 #include <fstream>
+#include <future>
 #include <ngraph/opsets/opset7.hpp>
+#include <ngraph/runtime/mapped_memory.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
 #include <paddlepaddle_frontend/exceptions.hpp>
 #include <paddlepaddle_frontend/model.hpp>
 #include <paddlepaddle_frontend/place.hpp>
 #include <queue>
+#include <thread>
 
 #include "decoder.hpp"
 #include "framework.pb.h"
@@ -52,6 +60,8 @@ private:
     void loadPlaces();
     template <typename T>
     void loadConsts(const std::basic_string<T>& folder_with_weights, std::istream* weight_stream);
+    void loadConsts(const std::shared_ptr<runtime::MappedMemory>& weights);
+    std::vector<std::shared_ptr<TensorPlacePDPD>> getConstPlaces() const;
     std::vector<std::shared_ptr<OpPlacePDPD>> determine_cut_nodes() const;
 
     std::vector<std::shared_ptr<OpPlacePDPD>> m_op_places;
@@ -118,7 +128,7 @@ void InputModelPDPD::InputModelPDPDImpl::loadPlaces() {
                 const auto& tensor_desc = var_place->get_desc().type().lod_tensor().tensor();
                 const auto& dims = tensor_desc.dims();
 
-                var_place->set_element_type(TYPE_MAP[tensor_desc.data_type()]);
+                var_place->set_element_type(get_ng_type(tensor_desc.data_type()));
                 var_place->set_partial_shape(PartialShape(std::vector<Dimension>(dims.begin(), dims.end())));
                 m_inputs.push_back(var_place);
             } else if (op.type() == "fetch") {
@@ -130,9 +140,13 @@ void InputModelPDPD::InputModelPDPDImpl::loadPlaces() {
 }
 
 namespace pdpd {
+// Tensor in the weights starts with the header: version (4 bytes), LoD level (8 bytes), version of
+// the tensor (4 bytes) and the size of the tensor description (4 bytes) followed by the description
+const size_t TENSOR_HEADER_SIZE = 16;
+
 bool read_tensor(std::istream& is, char* data, size_t len) {
-    std::vector<char> header(16);
-    is.read(&header[0], 16);
+    std::vector<char> header(TENSOR_HEADER_SIZE);
+    is.read(&header[0], TENSOR_HEADER_SIZE);
     uint32_t dims_len = 0;
     is.read(reinterpret_cast<char*>(&dims_len), 4);
     std::vector<char> dims_struct(dims_len);
@@ -143,6 +157,87 @@ bool read_tensor(std::istream& is, char* data, size_t len) {
     return true;
 }
 
+// Skips the header of the tensor which starts at the offset in the mapped weights and moves the
+// offset to the next tensor. Returns the data of the tensor or nullptr if the weights are too short.
+const char* parse_tensor(const runtime::MappedMemory& weights, size_t& offset, size_t len) {
+    const auto size = weights.size();
+    uint32_t dims_len = 0;
+    if (offset > size || size - offset < TENSOR_HEADER_SIZE + sizeof(dims_len))
+        return nullptr;
+    std::memcpy(&dims_len, weights.data() + offset + TENSOR_HEADER_SIZE, sizeof(dims_len));
+    offset += TENSOR_HEADER_SIZE + sizeof(dims_len);
+    if (size - offset < dims_len || size - offset - dims_len < len)
+        return nullptr;
+    offset += dims_len;
+    const char* data = weights.data() + offset;
+    offset += len;
+    return data;
+}
+
+// Constant references the data in the mapping if it is aligned to the element type, the unaligned
+// data is copied
+std::shared_ptr<opset7::Constant> make_constant(const element::Type& type,
+                                                const Shape& shape,
+                                                const char* data,
+                                                const std::shared_ptr<runtime::MappedMemory>& weights) {
+    if (reinterpret_cast<uintptr_t>(data) % type.size() != 0) {
+        return opset7::Constant::create(type, shape, data);
+    }
+    auto buffer =
+        runtime::MappedMemory::make_buffer(weights, data - weights->data(), shape_size(shape) * type.size());
+    return std::make_shared<opset7::Constant>(type, shape, buffer);
+}
+
+template <typename T>
+std::shared_ptr<runtime::MappedMemory> map_weights(const std::basic_string<T>& path) {
+    return runtime::MappedMemory::map_file(path);
+}
+
+#if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+template <>
+std::shared_ptr<runtime::MappedMemory> map_weights(const std::basic_string<wchar_t>& path) {
+    // files are not mapped on Windows
+    return nullptr;
+}
+#endif
+
+// Calls func for each index in [0, count) on a pool of std::async workers, no more than the hardware
+// threads. After the first exception thrown by func the workers take no new indices, it is rethrown when
+// all of them stop.
+template <typename F>
+void parallel_for(size_t count, const F& func) {
+    const size_t workers_num = std::min<size_t>(count, std::max(1u, std::thread::hardware_concurrency()));
+    std::atomic<size_t> next{0};
+    auto worker = [&] {
+        try {
+            for (size_t i = next++; i < count; i = next++)
+                func(i);
+        } catch (...) {
+            next = count;
+            throw;
+        }
+    };
+    std::vector<std::future<void>> workers;
+    for (size_t i = 1; i < workers_num; i++)
+        workers.push_back(std::async(std::launch::async, worker));
+    std::exception_ptr exception;
+    try {
+        worker();
+    } catch (...) {
+        exception = std::current_exception();
+    }
+    for (auto& w : workers) {
+        try {
+            w.get();
+        } catch (...) {
+            if (!exception)
+                exception = std::current_exception();
+        }
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
 template <typename T>
 std::basic_string<T> get_const_path(const std::basic_string<T>& folder_with_weights, const std::string& name) {
     return folder_with_weights + pdpd::get_path_sep<T>() + name;
@@ -158,16 +253,13 @@ std::basic_string<wchar_t> get_const_path(const std::basic_string<wchar_t>& fold
 #endif
 
 template <typename T>
-std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstream* weights_stream) {
+std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::basic_string<T>* weights_file) {
     std::string model_file{path};
     std::string ext = ".pdmodel";
     if (pdpd::endsWith(model_file, ext)) {
         std::string params_ext = ".pdiparams";
-        std::string weights_file{path};
-        weights_file.replace(weights_file.size() - ext.size(), ext.size(), params_ext);
-        weights_stream->open(weights_file, std::ios::binary);
-        // Don't throw error if file isn't opened
-        // It may mean that model don't have constants
+        *weights_file = path;
+        weights_file->replace(weights_file->size() - ext.size(), ext.size(), params_ext);
     } else {
         model_file += pdpd::get_path_sep<T>() + "__model__";
     }
@@ -176,16 +268,14 @@ std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstr
 
 #if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
 template <>
-std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path, std::ifstream* weights_stream) {
+std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path,
+                                          std::basic_string<wchar_t>* weights_file) {
     std::wstring model_file{path};
     std::wstring ext = L".pdmodel";
     if (pdpd::endsWith(model_file, ext)) {
         std::wstring params_ext = L".pdiparams";
-        std::wstring weights_file{path};
-        weights_file.replace(weights_file.size() - ext.size(), ext.size(), params_ext);
-        weights_stream->open(weights_file, std::ios::binary);
-        // Don't throw error if file isn't opened
-        // It may mean that model don't have constants
+        *weights_file = path;
+        weights_file->replace(weights_file->size() - ext.size(), ext.size(), params_ext);
     } else {
         model_file += pdpd::get_path_sep<wchar_t>() + L"__model__";
     }
@@ -240,9 +330,8 @@ std::vector<std::shared_ptr<OpPlacePDPD>> InputModelPDPD::InputModelPDPDImpl::de
     return new_op_places;
 }
 
-template <typename T>
-void InputModelPDPD::InputModelPDPDImpl::loadConsts(const std::basic_string<T>& folder_with_weights,
-                                                    std::istream* weight_stream) {
+std::vector<std::shared_ptr<TensorPlacePDPD>> InputModelPDPD::InputModelPDPDImpl::getConstPlaces() const {
+    std::vector<std::shared_ptr<TensorPlacePDPD>> const_places;
     for (const auto& item : m_var_places) {
         const auto& var_desc = item.second->get_desc();
         const auto& name = item.first;
@@ -252,30 +341,100 @@ void InputModelPDPD::InputModelPDPDImpl::loadConsts(const std::basic_string<T>&
             continue;
 
         FRONT_END_GENERAL_CHECK(var_desc.type().type() == paddle::framework::proto::VarType::LOD_TENSOR);
-        const auto& tensor = var_desc.type().lod_tensor().tensor();
-        Shape shape(tensor.dims().cbegin(), tensor.dims().cend());
-        const auto& type = TYPE_MAP[tensor.data_type()];
-        const auto& data_length = shape_size(shape) * type.size();
-        std::vector<uint8_t> tensor_data(data_length);
-
-        bool read_succeed = false;
-        if (weight_stream) {
-            read_succeed = pdpd::read_tensor(*weight_stream, reinterpret_cast<char*>(&tensor_data[0]), data_length);
-        } else if (!folder_with_weights.empty()) {
-            std::ifstream is(pdpd::get_const_path(folder_with_weights, name), std::ios::in | std::ifstream::binary);
-            FRONT_END_GENERAL_CHECK(is && is.is_open(), "Cannot open file for constant value.");
-            read_succeed = pdpd::read_tensor(is, reinterpret_cast<char*>(&tensor_data[0]), data_length);
+        const_places.push_back(item.second);
+    }
+    return const_places;
+}
+
+namespace pdpd {
+struct ConstDesc {
+    explicit ConstDesc(const std::shared_ptr<TensorPlacePDPD>& place)
+        : name{place->get_desc().name()} {
+        const auto& tensor = place->get_desc().type().lod_tensor().tensor();
+        shape = Shape(tensor.dims().cbegin(), tensor.dims().cend());
+        type = get_ng_type(tensor.data_type());
+        data_length = shape_size(shape) * type.size();
+    }
+
+    std::string name;
+    Shape shape;
+    element::Type type;
+    size_t data_length;
+};
+}  // namespace pdpd
+
+template <typename T>
+void InputModelPDPD::InputModelPDPDImpl::loadConsts(const std::basic_string<T>& folder_with_weights,
+                                                    std::istream* weight_stream) {
+    const auto const_places = getConstPlaces();
+    if (weight_stream) {
+        for (const auto& place : const_places) {
+            const pdpd::ConstDesc desc{place};
+            std::vector<uint8_t> tensor_data(desc.data_length);
+            const bool read_succeed =
+                pdpd::read_tensor(*weight_stream, reinterpret_cast<char*>(tensor_data.data()), desc.data_length);
+            FRONT_END_GENERAL_CHECK(read_succeed,
+                                    "File containing constant with name ",
+                                    desc.name,
+                                    " wasn't successfully read.");
+
+            auto const_node = opset7::Constant::create(desc.type, desc.shape, tensor_data.data());
+            const_node->set_friendly_name(desc.name);
+            m_tensor_values[desc.name] = const_node;
+        }
+        return;
+    }
+    FRONT_END_GENERAL_CHECK(!folder_with_weights.empty() || const_places.empty(),
+                            "Either folder with weights or stream must be provided.");
+
+    // each constant is stored in its own file, the files are mapped or read in parallel
+    std::vector<std::shared_ptr<opset7::Constant>> const_nodes(const_places.size());
+    pdpd::parallel_for(const_places.size(), [&](size_t i) {
+        const pdpd::ConstDesc desc{const_places[i]};
+        const auto path = pdpd::get_const_path(folder_with_weights, desc.name);
+        std::shared_ptr<opset7::Constant> const_node;
+        if (auto weights = pdpd::map_weights(path)) {
+            size_t offset = 0;
+            const char* data = pdpd::parse_tensor(*weights, offset, desc.data_length);
+            FRONT_END_GENERAL_CHECK(data != nullptr,
+                                    "File containing constant with name ",
+                                    desc.name,
+                                    " wasn't successfully read.");
+            const_node = pdpd::make_constant(desc.type, desc.shape, data, weights);
         } else {
-            FRONT_END_GENERAL_CHECK(false, "Either folder with weights or stream must be provided.");
+            std::ifstream is(path, std::ios::in | std::ifstream::binary);
+            FRONT_END_GENERAL_CHECK(is && is.is_open(), "Cannot open file for constant value.");
+            std::vector<uint8_t> tensor_data(desc.data_length);
+            const bool read_succeed =
+                pdpd::read_tensor(is, reinterpret_cast<char*>(tensor_data.data()), desc.data_length);
+            FRONT_END_GENERAL_CHECK(read_succeed,
+                                    "File containing constant with name ",
+                                    desc.name,
+                                    " wasn't successfully read.");
+            const_node = opset7::Constant::create(desc.type, desc.shape, tensor_data.data());
         }
-        FRONT_END_GENERAL_CHECK(read_succeed,
+        const_node->set_friendly_name(desc.name);
+        const_nodes[i] = const_node;
+    });
+    for (const auto& const_node : const_nodes) {
+        m_tensor_values[const_node->get_friendly_name()] = const_node;
+    }
+}
+
+void InputModelPDPD::InputModelPDPDImpl::loadConsts(const std::shared_ptr<runtime::MappedMemory>& weights) {
+    // the headers of the tensors are parsed in place and the constants reference the data in the mapping
+    size_t offset = 0;
+    for (const auto& place : getConstPlaces()) {
+        const pdpd::ConstDesc desc{place};
+        const char* data = pdpd::parse_tensor(*weights, offset, desc.data_length);
+        FRONT_END_GENERAL_CHECK(data != nullptr,
                                 "File containing constant with name ",
-                                name,
+                                desc.name,
                                 " wasn't successfully read.");
 
-        auto const_node = opset7::Constant::create(type, shape, &tensor_data[0]);
-        const_node->set_friendly_name(name);
-        m_tensor_values[name] = const_node;
+        auto const_node = pdpd::make_constant(desc.type, desc.shape, data, weights);
+        const_node->set_friendly_name(desc.name);
+        m_tensor_values[desc.name] = const_node;
     }
 }
 
@@ -283,15 +442,26 @@ template <typename T>
 InputModelPDPD::InputModelPDPDImpl::InputModelPDPDImpl(const std::basic_string<T>& path, const InputModel& input_model)
     : m_fw_ptr{std::make_shared<ProgramDesc>()},
       m_input_model(input_model) {
-    std::string empty_str = "";
-    std::ifstream weights_stream;
-    std::ifstream pb_stream(pdpd::get_model_path<T>(path, &weights_stream), std::ios::in | std::ifstream::binary);
+    std::basic_string<T> weights_file;
+    std::ifstream pb_stream(pdpd::get_model_path<T>(path, &weights_file), std::ios::in | std::ifstream::binary);
 
     FRONT_END_GENERAL_CHECK(pb_stream && pb_stream.is_open(), "Model file doesn't exist");
     FRONT_END_GENERAL_CHECK(m_fw_ptr->ParseFromIstream(&pb_stream), "Model can't be parsed");
 
     loadPlaces();
-    if (weights_stream && weights_stream.is_open()) {
+    std::shared_ptr<runtime::MappedMemory> weights;
+    std::ifstream weights_stream;
+    if (!weights_file.empty()) {
+        weights = pdpd::map_weights(weights_file);
+        if (!weights) {
+            // Don't throw error if file isn't opened
+            // It may mean that model don't have constants
+            weights_stream.open(weights_file, std::ios::binary);
+        }
+    }
+    if (weights) {
+        loadConsts(weights);
+    } else if (weights_stream && weights_stream.is_open()) {
         loadConsts(std::basic_string<T>{}, &weights_stream);
     } else {
         loadConsts(path, nullptr);
@@ -203,7 +203,7 @@ TensorPlacePDPD::TensorPlacePDPD(const InputModel& input_model,
     const auto& var_type = var_desc.type();
     if (var_type.type() == paddle::framework::proto::VarType::LOD_TENSOR) {
         const auto& tensor_desc = var_type.lod_tensor().tensor();
-        m_type = TYPE_MAP[tensor_desc.data_type()];
+        m_type = get_ng_type(tensor_desc.data_type());
         m_pshape = PartialShape(std::vector<Dimension>(tensor_desc.dims().begin(), tensor_desc.dims().end()));
     }
 }
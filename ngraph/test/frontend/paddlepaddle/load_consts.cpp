@@ -0,0 +1,62 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <frontend_manager/frontend_manager.hpp>
+#include <fstream>
+#include <map>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "paddle_utils.hpp"
+#include "utils.hpp"
+
+using namespace ngraph;
+using namespace ngraph::frontend;
+
+namespace {
+std::map<std::string, std::shared_ptr<opset6::Constant>> get_constants(const std::shared_ptr<Function>& function) {
+    std::map<std::string, std::shared_ptr<opset6::Constant>> constants;
+    for (const auto& node : function->get_ordered_ops()) {
+        if (auto constant = as_type_ptr<opset6::Constant>(node))
+            constants[constant->get_friendly_name()] = constant;
+    }
+    return constants;
+}
+}  // namespace
+
+// The constants of the model with a file per tensor are loaded in parallel, they must match the constants
+// read one by one from the stream of the combined weights
+TEST(FrontEndLoadConstsTest, constants_from_separate_files_match_combined_weights) {
+    FrontEndManager fem;
+    FrontEnd::Ptr frontEnd;
+    ASSERT_NO_THROW(frontEnd = fem.load_by_framework(PADDLE_FE));
+    ASSERT_NE(frontEnd, nullptr);
+
+    const auto model_dir = std::string(TEST_PADDLE_MODELS_DIRNAME) + "batch_norm_nchw/";
+    std::shared_ptr<Function> separate_files;
+    ASSERT_NO_THROW(separate_files = frontEnd->convert(frontEnd->load(FrontEndTestUtils::make_model_path(model_dir))));
+
+    std::ifstream model_stream(FrontEndTestUtils::make_model_path(model_dir + "batch_norm_nchw.pdmodel"),
+                               std::ios::in | std::ios::binary);
+    std::ifstream weights_stream(FrontEndTestUtils::make_model_path(model_dir + "batch_norm_nchw.pdiparams"),
+                                 std::ios::in | std::ios::binary);
+    std::istream* model_is = &model_stream;
+    std::istream* weights_is = &weights_stream;
+    std::shared_ptr<Function> combined_weights;
+    ASSERT_NO_THROW(combined_weights = frontEnd->convert(frontEnd->load(model_is, weights_is)));
+
+    const auto expected = get_constants(combined_weights);
+    const auto actual = get_constants(separate_files);
+    for (const auto& name : {"scale1", "bias1", "bn_mean1", "bn_variance1"}) {
+        ASSERT_EQ(1, expected.count(name)) << name;
+        ASSERT_EQ(1, actual.count(name)) << name;
+        const auto& expected_constant = expected.at(name);
+        const auto& actual_constant = actual.at(name);
+        ASSERT_EQ(expected_constant->get_element_type(), actual_constant->get_element_type()) << name;
+        ASSERT_EQ(expected_constant->get_shape(), actual_constant->get_shape()) << name;
+        const auto byte_size = shape_size(expected_constant->get_shape()) * expected_constant->get_element_type().size();
+        EXPECT_EQ(0, std::memcmp(expected_constant->get_data_ptr(), actual_constant->get_data_ptr(), byte_size))
+            << name;
+    }
+}
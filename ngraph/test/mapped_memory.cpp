@@ -0,0 +1,110 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/runtime/mapped_memory.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "ngraph/check.hpp"
+#include "ngraph/op/constant.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#ifndef _WIN32
+
+namespace {
+class MappedMemoryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_path = string("mapped_memory_") + ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".bin";
+    }
+
+    void TearDown() override {
+        std::remove(m_path.c_str());
+    }
+
+    void write_file(const string& contents) const {
+        ofstream file{m_path, ios::out | ios::binary | ios::trunc};
+        file.write(contents.data(), contents.size());
+    }
+
+    string m_path;
+};
+}  // namespace
+
+TEST_F(MappedMemoryTest, maps_contents_of_file) {
+    write_file("mapped memory");
+
+    const auto memory = runtime::MappedMemory::map_file(m_path);
+    ASSERT_NE(nullptr, memory);
+    ASSERT_EQ(13, memory->size());
+    EXPECT_EQ("mapped memory", string(memory->data(), memory->size()));
+}
+
+TEST_F(MappedMemoryTest, missing_or_empty_file_is_not_mapped) {
+    EXPECT_EQ(nullptr, runtime::MappedMemory::map_file(m_path));
+
+    write_file("");
+    EXPECT_EQ(nullptr, runtime::MappedMemory::map_file(m_path));
+}
+
+TEST_F(MappedMemoryTest, unchanged_file_is_mapped_once) {
+    write_file("mapped memory");
+
+    const auto first = runtime::MappedMemory::map_file(m_path);
+    const auto second = runtime::MappedMemory::map_file(m_path);
+    ASSERT_NE(nullptr, first);
+    EXPECT_EQ(first, second);
+}
+
+TEST_F(MappedMemoryTest, changed_file_is_mapped_again) {
+    write_file("mapped memory");
+    const auto first = runtime::MappedMemory::map_file(m_path);
+    ASSERT_NE(nullptr, first);
+
+    write_file("changed mapped memory");
+    const auto second = runtime::MappedMemory::map_file(m_path);
+    ASSERT_NE(nullptr, second);
+    EXPECT_NE(first, second);
+    EXPECT_EQ("changed mapped memory", string(second->data(), second->size()));
+}
+
+TEST_F(MappedMemoryTest, released_mapping_is_mapped_again) {
+    write_file("mapped memory");
+    runtime::MappedMemory::map_file(m_path).reset();
+
+    const auto memory = runtime::MappedMemory::map_file(m_path);
+    ASSERT_NE(nullptr, memory);
+    EXPECT_EQ("mapped memory", string(memory->data(), memory->size()));
+}
+
+TEST_F(MappedMemoryTest, constant_references_buffer_of_mapping) {
+    write_file("mapped memory");
+    auto memory = runtime::MappedMemory::map_file(m_path);
+    ASSERT_NE(nullptr, memory);
+
+    const auto constant = make_shared<op::Constant>(element::u8,
+                                                    Shape{6},
+                                                    runtime::MappedMemory::make_buffer(memory, 7, 6));
+    EXPECT_EQ(memory->data() + 7, constant->get_data_ptr());
+    // the constant keeps the mapping alive
+    memory.reset();
+    EXPECT_EQ("memory", string(constant->get_data_ptr<char>(), 6));
+}
+
+TEST_F(MappedMemoryTest, buffer_out_of_mapping_throws) {
+    write_file("mapped memory");
+    const auto memory = runtime::MappedMemory::map_file(m_path);
+    ASSERT_NE(nullptr, memory);
+
+    EXPECT_NO_THROW(runtime::MappedMemory::make_buffer(memory, 13, 0));
+    EXPECT_THROW(runtime::MappedMemory::make_buffer(memory, 14, 0), CheckFailure);
+    EXPECT_THROW(runtime::MappedMemory::make_buffer(memory, 7, 7), CheckFailure);
+}
+
+#endif
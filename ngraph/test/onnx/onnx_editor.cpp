@@ -1139,6 +1139,33 @@ NGRAPH_TEST(onnx_editor, values__modify_two_initializers) {
     test_case.run();
 }
 
+NGRAPH_TEST(onnx_editor, values__modify_initializer_referenced_by_converted_function) {
+    std::shared_ptr<Function> original;
+    std::shared_ptr<Function> modified;
+    {
+        onnx_editor::ONNXModelEditor editor{
+            file_util::path_join(SERIALIZED_ZOO, "onnx/model_editor/add_1D_with_raw_data_initializer.onnx")};
+        original = editor.get_function();
+
+        std::map<std::string, std::shared_ptr<ngraph::op::Constant>> in_vals;
+        in_vals.emplace("A", op::Constant::create(element::f32, Shape{2}, {3.f, 4.f}));
+        editor.set_input_values(in_vals);
+        modified = editor.get_function();
+    }
+
+    // the constants of the function converted before the modification keep the original data,
+    // also after the editor is destroyed
+    auto original_test_case = test::TestCase<TestEngine>(original);
+    original_test_case.add_input<float>(Shape{2}, {5.f, 6.f});
+    original_test_case.add_expected_output<float>(Shape{2}, {6.f, 8.f});
+    original_test_case.run();
+
+    auto modified_test_case = test::TestCase<TestEngine>(modified);
+    modified_test_case.add_input<float>(Shape{2}, {5.f, 6.f});
+    modified_test_case.add_expected_output<float>(Shape{2}, {8.f, 10.f});
+    modified_test_case.run();
+}
+
 NGRAPH_TEST(onnx_editor, values__no_inputs_modify_two_initializers) {
     onnx_editor::ONNXModelEditor editor{
         file_util::path_join(SERIALIZED_ZOO, "onnx/model_editor/add_1D_with_initializers_only.onnx")};
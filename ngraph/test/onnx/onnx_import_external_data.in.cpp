@@ -97,6 +97,20 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception) {
     }
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_out_of_file_bounds_exception) {
+    try {
+        auto function = onnx_import::import_onnx_model(
+            file_util::path_join(SERIALIZED_ZOO, "onnx/external_data/external_data_out_of_bounds.onnx"));
+        FAIL() << "External data beyond the end of the file not detected";
+    } catch (const ngraph_error& error) {
+        EXPECT_PRED_FORMAT2(testing::IsSubstring,
+                            std::string("tensor.data, offset: 8, data_length: 16, sha1_digest: 0)"),
+                            error.what());
+    } catch (...) {
+        FAIL() << "Importing onnx model failed for unexpected reason";
+    }
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_up_dir_path) {
     try {
         auto function = onnx_import::import_onnx_model(
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -11,6 +12,7 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/profiler.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -38,4 +40,143 @@ public:
         return false;
     }
 };
+
+class InsertReluPass : public pass::FunctionPass {
+public:
+    InsertReluPass() : FunctionPass() {
+        set_name("InsertRelu");
+    }
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override {
+        auto result = f->get_results()[0];
+        auto relu = make_shared<op::Relu>(result->input_value(0));
+        result->input(0).replace_source_output(relu);
+        return true;
+    }
+};
+
+// changes the function without reporting it
+class UnreportedInsertReluPass : public InsertReluPass {
+public:
+    UnreportedInsertReluPass() : InsertReluPass() {
+        set_name("UnreportedInsertRelu");
+    }
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override {
+        InsertReluPass::run_on_function(f);
+        return false;
+    }
+};
+
+class NestedManagerPass : public pass::FunctionPass {
+public:
+    NestedManagerPass() : FunctionPass() {
+        set_name("NestedManager");
+    }
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override {
+        pass::Manager manager;
+        manager.register_pass<InsertReluPass>();
+        manager.run_passes(f);
+        return true;
+    }
+};
+
+const pass::Profiler::Record& find_record(const vector<pass::Profiler::Record>& records, const string& name) {
+    auto it = find_if(records.begin(), records.end(), [&](const pass::Profiler::Record& record) {
+        return record.name == name;
+    });
+    if (it == records.end()) {
+        throw ngraph_error("No record of " + name);
+    }
+    return *it;
+}
 }  // namespace
+
+TEST(pass_manager, profiler_records_node_counts) {
+    auto graph = make_test_graph();
+    const auto node_count = static_cast<int64_t>(graph->get_ops().size());
+
+    auto profiler = make_shared<pass::Profiler>(true);
+    pass::Manager pass_manager;
+    pass_manager.set_profiler(profiler);
+    pass_manager.register_pass<InsertReluPass>();
+    pass_manager.run_passes(graph);
+
+    const auto records = profiler->get_records();
+    const auto& record = find_record(records, "InsertRelu");
+    EXPECT_EQ(record.category, "pass");
+    EXPECT_EQ(record.depth, 0u);
+    EXPECT_EQ(record.nodes_before, node_count);
+    EXPECT_EQ(record.nodes_after, node_count + 1);
+    EXPECT_EQ(record.nodes_created, 1);
+    EXPECT_GE(record.duration_us, 0);
+}
+
+TEST(pass_manager, profiler_records_node_counts_of_unreported_changes) {
+    auto graph = make_test_graph();
+    const auto node_count = static_cast<int64_t>(graph->get_ops().size());
+
+    auto profiler = make_shared<pass::Profiler>(true);
+    pass::Manager pass_manager;
+    pass_manager.set_profiler(profiler);
+    pass_manager.register_pass<UnreportedInsertReluPass>();
+    pass_manager.register_pass<DummyPass>();
+    pass_manager.run_passes(graph);
+
+    const auto records = profiler->get_records();
+    const auto& inserted = find_record(records, "UnreportedInsertRelu");
+    EXPECT_EQ(inserted.nodes_before, node_count);
+    EXPECT_EQ(inserted.nodes_after, node_count + 1);
+    EXPECT_EQ(inserted.nodes_created, 1);
+
+    const auto& dummy = find_record(records, DummyPass().get_name());
+    EXPECT_EQ(dummy.nodes_before, node_count + 1);
+    EXPECT_EQ(dummy.nodes_after, node_count + 1);
+    EXPECT_EQ(dummy.nodes_created, 0);
+}
+
+TEST(pass_manager, profiler_records_time_only_by_default) {
+    auto graph = make_test_graph();
+
+    auto profiler = make_shared<pass::Profiler>();
+    pass::Manager pass_manager;
+    pass_manager.set_profiler(profiler);
+    pass_manager.register_pass<InsertReluPass>();
+    pass_manager.run_passes(graph);
+
+    const auto records = profiler->get_records();
+    const auto& record = find_record(records, "InsertRelu");
+    EXPECT_EQ(record.nodes_before, -1);
+    EXPECT_EQ(record.nodes_after, -1);
+    EXPECT_EQ(record.nodes_created, -1);
+    EXPECT_GE(record.duration_us, 0);
+}
+
+TEST(pass_manager, profiler_records_nested_managers) {
+    auto graph = make_test_graph();
+
+    auto profiler = make_shared<pass::Profiler>(true);
+    {
+        pass::Profiler::Activation activation(profiler);
+        pass::Profiler::Scope scope("Compilation", "stage");
+
+        pass::Manager pass_manager;
+        pass_manager.register_pass<NestedManagerPass>();
+        pass_manager.run_passes(graph);
+    }
+    EXPECT_EQ(pass::Profiler::get_active(), nullptr);
+
+    const auto records = profiler->get_records();
+    const auto& compilation = find_record(records, "Compilation");
+    const auto& nested = find_record(records, "NestedManager");
+    const auto& inserted = find_record(records, "InsertRelu");
+    EXPECT_EQ(compilation.depth, 0u);
+    EXPECT_EQ(nested.depth, 1u);
+    EXPECT_EQ(inserted.depth, 2u);
+    EXPECT_EQ(nested.nodes_created, 1);
+    EXPECT_LE(compilation.start_us, nested.start_us);
+    EXPECT_GE(compilation.start_us + compilation.duration_us, nested.start_us + nested.duration_us);
+
+    stringstream trace;
+    profiler->serialize(trace);
+    EXPECT_NE(trace.str().find("\"traceEvents\""), string::npos);
+    EXPECT_NE(trace.str().find("{\"name\":\"InsertRelu\",\"cat\":\"pass\",\"ph\":\"X\""), string::npos);
+}
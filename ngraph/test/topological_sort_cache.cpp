@@ -0,0 +1,162 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/opsets/opset8.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+namespace {
+bool contains(const NodeVector& nodes, const shared_ptr<Node>& node) {
+    return std::find(nodes.begin(), nodes.end(), node) != nodes.end();
+}
+}  // namespace
+
+TEST(topological_sort_cache, repeated_calls_return_same_order) {
+    auto f = make_test_graph();
+    auto order = f->get_ordered_ops();
+    EXPECT_EQ(order, f->get_ordered_ops());
+    EXPECT_TRUE(validate_list(f->get_ordered_ops()));
+}
+
+TEST(topological_sort_cache, invalidated_by_replace_node) {
+    auto data = make_shared<opset8::Parameter>(element::f32, Shape{1, 3});
+    auto relu = make_shared<opset8::Relu>(data);
+    auto abs = make_shared<opset8::Abs>(relu);
+    auto f = make_shared<Function>(NodeVector{abs}, ParameterVector{data});
+    ASSERT_EQ(f->get_ordered_ops().size(), 4);
+
+    auto sigmoid = make_shared<opset8::Sigmoid>(data);
+    replace_node(relu, sigmoid);
+
+    auto order = f->get_ordered_ops();
+    EXPECT_EQ(order.size(), 4);
+    EXPECT_TRUE(contains(order, sigmoid));
+    EXPECT_FALSE(contains(order, relu));
+    EXPECT_TRUE(validate_list(order));
+}
+
+TEST(topological_sort_cache, invalidated_by_input_change) {
+    auto data = make_shared<opset8::Parameter>(element::f32, Shape{1, 3});
+    auto relu = make_shared<opset8::Relu>(data);
+    auto abs = make_shared<opset8::Abs>(relu);
+    auto f = make_shared<Function>(NodeVector{abs}, ParameterVector{data});
+    f->get_ordered_ops();
+
+    auto neg = make_shared<opset8::Negative>(relu);
+    abs->input(0).replace_source_output(neg);
+
+    auto order = f->get_ordered_ops();
+    EXPECT_EQ(order.size(), 5);
+    EXPECT_TRUE(contains(order, neg));
+    EXPECT_TRUE(validate_list(order));
+}
+
+TEST(topological_sort_cache, invalidated_by_set_arguments) {
+    auto data = make_shared<opset8::Parameter>(element::f32, Shape{1, 3});
+    auto concat = make_shared<opset8::Concat>(OutputVector{data}, 0);
+    auto f = make_shared<Function>(NodeVector{concat}, ParameterVector{data});
+    ASSERT_EQ(f->get_ordered_ops().size(), 3);
+
+    auto neg = make_shared<opset8::Negative>(data);
+    concat->set_arguments(OutputVector{neg});
+
+    auto order = f->get_ordered_ops();
+    EXPECT_EQ(order.size(), 4);
+    EXPECT_TRUE(contains(order, neg));
+    EXPECT_TRUE(validate_list(order));
+}
+
+TEST(topological_sort_cache, invalidated_by_control_dependency) {
+    auto data = make_shared<opset8::Parameter>(element::f32, Shape{1, 3});
+    auto left = make_shared<opset8::Relu>(data);
+    auto right = make_shared<opset8::Abs>(data);
+    auto f = make_shared<Function>(NodeVector{left, right}, ParameterVector{data});
+    f->get_ordered_ops();
+
+    right->add_control_dependency(left);
+    auto order = f->get_ordered_ops();
+    EXPECT_LT(std::find(order.begin(), order.end(), left), std::find(order.begin(), order.end(), right));
+
+    right->remove_control_dependency(left);
+    left->add_control_dependency(right);
+    order = f->get_ordered_ops();
+    EXPECT_LT(std::find(order.begin(), order.end(), right), std::find(order.begin(), order.end(), left));
+}
+
+TEST(topological_sort_cache, invalidated_by_function_results) {
+    auto data = make_shared<opset8::Parameter>(element::f32, Shape{1, 3});
+    auto relu = make_shared<opset8::Relu>(data);
+    auto f = make_shared<Function>(NodeVector{relu}, ParameterVector{data});
+    ASSERT_EQ(f->get_ordered_ops().size(), 3);
+
+    auto result = make_shared<opset8::Result>(make_shared<opset8::Abs>(data));
+    f->add_results({result});
+    EXPECT_EQ(f->get_ordered_ops().size(), 5);
+
+    f->remove_result(result);
+    EXPECT_EQ(f->get_ordered_ops().size(), 3);
+}
+
+TEST(topological_sort_cache, invalidated_by_removed_node) {
+    auto data = make_shared<opset8::Parameter>(element::f32, Shape{1, 3});
+    auto relu = make_shared<opset8::Relu>(data);
+    auto f = make_shared<Function>(NodeVector{relu}, ParameterVector{data});
+    f->get_ordered_ops();
+
+    auto result = f->get_results()[0];
+    {
+        auto abs = make_shared<opset8::Abs>(relu);
+        result->input(0).replace_source_output(abs);
+        ASSERT_EQ(f->get_ordered_ops().size(), 4);
+        result->input(0).replace_source_output(relu);
+    }
+    EXPECT_EQ(f->get_ordered_ops().size(), 3);
+}
+
+TEST(topological_sort_cache, node_shared_by_destroyed_functions) {
+    auto data = make_shared<opset8::Parameter>(element::f32, Shape{1, 3});
+    auto relu = make_shared<opset8::Relu>(data);
+    auto f = make_shared<Function>(NodeVector{relu}, ParameterVector{data});
+    f->get_ordered_ops();
+
+    for (size_t i = 0; i < 100; i++) {
+        auto other = make_shared<Function>(NodeVector{relu}, ParameterVector{data});
+        ASSERT_EQ(other->get_ordered_ops().size(), 3);
+    }
+
+    auto abs = make_shared<opset8::Abs>(relu);
+    f->get_results()[0]->input(0).replace_source_output(abs);
+    auto order = f->get_ordered_ops();
+    EXPECT_EQ(order.size(), 4);
+    EXPECT_TRUE(contains(order, abs));
+}
+
+TEST(topological_sort_cache, node_shared_by_functions_sorted_concurrently) {
+    auto data = make_shared<opset8::Parameter>(element::f32, Shape{1, 3});
+    shared_ptr<Node> node = data;
+    for (size_t i = 0; i < 100; i++) {
+        node = make_shared<opset8::Relu>(node);
+    }
+    auto first = make_shared<Function>(NodeVector{node}, ParameterVector{data});
+    auto second = make_shared<Function>(NodeVector{node}, ParameterVector{data});
+
+    auto sort = [](const shared_ptr<Function>& f) {
+        for (size_t i = 0; i < 100; i++) {
+            f->set_topological_sort(topological_sort<std::vector<std::shared_ptr<Node>>>);
+            ASSERT_EQ(f->get_ordered_ops().size(), 103);
+        }
+    };
+    std::thread first_thread(sort, first);
+    std::thread second_thread(sort, second);
+    first_thread.join();
+    second_thread.join();
+}
@@ -31,6 +31,13 @@ namespace openvino
          */
         typedef struct handle_ {} *handle_t;
 
+        /**
+         * @typedef counter_t
+         * @ingroup ie_dev_profiling
+         * @brief A counter type which enables tracking of the number of events in a program.
+         */
+        typedef struct counter_ {} *counter_t;
+
 /**
  * @cond
  */
@@ -41,6 +48,8 @@ namespace openvino
             void taskBegin(domain_t d, handle_t t);
             void taskEnd(domain_t d);
             void threadName(const char* name);
+            counter_t counter(char const* name, domain_t d);
+            void counterInc(counter_t c);
         }
 /**
  * @endcond
@@ -369,6 +378,31 @@ inline openvino::itt::domain_t domainName() noexcept
 #define OV_ITT_SCOPE_SKIP_0(chainId)
 #define OV_ITT_SCOPE_SKIP_1(chainId) chainId.skip();
 
+/**
+ * @endcond
+ */
+
+/**
+ * @def OV_ITT_COUNTER_INC(domain, counterName)
+ * @ingroup ie_dev_profiling
+ * @brief Increments the counter with a given name, the counter is displayed in Intel VTune next to the tasks of @p domain.
+ * @param domain [in] Known at compile time name of module or library (the domain name).
+ * @param counterName [in] Known at compile time name of the counter.
+ */
+#define OV_ITT_COUNTER_INC(domain, counterName)                                                     \
+    OV_PP_EXPAND(OV_PP_CAT(OV_ITT_COUNTER_INC_IMPL_, OV_PP_IS_ENABLED(OV_ITT_GROUP(ALL)))(domain, counterName))
+
+/**
+ * @cond
+ */
+
+#define OV_ITT_COUNTER_INC_IMPL_0(domain, counterName)
+#define OV_ITT_COUNTER_INC_IMPL_1(domain, counterName)                                              \
+    {                                                                                               \
+        static auto OV_PP_CAT(ittCounter, __LINE__) = openvino::itt::internal::counter(counterName, domain()); \
+        openvino::itt::internal::counterInc(OV_PP_CAT(ittCounter, __LINE__));                      \
+    }
+
 /**
  * @endcond
  */
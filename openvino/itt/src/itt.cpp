@@ -48,6 +48,15 @@ void threadName(const char* name) {
     __itt_thread_set_name(name);
 }
 
+counter_t counter(char const* name, domain_t d) {
+    auto domain = reinterpret_cast<__itt_domain*>(d);
+    return reinterpret_cast<counter_t>(__itt_counter_create(name, domain ? domain->nameA : nullptr));
+}
+
+void counterInc(counter_t c) {
+    __itt_counter_inc(reinterpret_cast<__itt_counter>(c));
+}
+
 #else
 
 domain_t domain(char const *) { return nullptr; }
@@ -60,6 +69,10 @@ void taskEnd(domain_t) { }
 
 void threadName(const char *) { }
 
+counter_t counter(char const *, domain_t) { return nullptr; }
+
+void counterInc(counter_t) { }
+
 #endif  // ENABLE_PROFILING_ITT
 
 }  // namespace internal
@@ -12,6 +12,9 @@
 
 #include <inference_engine.hpp>
 
+#include <fstream>
+#include <sstream>
+
 using namespace InferenceEngine;
 
 
@@ -31,6 +34,10 @@ public:
         device = test_params.device;
         precision = test_params.precision;
 
+        // ONNX specific cases run and have references only for ONNX models of the config
+        if (test_name.find("onnx") != std::string::npos && model.substr(model.rfind('.') + 1) != "onnx")
+            GTEST_SKIP() << "Model is expected to be ONNX model";
+
         test_refs.collect_vm_values_for_test(test_name, test_params);
         EXPECT_GT(test_refs.references[VMSIZE], 0) << "Reference value of VmSize is less than 0. Value: "
                                            << test_refs.references[VMSIZE];
@@ -100,6 +107,82 @@ TEST_P(MemCheckTestSuite, infer_request_inference) {
     TestResult res = common_test_pipeline(test_pipeline, test_refs.references);
     EXPECT_EQ(res.first, TestStatus::TEST_OK) << res.second;
 }
+
+// Weights are memory-mapped by Core, so they are not counted twice in RSS of the process
+TEST_P(MemCheckTestSuite, read_network) {
+    log_info("Read network: \"" << model << "\" with precision: \"" << precision << "\"");
+    auto test_pipeline = [&]{
+        MemCheckPipeline memCheckPipeline;
+
+        Core ie;
+        CNNNetwork cnnNetwork = ie.ReadNetwork(model);
+
+        log_info("Memory consumption after ReadNetwork:");
+        memCheckPipeline.record_measures(test_name);
+
+        log_debug(memCheckPipeline.get_reference_record_for_test(test_name, model_name, precision, device));
+        return memCheckPipeline.measure();
+    };
+
+    TestResult res = common_test_pipeline(test_pipeline, test_refs.references);
+    EXPECT_EQ(res.first, TestStatus::TEST_OK) << res.second;
+}
+
+// Reference for read_network: weights are read into a heap blob instead of being memory-mapped
+TEST_P(MemCheckTestSuite, read_network_from_memory) {
+    log_info("Read network from memory: \"" << model << "\" with precision: \"" << precision << "\"");
+    auto test_pipeline = [&]{
+        MemCheckPipeline memCheckPipeline;
+
+        const std::string weights_path = model.substr(0, model.rfind('.')) + ".bin";
+        std::ifstream model_file(model);
+        std::ifstream weights_file(weights_path, std::ios::binary | std::ios::ate);
+        if (!model_file.is_open() || !weights_file.is_open())
+            throw std::invalid_argument("Model is expected to be IR with weights");
+
+        std::stringstream model_stream;
+        model_stream << model_file.rdbuf();
+        const size_t weights_size = weights_file.tellg();
+        weights_file.seekg(0, std::ios::beg);
+        Blob::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, {weights_size}, Layout::C});
+        weights->allocate();
+        weights_file.read(weights->buffer(), weights_size);
+
+        Core ie;
+        CNNNetwork cnnNetwork = ie.ReadNetwork(model_stream.str(), weights);
+
+        log_info("Memory consumption after ReadNetwork from memory:");
+        memCheckPipeline.record_measures(test_name);
+
+        log_debug(memCheckPipeline.get_reference_record_for_test(test_name, model_name, precision, device));
+        return memCheckPipeline.measure();
+    };
+
+    TestResult res = common_test_pipeline(test_pipeline, test_refs.references);
+    EXPECT_EQ(res.first, TestStatus::TEST_OK) << res.second;
+}
+
+// Initializers and external data of ONNX model are referenced by constants, so peak memory
+// consumption of reading is expected to be close to the size of the model instead of twice of it
+TEST_P(MemCheckTestSuite, read_onnx_network) {
+    log_info("Read ONNX network: \"" << model << "\" with precision: \"" << precision << "\"");
+    auto test_pipeline = [&]{
+        MemCheckPipeline memCheckPipeline;
+
+        Core ie;
+        CNNNetwork cnnNetwork = ie.ReadNetwork(model);
+
+        log_info("Memory consumption after ReadNetwork of ONNX model:");
+        memCheckPipeline.record_measures(test_name);
+
+        log_debug(memCheckPipeline.get_reference_record_for_test(test_name, model_name, precision, device));
+        return memCheckPipeline.measure();
+    };
+
+    TestResult res = common_test_pipeline(test_pipeline, test_refs.references);
+    EXPECT_EQ(res.first, TestStatus::TEST_OK) << res.second;
+}
+
 // tests_pipelines/tests_pipelines.cpp
 
 INSTANTIATE_TEST_SUITE_P(MemCheckTests, MemCheckTestSuite,
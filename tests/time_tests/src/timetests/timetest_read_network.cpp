@@ -0,0 +1,47 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <inference_engine.hpp>
+#include <iostream>
+
+#include "timetests_helper/timer.h"
+using namespace InferenceEngine;
+
+
+/**
+ * @brief Function that contain executable pipeline which will be called from
+ * main(). The function should not throw any exceptions and responsible for
+ * handling it by itself.
+ *
+ * Reads IR, weights are memory-mapped by Core. Reading of IR from memory is
+ * measured by timetest_read_network_from_memory, each variant runs in its own
+ * process instead of one after the other in the same Core.
+ */
+int runPipeline(const std::string &model, const std::string &device) {
+  auto pipeline = [](const std::string &model, const std::string &device) {
+    Core ie;
+
+    {
+      SCOPED_TIMER(read_network);
+      CNNNetwork cnnNetwork = ie.ReadNetwork(model);
+    }
+  };
+
+  try {
+    pipeline(model, device);
+  } catch (const InferenceEngine::Exception &iex) {
+    std::cerr
+        << "Inference Engine pipeline failed with Inference Engine exception:\n"
+        << iex.what();
+    return 1;
+  } catch (const std::exception &ex) {
+    std::cerr << "Inference Engine pipeline failed with exception:\n"
+              << ex.what();
+    return 2;
+  } catch (...) {
+    std::cerr << "Inference Engine pipeline failed\n";
+    return 3;
+  }
+  return 0;
+}
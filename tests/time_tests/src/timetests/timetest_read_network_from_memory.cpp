@@ -0,0 +1,63 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <inference_engine.hpp>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "timetests_helper/timer.h"
+using namespace InferenceEngine;
+
+
+/**
+ * @brief Function that contain executable pipeline which will be called from
+ * main(). The function should not throw any exceptions and responsible for
+ * handling it by itself.
+ *
+ * Reads IR when weights are read into a heap blob by the application, the
+ * reference for timetest_read_network.
+ */
+int runPipeline(const std::string &model, const std::string &device) {
+  auto pipeline = [](const std::string &model, const std::string &device) {
+    Core ie;
+
+    {
+      SCOPED_TIMER(read_network_from_memory);
+      std::ifstream modelFile(model);
+      std::ifstream weightsFile(model.substr(0, model.rfind('.')) + ".bin",
+                                std::ios::binary | std::ios::ate);
+      if (!modelFile.is_open() || !weightsFile.is_open())
+        throw std::invalid_argument("Model is expected to be IR with weights");
+
+      std::stringstream modelStream;
+      modelStream << modelFile.rdbuf();
+      const size_t weightsSize = weightsFile.tellg();
+      weightsFile.seekg(0, std::ios::beg);
+      Blob::Ptr weights = make_shared_blob<uint8_t>(
+          {Precision::U8, {weightsSize}, Layout::C});
+      weights->allocate();
+      weightsFile.read(weights->buffer(), weightsSize);
+
+      CNNNetwork cnnNetwork = ie.ReadNetwork(modelStream.str(), weights);
+    }
+  };
+
+  try {
+    pipeline(model, device);
+  } catch (const InferenceEngine::Exception &iex) {
+    std::cerr
+        << "Inference Engine pipeline failed with Inference Engine exception:\n"
+        << iex.what();
+    return 1;
+  } catch (const std::exception &ex) {
+    std::cerr << "Inference Engine pipeline failed with exception:\n"
+              << ex.what();
+    return 2;
+  } catch (...) {
+    std::cerr << "Inference Engine pipeline failed\n";
+    return 3;
+  }
+  return 0;
+}
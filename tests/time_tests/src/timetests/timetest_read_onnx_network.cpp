@@ -0,0 +1,48 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <inference_engine.hpp>
+#include <iostream>
+
+#include "timetests_helper/timer.h"
+using namespace InferenceEngine;
+
+
+/**
+ * @brief Function that contain executable pipeline which will be called from
+ * main(). The function should not throw any exceptions and responsible for
+ * handling it by itself.
+ *
+ * Reads ONNX model from the file, initializers and external data are
+ * referenced by constants instead of being copied.
+ */
+int runPipeline(const std::string &model, const std::string &device) {
+  auto pipeline = [](const std::string &model, const std::string &device) {
+    Core ie;
+
+    if (model.substr(model.rfind('.') + 1) != "onnx")
+      throw std::invalid_argument("Model is expected to be ONNX model");
+    {
+      SCOPED_TIMER(read_onnx_network);
+      CNNNetwork cnnNetwork = ie.ReadNetwork(model);
+    }
+  };
+
+  try {
+    pipeline(model, device);
+  } catch (const InferenceEngine::Exception &iex) {
+    std::cerr
+        << "Inference Engine pipeline failed with Inference Engine exception:\n"
+        << iex.what();
+    return 1;
+  } catch (const std::exception &ex) {
+    std::cerr << "Inference Engine pipeline failed with exception:\n"
+              << ex.what();
+    return 2;
+  } catch (...) {
+    std::cerr << "Inference Engine pipeline failed\n";
+    return 3;
+  }
+  return 0;
+}